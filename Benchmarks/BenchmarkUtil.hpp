@@ -0,0 +1,56 @@
+#pragma once
+
+// MISRA C++ 2023 compliant includes
+#include <algorithm>
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <sys/resource.h>
+#include <vector>
+
+/**
+ * @brief Small helpers shared by the benchmark programs.
+ */
+namespace bench {
+
+inline int64_t nowNs() noexcept {
+    return std::chrono::duration_cast<std::chrono::nanoseconds>(
+               std::chrono::steady_clock::now().time_since_epoch())
+        .count();
+}
+
+/// CPU time consumed by the calling thread (user + system)
+inline int64_t threadCpuNs() noexcept {
+    rusage usage{};
+    (void)getrusage(RUSAGE_THREAD, &usage);
+    return (static_cast<int64_t>(usage.ru_utime.tv_sec + usage.ru_stime.tv_sec) * 1000000000LL) +
+           (static_cast<int64_t>(usage.ru_utime.tv_usec + usage.ru_stime.tv_usec) * 1000LL);
+}
+
+inline long argOrDefault(int argc, char** argv, int index, long fallback) noexcept {
+    return (argc > index) ? std::strtol(argv[index], nullptr, 10) : fallback;
+}
+
+/// Keeps the optimizer from discarding a computed value
+template <typename T>
+inline void doNotOptimize(const T& value) noexcept {
+    asm volatile("" : : "r,m"(value) : "memory");
+}
+
+/// Sorts samples and prints p50/p99/p99.9/max in microseconds
+inline void printPercentiles(const char* label, std::vector<int64_t>& samples) {
+    if (samples.empty()) {
+        std::printf("%-12s no samples\n", label);
+        return;
+    }
+    std::sort(samples.begin(), samples.end());
+    const auto at = [&samples](double quantile) {
+        const std::size_t index = static_cast<std::size_t>(quantile * static_cast<double>(samples.size() - 1U));
+        return static_cast<double>(samples[index]) / 1000.0;
+    };
+    std::printf("%-12s n=%-8zu p50 %9.2f us  p99 %9.2f us  p99.9 %9.2f us  max %9.2f us\n", label,
+                samples.size(), at(0.50), at(0.99), at(0.999), static_cast<double>(samples.back()) / 1000.0);
+}
+
+}  // namespace bench
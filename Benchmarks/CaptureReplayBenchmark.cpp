@@ -0,0 +1,160 @@
+// Capture and replay of the five track groups.
+//  1. records live loopback traffic through CaptureRecorder
+//  2. measures raw CaptureWriter append throughput
+//  3. replays as fast as possible into an in-process dispatcher (decode included)
+//  4. replays the live capture into the transport at 1x and 10x
+//
+// Usage: capture_replay_benchmark [synthetic records] [capture path]
+
+#include <atomic>
+#include <cstdio>
+#include <memory>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "BenchmarkUtil.hpp"
+#include "CaptureRecorder.hpp"
+#include "CaptureReplayer.hpp"
+#include "IoEngine.hpp"
+#include "TrackMessageDispatcher.hpp"
+#include "TrackPublisher.hpp"
+
+namespace {
+
+const char* const INTERFACE_ADDRESS = "127.0.0.1";
+
+std::vector<EndpointConfig> trackEndpoints() {
+    return {makeEndpointConfig<DelayCalcTrackData>(INTERFACE_ADDRESS),
+            makeEndpointConfig<ExtrapTrackData>(INTERFACE_ADDRESS),
+            makeEndpointConfig<FinalCalcTrackData>(INTERFACE_ADDRESS),
+            makeEndpointConfig<ProcessedTrackData>(INTERFACE_ADDRESS),
+            makeEndpointConfig<TrackStatics>(INTERFACE_ADDRESS)};
+}
+
+void subscribeAll(TrackMessageDispatcher& dispatcher, uint64_t& decoded) {
+    dispatcher.subscribe<DelayCalcTrackData>([&decoded](const DelayCalcTrackData&) { ++decoded; });
+    dispatcher.subscribe<ExtrapTrackData>([&decoded](const ExtrapTrackData&) { ++decoded; });
+    dispatcher.subscribe<FinalCalcTrackData>([&decoded](const FinalCalcTrackData&) { ++decoded; });
+    dispatcher.subscribe<ProcessedTrackData>([&decoded](const ProcessedTrackData&) { ++decoded; });
+    dispatcher.subscribe<TrackStatics>([&decoded](const TrackStatics&) { ++decoded; });
+}
+
+/// Publishes one record per group every 100 us for the given count
+void publishLive(long rounds) {
+    std::unique_ptr<IoEngine> engine = IoEngine::create(IoEngineKind::Epoll);
+    TrackPublisher publisher(*engine);
+    publisher.advertise<DelayCalcTrackData>(INTERFACE_ADDRESS);
+    publisher.advertise<ExtrapTrackData>(INTERFACE_ADDRESS);
+    publisher.advertise<FinalCalcTrackData>(INTERFACE_ADDRESS);
+    publisher.advertise<ProcessedTrackData>(INTERFACE_ADDRESS);
+    publisher.advertise<TrackStatics>(INTERFACE_ADDRESS);
+    for (long i = 0; i < rounds; ++i) {
+        (void)publisher.publish(DelayCalcTrackData{});
+        (void)publisher.publish(ExtrapTrackData{});
+        (void)publisher.publish(FinalCalcTrackData{});
+        (void)publisher.publish(ProcessedTrackData{});
+        (void)publisher.publish(TrackStatics{});
+        std::this_thread::sleep_for(std::chrono::microseconds(100));
+    }
+}
+
+void captureLive(const std::string& path, long rounds) {
+    CaptureWriter writer(path);
+    CaptureRecorder recorder(writer);
+    std::unique_ptr<IoEngine> engine = IoEngine::create();
+    uint64_t delivered = 0U;
+    engine->setHandler(recorder.wrap([&delivered](const ReceivedDatagram&) { ++delivered; }));
+    for (const EndpointConfig& config : trackEndpoints()) {
+        recorder.addEndpoint(engine->addReceiver(config), config);
+    }
+    std::thread sender(publishLive, rounds);
+    while (engine->poll(300) > 0U || delivered == 0U) {
+    }
+    sender.join();
+    std::printf("live capture    %llu datagrams recorded via %s (%zu bytes)\n",
+                static_cast<unsigned long long>(writer.getRecordCount()), engine->name(), writer.getBytesWritten());
+}
+
+void writeSynthetic(const std::string& path, long records) {
+    std::vector<std::vector<uint8_t>> datagrams(5U);
+    TrackPublisher::encode(DelayCalcTrackData{}, 0U, datagrams[0]);
+    TrackPublisher::encode(ExtrapTrackData{}, 0U, datagrams[1]);
+    TrackPublisher::encode(FinalCalcTrackData{}, 0U, datagrams[2]);
+    TrackPublisher::encode(ProcessedTrackData{}, 0U, datagrams[3]);
+    TrackPublisher::encode(TrackStatics{}, 0U, datagrams[4]);
+
+    CaptureWriter writer(path);
+    const int64_t start = bench::nowNs();
+    for (long i = 0; i < records; ++i) {
+        std::vector<uint8_t>& datagram = datagrams[static_cast<std::size_t>(i % 5)];
+        // Restamp the group sequence in place so the replay is not seen as duplicates
+        MessageEnvelope envelope;
+        envelope.sequence = static_cast<uint64_t>(i / 5);
+        envelope.encode(&datagram[1U + datagram[0]]);
+        writer.append(i * 1000, 0U, static_cast<uint16_t>(9595 + (i % 5)), datagram.data(), datagram.size());
+    }
+    const double seconds = static_cast<double>(bench::nowNs() - start) / 1e9;
+    std::printf("write           %ld records in %.3f s: %.2f M records/s, %.1f MB/s\n", records, seconds,
+                static_cast<double>(records) / seconds / 1e6,
+                static_cast<double>(writer.getBytesWritten()) / seconds / 1e6);
+}
+
+void replayInProcess(const std::string& path) {
+    CaptureReader reader(path);
+    TrackMessageDispatcher dispatcher;
+    uint64_t decoded = 0U;
+    subscribeAll(dispatcher, decoded);
+    CaptureReplayer::Options options;
+    options.speed = 0.0;
+    const int64_t start = bench::nowNs();
+    const uint64_t replayed = CaptureReplayer(options).replay(reader, [&dispatcher](const CaptureRecord& record) {
+        (void)dispatcher.dispatch(record.payload, record.length);
+    });
+    const double seconds = static_cast<double>(bench::nowNs() - start) / 1e9;
+    std::printf("replay max      %llu records (%llu decoded) in %.3f s: %.2f M records/s\n",
+                static_cast<unsigned long long>(replayed), static_cast<unsigned long long>(decoded), seconds,
+                static_cast<double>(replayed) / seconds / 1e6);
+}
+
+void replayToTransport(const std::string& path, double speed) {
+    CaptureReader reader(path);
+    std::unique_ptr<IoEngine> engine = IoEngine::create(IoEngineKind::Epoll);
+    CaptureReplayer::Options options;
+    options.speed = speed;
+    int64_t first = 0;
+    int64_t last = 0;
+    const int64_t start = bench::nowNs();
+    const CaptureReplayer::Sink send = CaptureReplayer::engineSink(*engine, INTERFACE_ADDRESS);
+    const uint64_t replayed = CaptureReplayer(options).replay(reader, [&](const CaptureRecord& record) {
+        first = (first == 0) ? record.timestampNs : first;
+        last = record.timestampNs;
+        send(record);
+    });
+    const double seconds = static_cast<double>(bench::nowNs() - start) / 1e9;
+    std::printf("replay %4.0fx    %llu records in %.3f s (recorded span %.3f s)\n", speed,
+                static_cast<unsigned long long>(replayed), seconds, static_cast<double>(last - first) / 1e9);
+}
+
+}  // namespace
+
+int main(int argc, char** argv) {
+    const long records = bench::argOrDefault(argc, argv, 1, 5000000);
+    const std::string path = (argc > 2) ? argv[2] : "/tmp/zmqdef_capture.bin";
+    const std::string livePath = path + ".live";
+
+    std::printf("=== Capture/replay benchmark ===\n");
+    try {
+        captureLive(livePath, 2000);
+        replayToTransport(livePath, 1.0);
+        replayToTransport(livePath, 10.0);
+        writeSynthetic(path, records);
+        replayInProcess(path);
+    } catch (const std::exception& e) {
+        std::fprintf(stderr, "Hata: %s\n", e.what());
+        return 1;
+    }
+    (void)std::remove(path.c_str());
+    (void)std::remove(livePath.c_str());
+    return 0;
+}
@@ -0,0 +1,138 @@
+// Cost and coverage of the optional CRC32C record trailer.
+// Part 1 times Crc32c::compute with the SSE4.2 instruction and with the
+// table fallback over every record size of the schemas. Part 2 compares
+// serialize/deserialize with and without trailer on FinalCalcTrackData.
+// Part 3 flips one random bit per record and counts how many corruptions
+// isValid() notices versus the trailer.
+//
+// Usage: checksum_benchmark [iterations] [corrupted records]
+
+#include <cstdio>
+#include <random>
+#include <vector>
+
+#include "BenchmarkUtil.hpp"
+#include "Crc32c.hpp"
+#include "DelayCalcTrackData.hpp"
+#include "ExtrapTrackData.hpp"
+#include "FinalCalcTrackData.hpp"
+#include "ProcessedTrackData.hpp"
+#include "TrackStatics.hpp"
+
+namespace {
+
+double timePerCall(long iterations, const std::vector<uint8_t>& data, uint32_t (*function)(const uint8_t*, std::size_t)) {
+    uint32_t sink = 0U;
+    const int64_t start = bench::nowNs();
+    for (long i = 0; i < iterations; ++i) {
+        sink ^= function(data.data(), data.size());
+        bench::doNotOptimize(sink);
+    }
+    return static_cast<double>(bench::nowNs() - start) / static_cast<double>(iterations);
+}
+
+void measureCrc(long iterations) {
+    const std::size_t sizes[] = {
+        ProcessedTrackData{}.getSerializedSize(), ExtrapTrackData{}.getSerializedSize(),
+        DelayCalcTrackData{}.getSerializedSize(), TrackStatics{}.getSerializedSize(),
+        FinalCalcTrackData{}.getSerializedSize(), 1400U};
+    std::printf("CRC32C (hardware %s)\n", Crc32c::hasHardwareSupport() ? "available" : "unavailable");
+    std::printf("%8s %14s %14s\n", "bytes", "sse4.2 ns", "table ns");
+    for (const std::size_t size : sizes) {
+        std::vector<uint8_t> data(size);
+        for (std::size_t i = 0U; i < size; ++i) {
+            data[i] = static_cast<uint8_t>(i * 131U);
+        }
+        if (Crc32c::hasHardwareSupport() && (Crc32c::computeHardware(data.data(), size) !=
+                                             Crc32c::computeSoftware(data.data(), size))) {
+            std::printf("Hata: hardware and table CRC differ for %zu bytes\n", size);
+        }
+        const double hardware =
+            Crc32c::hasHardwareSupport() ? timePerCall(iterations, data, &Crc32c::computeHardware) : 0.0;
+        std::printf("%8zu %14.2f %14.2f\n", size, hardware, timePerCall(iterations, data, &Crc32c::computeSoftware));
+    }
+}
+
+FinalCalcTrackData makeRecord(long i) {
+    FinalCalcTrackData message;
+    message.setTrackId(static_cast<int64_t>(i % 9999) + 1);
+    message.setXPositionECEF(4.0e6 + static_cast<double>(i));
+    message.setYPositionECEF(1.0e6);
+    message.setZPositionECEF(4.8e6);
+    message.setXVelocityECEF(200.0);
+    message.setUpdateTime(1000000000LL + i);
+    return message;
+}
+
+void measureSerialization(long iterations) {
+    const FinalCalcTrackData message = makeRecord(7);
+    const std::vector<uint8_t> plain = message.serialize();
+    const std::vector<uint8_t> checked = message.serializeWithChecksum();
+    FinalCalcTrackData decoded;
+
+    int64_t start = bench::nowNs();
+    for (long i = 0; i < iterations; ++i) {
+        bench::doNotOptimize(message.serialize());
+    }
+    const double serializeNs = static_cast<double>(bench::nowNs() - start) / static_cast<double>(iterations);
+    start = bench::nowNs();
+    for (long i = 0; i < iterations; ++i) {
+        bench::doNotOptimize(message.serializeWithChecksum());
+    }
+    const double serializeCrcNs = static_cast<double>(bench::nowNs() - start) / static_cast<double>(iterations);
+    start = bench::nowNs();
+    for (long i = 0; i < iterations; ++i) {
+        bench::doNotOptimize(decoded.deserialize(plain));
+    }
+    const double deserializeNs = static_cast<double>(bench::nowNs() - start) / static_cast<double>(iterations);
+    start = bench::nowNs();
+    for (long i = 0; i < iterations; ++i) {
+        bench::doNotOptimize(decoded.deserializeWithChecksum(checked));
+    }
+    const double deserializeCrcNs = static_cast<double>(bench::nowNs() - start) / static_cast<double>(iterations);
+
+    std::printf("\nFinalCalcTrackData (%zu bytes + %zu trailer)\n", plain.size(), FinalCalcTrackData::CHECKSUM_SIZE);
+    std::printf("%-14s %10s %12s %10s\n", "", "plain ns", "checksum ns", "added ns");
+    std::printf("%-14s %10.2f %12.2f %10.2f\n", "serialize", serializeNs, serializeCrcNs, serializeCrcNs - serializeNs);
+    std::printf("%-14s %10.2f %12.2f %10.2f\n", "deserialize", deserializeNs, deserializeCrcNs,
+                deserializeCrcNs - deserializeNs);
+}
+
+void measureDetection(long records) {
+    std::mt19937 random(7U);
+    long caughtByValidation = 0;
+    long caughtByChecksum = 0;
+    FinalCalcTrackData decoded;
+    for (long i = 0; i < records; ++i) {
+        std::vector<uint8_t> bytes = makeRecord(i).serializeWithChecksum();
+        const std::size_t bit = random() % ((bytes.size() - FinalCalcTrackData::CHECKSUM_SIZE) * 8U);
+        bytes[bit / 8U] = static_cast<uint8_t>(bytes[bit / 8U] ^ (1U << (bit % 8U)));
+        if (!decoded.deserialize(bytes) || !decoded.isValid()) {
+            ++caughtByValidation;
+        }
+        if (!decoded.deserializeWithChecksum(bytes)) {
+            ++caughtByChecksum;
+        }
+    }
+    std::printf("\nSingle-bit corruption of %ld records: isValid() caught %.1f%%, CRC32C caught %.1f%%\n", records,
+                100.0 * static_cast<double>(caughtByValidation) / static_cast<double>(records),
+                100.0 * static_cast<double>(caughtByChecksum) / static_cast<double>(records));
+}
+
+}  // namespace
+
+int main(int argc, char** argv) {
+    const long iterations = bench::argOrDefault(argc, argv, 1, 10000000);
+    const long corrupted = bench::argOrDefault(argc, argv, 2, 100000);
+
+    std::printf("=== CRC32C trailer: %ld iterations, %ld corrupted records ===\n", iterations, corrupted);
+    try {
+        measureCrc(iterations);
+        measureSerialization(iterations);
+        measureDetection(corrupted);
+    } catch (const std::exception& e) {
+        std::fprintf(stderr, "Hata: %s\n", e.what());
+        return 1;
+    }
+    return 0;
+}
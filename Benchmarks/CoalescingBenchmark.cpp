@@ -0,0 +1,123 @@
+// Immediate sends versus coalesced batches across load levels.
+// One thread paces ExtrapTrackData at each rate, stamping firstHopSentTime,
+// and polls the receiver while it waits, so the latency covers the time a
+// record spends in a batch. Reports the rate actually achieved (immediate
+// sends saturate first), datagrams, records per datagram and
+// publish-to-handler latency.
+//
+// Usage: coalescing_benchmark [milliseconds per level] [max delay us] [interface address]
+
+#include <cstdio>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "BenchmarkUtil.hpp"
+#include "CoalescingSender.hpp"
+#include "IoEngine.hpp"
+#include "TrackMessageDispatcher.hpp"
+#include "TrackPublisher.hpp"
+
+namespace {
+
+enum class Mode { Immediate, Fixed, Adaptive };
+
+const char* modeName(Mode mode) {
+    switch (mode) {
+        case Mode::Immediate:
+            return "immediate";
+        case Mode::Fixed:
+            return "fixed";
+        case Mode::Adaptive:
+        default:
+            return "adaptive";
+    }
+}
+
+void runLevel(Mode mode, long rate, double seconds, long maxDelayUs, const std::string& interfaceAddress) {
+    std::unique_ptr<IoEngine> receiverEngine = IoEngine::create(IoEngineKind::Epoll);
+    std::unique_ptr<IoEngine> senderEngine = IoEngine::create(IoEngineKind::Epoll);
+
+    std::vector<int64_t> latencies;
+    const long messages = static_cast<long>(static_cast<double>(rate) * seconds);
+    latencies.reserve(static_cast<std::size_t>(messages));
+    TrackMessageDispatcher dispatcher;
+    dispatcher.subscribe<ExtrapTrackData>([&latencies](const ExtrapTrackData& message) {
+        latencies.push_back(bench::nowNs() - message.getFirstHopSentTime());
+    });
+    uint64_t datagrams = 0U;
+    receiverEngine->setHandler([&dispatcher, &datagrams](const ReceivedDatagram& datagram) {
+        ++datagrams;
+        (void)dispatcher.dispatch(datagram.data, datagram.size);
+    });
+    (void)receiverEngine->addReceiver(makeEndpointConfig<ExtrapTrackData>(interfaceAddress));
+
+    TrackPublisher publisher(*senderEngine);
+    CoalescingSender::Options options;
+    options.maxDelay = std::chrono::microseconds(maxDelayUs);
+    options.adaptive = (mode == Mode::Adaptive);
+    CoalescingSender coalescer(*senderEngine, options);
+    if (mode == Mode::Immediate) {
+        publisher.advertise<ExtrapTrackData>(interfaceAddress);
+    } else {
+        coalescer.advertise<ExtrapTrackData>(interfaceAddress);
+    }
+
+    ExtrapTrackData message;
+    const int64_t period = 1000000000LL / rate;
+    const int64_t start = bench::nowNs();
+    for (long i = 0; i < messages; ++i) {
+        const int64_t target = start + (i * period);
+        int64_t now = bench::nowNs();
+        while (now < target) {
+            (void)coalescer.poll(now);
+            (void)receiverEngine->poll(0);
+            now = bench::nowNs();
+        }
+        message.setTrackId(static_cast<uint32_t>(i % 1000));
+        message.setFirstHopSentTime(now);
+        if (mode == Mode::Immediate) {
+            (void)publisher.publish(message);
+        } else {
+            (void)coalescer.publish(message);
+        }
+        (void)receiverEngine->poll(0);
+    }
+    // Let the last batches reach their deadline instead of forcing them out
+    while (coalescer.nextDeadlineNs() != INT64_MAX) {
+        (void)coalescer.poll();
+        (void)receiverEngine->poll(0);
+    }
+    while (receiverEngine->poll(20) > 0U) {
+    }
+    const int64_t elapsed = bench::nowNs() - start;
+
+    char label[48];
+    (void)std::snprintf(label, sizeof(label), "%-9s %7ld/s", modeName(mode), rate);
+    std::printf("%s achieved %8.0f/s  datagrams %7llu  records/dgram %5.1f\n", label,
+                static_cast<double>(messages) * 1e9 / static_cast<double>(elapsed),
+                static_cast<unsigned long long>(datagrams),
+                (datagrams > 0U) ? static_cast<double>(latencies.size()) / static_cast<double>(datagrams) : 0.0);
+    bench::printPercentiles("  latency", latencies);
+}
+
+}  // namespace
+
+int main(int argc, char** argv) {
+    const double seconds = static_cast<double>(bench::argOrDefault(argc, argv, 1, 500)) / 1000.0;
+    const long maxDelayUs = bench::argOrDefault(argc, argv, 2, 200);
+    const std::string interfaceAddress = (argc > 3) ? argv[3] : "127.0.0.1";
+
+    std::printf("=== Coalescing sender sweep: %.2f s per level, max delay %ld us ===\n", seconds, maxDelayUs);
+    try {
+        for (const long rate : {1000L, 10000L, 50000L, 200000L, 1000000L}) {
+            for (const Mode mode : {Mode::Immediate, Mode::Fixed, Mode::Adaptive}) {
+                runLevel(mode, rate, seconds, maxDelayUs, interfaceAddress);
+            }
+        }
+    } catch (const std::exception& e) {
+        std::fprintf(stderr, "Hata: %s\n", e.what());
+        return 1;
+    }
+    return 0;
+}
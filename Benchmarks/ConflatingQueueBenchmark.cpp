@@ -0,0 +1,123 @@
+// ConflatingQueue under a feed much faster than its consumer.
+// Part 1 measures push/pop cost on one thread. Part 2 runs a producer
+// thread publishing ProcessedTrackData for a fixed set of tracks against a
+// dashboard-style consumer that spends a fixed time per update; updateTime
+// carries the push time (CLOCK_MONOTONIC) and the consumer records the age
+// of the state it reads.
+//
+// Usage: conflating_queue_benchmark [updates] [tracks] [consumer ns per update]
+
+#include <atomic>
+#include <cstdio>
+#include <thread>
+#include <vector>
+
+#include "BenchmarkUtil.hpp"
+#include "ConflatingQueue.hpp"
+#include "ProcessedTrackData.hpp"
+
+namespace {
+
+void spinFor(int64_t ns) {
+    const int64_t until = bench::nowNs() + ns;
+    while (bench::nowNs() < until) {
+    }
+}
+
+void measureOperations(long updates, long tracks) {
+    ConflatingQueue<ProcessedTrackData> queue(static_cast<std::size_t>(tracks));
+    ProcessedTrackData message;
+    const int64_t pushStart = bench::nowNs();
+    for (long i = 0; i < updates; ++i) {
+        message.setTrackId(i % tracks);
+        message.setUpdateTime(i);
+        (void)queue.push(message);
+    }
+    const int64_t pushNs = bench::nowNs() - pushStart;
+
+    ProcessedTrackData out;
+    long popped = 0;
+    const int64_t popStart = bench::nowNs();
+    while (queue.pop(out)) {
+        bench::doNotOptimize(out);
+        ++popped;
+    }
+    const int64_t popNs = bench::nowNs() - popStart;
+    std::printf("push %.1f ns/op (%llu queued, %llu conflated), pop %.1f ns/op (%ld tracks)\n",
+                static_cast<double>(pushNs) / static_cast<double>(updates),
+                static_cast<unsigned long long>(queue.getQueuedCount()),
+                static_cast<unsigned long long>(queue.getConflatedCount()),
+                static_cast<double>(popNs) / static_cast<double>(popped), popped);
+}
+
+void runSlowConsumer(long updates, long tracks, long consumerNs) {
+    ConflatingQueue<ProcessedTrackData> queue(static_cast<std::size_t>(tracks));
+    std::atomic<bool> done{false};
+    std::vector<int64_t> ages;
+    ages.reserve(static_cast<std::size_t>(updates));
+    std::vector<int64_t> lastSeen(static_cast<std::size_t>(tracks), -1);
+    uint64_t reordered = 0U;
+
+    std::thread consumer([&]() {
+        ProcessedTrackData update;
+        while (true) {
+            const bool finished = done.load(std::memory_order_acquire);
+            if (!queue.pop(update)) {
+                if (finished) {
+                    break;
+                }
+                std::this_thread::yield();
+                continue;
+            }
+            ages.push_back(bench::nowNs() - update.getUpdateTime());
+            int64_t& last = lastSeen[static_cast<std::size_t>(update.getTrackId())];
+            if (update.getUpdateTime() <= last) {
+                ++reordered;
+            }
+            last = update.getUpdateTime();
+            spinFor(consumerNs);
+        }
+    });
+
+    ProcessedTrackData message;
+    const int64_t start = bench::nowNs();
+    for (long i = 0; i < updates; ++i) {
+        message.setTrackId(i % tracks);
+        message.setUpdateTime(bench::nowNs());
+        (void)queue.push(message);
+        if ((i % 256) == 255) {
+            // Lets the consumer run when both threads share one CPU
+            std::this_thread::yield();
+        }
+    }
+    done.store(true, std::memory_order_release);
+    consumer.join();
+    const double seconds = static_cast<double>(bench::nowNs() - start) / 1e9;
+
+    std::printf("updates %ld, delivered %zu (%.1f%%), conflated %llu, rejected %llu, reordered %llu, %.2fs, "
+                "queue capacity %zu tracks\n",
+                updates, ages.size(), 100.0 * static_cast<double>(ages.size()) / static_cast<double>(updates),
+                static_cast<unsigned long long>(queue.getConflatedCount()),
+                static_cast<unsigned long long>(queue.getRejectedCount()),
+                static_cast<unsigned long long>(reordered), seconds, queue.capacity());
+    bench::printPercentiles("state age", ages);
+}
+
+}  // namespace
+
+int main(int argc, char** argv) {
+    const long updates = bench::argOrDefault(argc, argv, 1, 2000000);
+    const long tracks = bench::argOrDefault(argc, argv, 2, 10000);
+    const long consumerNs = bench::argOrDefault(argc, argv, 3, 5000);
+
+    std::printf("=== ConflatingQueue: %ld updates over %ld tracks, consumer %ld ns/update ===\n", updates, tracks,
+                consumerNs);
+    try {
+        measureOperations(updates, tracks);
+        runSlowConsumer(updates, tracks, consumerNs);
+    } catch (const std::exception& e) {
+        std::fprintf(stderr, "Hata: %s\n", e.what());
+        return 1;
+    }
+    return 0;
+}
@@ -0,0 +1,135 @@
+// Traffic reduction and receiver-side error of dead-reckoning suppression.
+// Simulates straight, accelerating (4 m/s^2) and turning (3 g) tracks
+// updated at a fixed rate, offers every update to a DeadReckoningFilter
+// and tracks what a receiver dead-reckoning from the last published state
+// would show. Per threshold: share of updates published, RMS and max
+// position error at update instants, and the cost of shouldPublish() plus
+// commit() of the published updates.
+//
+// Usage: dead_reckoning_simulation [tracks per scenario] [seconds] [update rate Hz] [heartbeat ms]
+
+#include <algorithm>
+#include <cmath>
+#include <cstdio>
+#include <random>
+#include <vector>
+
+#include "BenchmarkUtil.hpp"
+#include "DeadReckoningFilter.hpp"
+
+namespace {
+
+enum class Scenario { Straight, Accelerating, Turning };
+
+const char* scenarioName(Scenario scenario) {
+    switch (scenario) {
+        case Scenario::Straight:
+            return "straight";
+        case Scenario::Accelerating:
+            return "accel";
+        case Scenario::Turning:
+        default:
+            return "turn";
+    }
+}
+
+struct Track {
+    Scenario scenario;
+    double speed;
+    double heading;
+
+    void fill(uint32_t trackId, double t, ExtrapTrackData& message) const {
+        double y = 0.0;
+        double z = 0.0;
+        double vy = 0.0;
+        double vz = 0.0;
+        if (scenario == Scenario::Turning) {
+            const double omega = (3.0 * 9.81) / speed;
+            const double radius = speed / omega;
+            const double angle = heading + (omega * t);
+            y = radius * (std::sin(angle) - std::sin(heading));
+            z = -radius * (std::cos(angle) - std::cos(heading));
+            vy = speed * std::cos(angle);
+            vz = speed * std::sin(angle);
+        } else {
+            const double acceleration = (scenario == Scenario::Accelerating) ? 4.0 : 0.0;
+            const double along = (speed * t) + (0.5 * acceleration * t * t);
+            const double alongSpeed = speed + (acceleration * t);
+            y = along * std::cos(heading);
+            z = along * std::sin(heading);
+            vy = alongSpeed * std::cos(heading);
+            vz = alongSpeed * std::sin(heading);
+        }
+        message.setTrackId(trackId);
+        message.setXPositionECEF(4.0e6);
+        message.setYPositionECEF(1.0e6 + y);
+        message.setZPositionECEF(4.8e6 + z);
+        message.setXVelocityECEF(0.0F);
+        message.setYVelocityECEF(vy);
+        message.setZVelocityECEF(vz);
+        message.setUpdateTime(static_cast<int64_t>(t * 1e9));
+    }
+};
+
+}  // namespace
+
+int main(int argc, char** argv) {
+    const long tracks = bench::argOrDefault(argc, argv, 1, 1000);
+    const long seconds = bench::argOrDefault(argc, argv, 2, 60);
+    const long rate = bench::argOrDefault(argc, argv, 3, 10);
+    const long heartbeatMs = bench::argOrDefault(argc, argv, 4, 5000);
+    const long steps = seconds * rate;
+
+    std::printf("=== Dead reckoning: %ld tracks/scenario, %ld s at %ld Hz, heartbeat %ld ms ===\n", tracks, seconds,
+                rate, heartbeatMs);
+    std::printf("%-9s %10s %12s %12s %12s %12s\n", "scenario", "threshold", "published", "reduction", "rms err m",
+                "max err m");
+
+    std::mt19937_64 random(5U);
+    std::uniform_real_distribution<double> headings(0.0, 6.283185307179586);
+    std::uniform_real_distribution<double> speeds(150.0, 300.0);
+    double totalNs = 0.0;
+    double totalCalls = 0.0;
+    for (const Scenario scenario : {Scenario::Straight, Scenario::Accelerating, Scenario::Turning}) {
+        std::vector<Track> population;
+        for (long i = 0; i < tracks; ++i) {
+            population.push_back(Track{scenario, speeds(random), headings(random)});
+        }
+        for (const double threshold : {1.0, 5.0, 10.0, 25.0, 50.0}) {
+            DeadReckoningOptions options;
+            options.thresholdMeters = threshold;
+            options.heartbeat = std::chrono::milliseconds(heartbeatMs);
+            options.maxTracks = static_cast<std::size_t>(tracks);
+            DeadReckoningFilter filter(options);
+
+            ExtrapTrackData message;
+            double squared = 0.0;
+            double worst = 0.0;
+            int64_t filterNs = 0;
+            for (long step = 0; step < steps; ++step) {
+                const double t = static_cast<double>(step) / static_cast<double>(rate);
+                for (long i = 0; i < tracks; ++i) {
+                    population[static_cast<std::size_t>(i)].fill(static_cast<uint32_t>(i + 1), t, message);
+                    const double implied = filter.impliedError(message);
+                    const int64_t start = bench::nowNs();
+                    const bool publish = filter.shouldPublish(message);
+                    if (publish) {
+                        filter.commit(message);
+                    }
+                    filterNs += bench::nowNs() - start;
+                    const double error = (publish || (implied < 0.0)) ? 0.0 : implied;
+                    squared += error * error;
+                    worst = std::max(worst, error);
+                }
+            }
+            totalNs += static_cast<double>(filterNs);
+            totalCalls += static_cast<double>(filter.getOfferedCount());
+            const double offered = static_cast<double>(filter.getOfferedCount());
+            const double published = static_cast<double>(filter.getPublishedCount());
+            std::printf("%-9s %10.1f %12.0f %11.1f%% %12.3f %12.3f\n", scenarioName(scenario), threshold, published,
+                        100.0 * (1.0 - (published / offered)), std::sqrt(squared / offered), worst);
+        }
+    }
+    std::printf("shouldPublish() + commit(): %.1f ns per update (including clock reads)\n", totalNs / totalCalls);
+    return 0;
+}
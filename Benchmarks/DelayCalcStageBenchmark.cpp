@@ -0,0 +1,163 @@
+// Throughput of the first-hop delay stage (ExtrapTrackData -> DelayCalcTrackData).
+// Part 1 feeds DelayCalcStage::process() from memory into an engine that
+// only counts bytes, over several batch sizes, with 1% of the records
+// carrying a trackId outside 1..9999. Part 2 runs the real hop on
+// loopback: publishBatch() sends ExtrapTrackData to a timestamping
+// receiver, the stage converts it and republishes DelayCalcTrackData,
+// which the same receiver decodes. It reports the end-to-end rate and the
+// measured firstHopDelayTime percentiles.
+//
+// Usage: delay_calc_stage_benchmark [messages] [interface address]
+
+#include <cstdio>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "BenchmarkUtil.hpp"
+#include "DelayCalcStage.hpp"
+#include "IoEngine.hpp"
+
+namespace {
+
+/// Engine that accepts every datagram without sending it
+class CountingEngine final : public IoEngine {
+public:
+    std::size_t addReceiver(const EndpointConfig&) override { return 0U; }
+    std::size_t addSender(const EndpointConfig&) override { return 0U; }
+    bool send(std::size_t, const uint8_t*, std::size_t size) override {
+        bytes_ += size;
+        return true;
+    }
+    bool sendv(std::size_t, const iovec* vectors, std::size_t count) override {
+        for (std::size_t i = 0U; i < count; ++i) {
+            bytes_ += vectors[i].iov_len;
+        }
+        return true;
+    }
+    void flush() override {}
+    bool readTransmitTimestamp(std::size_t, TransmitTimestamp&) override { return false; }
+    std::size_t poll(int) override { return 0U; }
+    [[nodiscard]] const char* name() const noexcept override { return "counting"; }
+
+private:
+    uint64_t bytes_{0U};
+};
+
+std::vector<ExtrapTrackData> makeMessages(std::size_t count, int64_t sentNs) {
+    std::vector<ExtrapTrackData> messages(count);
+    for (std::size_t i = 0U; i < count; ++i) {
+        ExtrapTrackData& message = messages[i];
+        // Every 100th id is outside the DelayCalcTrackData domain
+        message.setTrackId(((i % 100U) == 99U) ? 20000U + static_cast<uint32_t>(i)
+                                               : 1U + static_cast<uint32_t>(i % 9999U));
+        message.setXPositionECEF(4.0e6 + static_cast<double>(i));
+        message.setYPositionECEF(1.0e6);
+        message.setZPositionECEF(4.5e6);
+        message.setXVelocityECEF(200.0F);
+        message.setYVelocityECEF(-50.0);
+        message.setZVelocityECEF(10.0);
+        message.setUpdateTime(sentNs);
+        message.setOriginalUpdateTime(sentNs);
+        message.setFirstHopSentTime(sentNs);
+    }
+    return messages;
+}
+
+void measureProcess(std::size_t total) {
+    const std::vector<ExtrapTrackData> messages = makeMessages(4096U, TscClock::realtimeNs());
+    std::printf("%10s %12s %12s %12s\n", "batch", "ns/record", "Mrec/s", "rejected");
+    for (const std::size_t batch : {16U, 64U, 256U, 1024U}) {
+        CountingEngine engine;
+        TrackPublisher publisher(engine);
+        publisher.advertise<DelayCalcTrackData>();
+        DelayCalcStageOptions options;
+        options.batchSize = batch;
+        DelayCalcStage stage(publisher, nullptr, options);
+        const int64_t receiveNs = TscClock::realtimeNs();
+        const int64_t start = bench::nowNs();
+        for (std::size_t done = 0U; done < total; done += messages.size()) {
+            bench::doNotOptimize(stage.process(messages.data(), messages.size(), receiveNs));
+        }
+        (void)stage.flush();
+        const double elapsed = static_cast<double>(bench::nowNs() - start);
+        const double processed = static_cast<double>(stage.getProcessedCount());
+        std::printf("%10zu %12.2f %12.2f %12llu\n", batch, elapsed / processed, processed / elapsed * 1e3,
+                    static_cast<unsigned long long>(stage.getRejectedTrackIdCount()));
+    }
+}
+
+void measureLoopback(std::size_t total, const std::string& address) {
+    std::unique_ptr<IoEngine> sourceEngine = IoEngine::create(IoEngineKind::Epoll);
+    std::unique_ptr<IoEngine> stageEngine = IoEngine::create(IoEngineKind::Epoll);
+    std::unique_ptr<IoEngine> receiverEngine = IoEngine::create(IoEngineKind::Epoll);
+
+    EndpointConfig extrapConfig = makeEndpointConfig<ExtrapTrackData>(address);
+    extrapConfig.timestamping = TimestampingMode::Software;
+    TrackPublisher source(*sourceEngine);
+    source.advertise<ExtrapTrackData>(extrapConfig);
+    TrackPublisher stagePublisher(*stageEngine);
+    stagePublisher.advertise<DelayCalcTrackData>(address);
+
+    TscClock clock;
+    DelayCalcStage stage(stagePublisher, &clock);
+    TrackMessageDispatcher dispatcher;
+    stage.attach(dispatcher);
+    std::vector<int64_t> delays;
+    delays.reserve(total);
+    dispatcher.subscribe<DelayCalcTrackData>([&delays](const DelayCalcTrackData& message) {
+        delays.push_back(message.getFirstHopDelayTime());
+    });
+    receiverEngine->setHandler([&dispatcher](const ReceivedDatagram& d) {
+        (void)dispatcher.dispatch(d.data, d.size, d.timestamps);
+    });
+    (void)receiverEngine->addReceiver(extrapConfig);
+    (void)receiverEngine->addReceiver(makeEndpointConfig<DelayCalcTrackData>(address));
+
+    // Small bursts keep the loopback socket buffers from overflowing
+    constexpr std::size_t BURST = 64U;
+    std::vector<ExtrapTrackData> burst = makeMessages(BURST, 0);
+    for (std::size_t i = 0U; i < BURST; ++i) {
+        burst[i].setTrackId(1U + static_cast<uint32_t>(i));
+    }
+    const int64_t start = bench::nowNs();
+    for (std::size_t sent = 0U; sent < total; sent += BURST) {
+        const int64_t sentNs = clock.nowNs();
+        for (ExtrapTrackData& message : burst) {
+            message.setFirstHopSentTime(sentNs);
+        }
+        (void)source.publishBatch(burst.data(), burst.size());
+        while (receiverEngine->poll(0) > 0U) {
+            (void)stage.flush();
+        }
+        (void)stage.flush();
+    }
+    while (receiverEngine->poll(100) > 0U) {
+        (void)stage.flush();
+    }
+    const double elapsed = static_cast<double>(bench::nowNs() - start);
+    std::printf("Loopback: %zu sent, %llu converted, %zu received back, %.2f Mrec/s, kernel stamped %llu, "
+                "clock skew %llu\n",
+                total, static_cast<unsigned long long>(stage.getPublishedCount()), delays.size(),
+                static_cast<double>(delays.size()) / elapsed * 1e3,
+                static_cast<unsigned long long>(stage.getKernelStampedCount()),
+                static_cast<unsigned long long>(stage.getClockSkewCount()));
+    bench::printPercentiles("firstHopDelayTime", delays);
+}
+
+}  // namespace
+
+int main(int argc, char** argv) {
+    const std::size_t total = static_cast<std::size_t>(bench::argOrDefault(argc, argv, 1, 1000000));
+    const std::string address = (argc > 2) ? argv[2] : "127.0.0.1";
+
+    std::printf("=== Delay calculation stage, %zu records ===\n", total);
+    try {
+        measureProcess(total);
+        measureLoopback(total, address);
+    } catch (const std::exception& e) {
+        std::fprintf(stderr, "Hata: %s\n", e.what());
+        return 1;
+    }
+    return 0;
+}
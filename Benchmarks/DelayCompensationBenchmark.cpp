@@ -0,0 +1,88 @@
+// Cost and effect of delay-compensated FinalCalcTrackData.
+// Part 1 times DelayCompensator::compensate() per message over several
+// batch sizes. Part 2 sends turning (3 g, 250 m/s) tracks with measured
+// delays of 1..200 ms and compares the position error at receive time
+// with and without compensation.
+//
+// Usage: delay_compensation_benchmark [messages]
+
+#include <algorithm>
+#include <cmath>
+#include <cstdio>
+#include <vector>
+
+#include "BenchmarkUtil.hpp"
+#include "DelayCompensator.hpp"
+
+namespace {
+
+constexpr double SPEED = 250.0;
+constexpr double OMEGA = (3.0 * 9.81) / SPEED;
+constexpr double RADIUS = SPEED / OMEGA;
+
+/// True state of the turning track t seconds into the turn
+void turnAt(double t, FinalCalcTrackData& message) {
+    const double angle = OMEGA * t;
+    message.setXPositionECEF(4.0e6);
+    message.setYPositionECEF(1.0e6 + (RADIUS * std::sin(angle)));
+    message.setZPositionECEF(4.8e6 - (RADIUS * (std::cos(angle) - 1.0)));
+    message.setXVelocityECEF(0.0);
+    message.setYVelocityECEF(SPEED * std::cos(angle));
+    message.setZVelocityECEF(SPEED * std::sin(angle));
+    message.setUpdateTime(static_cast<int64_t>(t * 1e9));
+}
+
+double distance(const FinalCalcTrackData& a, const FinalCalcTrackData& b) {
+    const double dx = a.getXPositionECEF() - b.getXPositionECEF();
+    const double dy = a.getYPositionECEF() - b.getYPositionECEF();
+    const double dz = a.getZPositionECEF() - b.getZPositionECEF();
+    return std::sqrt((dx * dx) + (dy * dy) + (dz * dz));
+}
+
+}  // namespace
+
+int main(int argc, char** argv) {
+    const std::size_t total = static_cast<std::size_t>(bench::argOrDefault(argc, argv, 1, 1000000));
+
+    std::printf("=== Delay compensation, %s kernel ===\n", simdLevelName(ExtrapolationEngine::detectSimdLevel()));
+    std::printf("%10s %14s\n", "batch", "ns/message");
+    for (const std::size_t batch : {1U, 16U, 256U, 4096U, 65536U}) {
+        std::vector<FinalCalcTrackData> messages(batch);
+        for (std::size_t i = 0U; i < batch; ++i) {
+            turnAt(static_cast<double>(i) * 0.01, messages[i]);
+            messages[i].setTotalDelayTime(static_cast<int64_t>(1000000U + (i % 50U) * 1000000U));
+        }
+        DelayCompensator compensator;
+        const std::size_t rounds = std::max<std::size_t>(1U, total / batch);
+        int64_t elapsed = 0;
+        for (std::size_t round = 0U; round < rounds; ++round) {
+            std::vector<FinalCalcTrackData> work = messages;
+            const int64_t start = bench::nowNs();
+            bench::doNotOptimize(compensator.compensate(work.data(), work.size()));
+            elapsed += bench::nowNs() - start;
+        }
+        std::printf("%10zu %14.2f\n", batch, static_cast<double>(elapsed) / static_cast<double>(rounds * batch));
+    }
+
+    std::printf("\n%10s %16s %16s\n", "delay ms", "raw error m", "compensated m");
+    DelayCompensator compensator;
+    for (const long delayMs : {1L, 5L, 20L, 50L, 100L, 200L}) {
+        double raw = 0.0;
+        double compensated = 0.0;
+        const int samples = 1000;
+        for (int i = 0; i < samples; ++i) {
+            const double sent = static_cast<double>(i) * 0.05;
+            const double received = sent + (static_cast<double>(delayMs) / 1000.0);
+            FinalCalcTrackData message;
+            turnAt(sent, message);
+            message.setTotalDelayTime(delayMs * 1000000L);
+            FinalCalcTrackData truth;
+            turnAt(received, truth);
+            raw = std::max(raw, distance(message, truth));
+            (void)compensator.compensate(&message, 1U);
+            compensated = std::max(compensated, distance(message, truth));
+        }
+        std::printf("%10ld %16.3f %16.3f\n", delayMs, raw, compensated);
+    }
+    return 0;
+}
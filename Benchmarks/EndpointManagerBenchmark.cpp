@@ -0,0 +1,145 @@
+// One EndpointManager event loop serving every registry service versus one
+// receiver thread per message type. Each type has two handlers, which share
+// the type's socket. Reports sockets opened, delivered records, and receiver
+// CPU time per record. The type lists come from ServiceTypes, so every
+// registry service is subscribed and published.
+//
+// Usage: endpoint_manager_benchmark [messages per type] [interface address]
+
+#include <atomic>
+#include <cstdio>
+#include <string>
+#include <thread>
+#include <tuple>
+#include <vector>
+
+#include "BenchmarkUtil.hpp"
+#include "EndpointManager.hpp"
+
+namespace {
+
+constexpr int IDLE_TIMEOUT_MS = 300;
+
+struct Result {
+    uint64_t handled{0U};
+    std::size_t sockets{0U};
+    int64_t cpuNs{0};
+};
+
+template <typename T>
+void subscribeTwice(EndpointManager& manager, std::atomic<uint64_t>& handled) {
+    manager.subscribe<T>([&handled](const T&) { handled.fetch_add(1U, std::memory_order_relaxed); });
+    manager.subscribe<T>([&handled](const T&) { handled.fetch_add(1U, std::memory_order_relaxed); });
+}
+
+void drain(EndpointManager& manager) {
+    while (manager.poll(IDLE_TIMEOUT_MS) > 0U) {
+    }
+}
+
+template <typename T>
+void receiveOneType(const std::string& interfaceAddress, std::atomic<uint64_t>& handled, std::atomic<int>& ready,
+                    std::atomic<int64_t>& cpuNs) {
+    EndpointManager manager(IoEngineKind::Auto, interfaceAddress);
+    subscribeTwice<T>(manager, handled);
+    const int64_t cpuStart = bench::threadCpuNs();
+    ready.fetch_add(1, std::memory_order_acq_rel);
+    drain(manager);
+    cpuNs.fetch_add(bench::threadCpuNs() - cpuStart);
+}
+
+/// Expands ServiceTypes into per-type subscribe and receiver calls
+template <typename Types>
+struct EachService;
+
+template <typename... Types>
+struct EachService<std::tuple<Types...>> {
+    static void subscribeAll(EndpointManager& manager, std::atomic<uint64_t>& handled) {
+        (subscribeTwice<Types>(manager, handled), ...);
+    }
+
+    static void spawnReceivers(std::vector<std::thread>& receivers, const std::string& interfaceAddress,
+                               std::atomic<uint64_t>& handled, std::atomic<int>& ready, std::atomic<int64_t>& cpuNs) {
+        (receivers.emplace_back([&]() { receiveOneType<Types>(interfaceAddress, handled, ready, cpuNs); }), ...);
+    }
+};
+
+void publishAll(const std::string& interfaceAddress, long messagesPerType, std::atomic<int>& readyReceivers,
+                int expectedReceivers) {
+    while (readyReceivers.load(std::memory_order_acquire) < expectedReceivers) {
+        std::this_thread::yield();
+    }
+    EndpointManager manager(IoEngineKind::Epoll, interfaceAddress);
+    const ServiceTypes messages{};
+    for (long i = 0; i < messagesPerType; ++i) {
+        std::apply([&manager](const auto&... message) { ((void)manager.publish(message), ...); }, messages);
+        if ((i % 16) == 15) {
+            std::this_thread::yield();
+        }
+    }
+}
+
+Result runMultiplexed(const std::string& interfaceAddress, long messagesPerType) {
+    Result result;
+    std::atomic<uint64_t> handled{0U};
+    std::atomic<int> ready{0};
+    std::thread receiver([&]() {
+        EndpointManager manager(IoEngineKind::Auto, interfaceAddress);
+        EachService<ServiceTypes>::subscribeAll(manager, handled);
+        result.sockets = manager.getReceiverCount();
+        const int64_t cpuStart = bench::threadCpuNs();
+        ready.store(1, std::memory_order_release);
+        drain(manager);
+        result.cpuNs = bench::threadCpuNs() - cpuStart;
+    });
+    publishAll(interfaceAddress, messagesPerType, ready, 1);
+    receiver.join();
+    result.handled = handled.load();
+    return result;
+}
+
+Result runThreadPerType(const std::string& interfaceAddress, long messagesPerType) {
+    Result result;
+    std::atomic<uint64_t> handled{0U};
+    std::atomic<int> ready{0};
+    std::atomic<int64_t> cpuNs{0};
+    std::vector<std::thread> receivers;
+    EachService<ServiceTypes>::spawnReceivers(receivers, interfaceAddress, handled, ready, cpuNs);
+    publishAll(interfaceAddress, messagesPerType, ready, static_cast<int>(receivers.size()));
+    for (std::thread& receiver : receivers) {
+        receiver.join();
+    }
+    result.handled = handled.load();
+    result.sockets = receivers.size();
+    result.cpuNs = cpuNs.load();
+    return result;
+}
+
+void print(const char* label, const Result& result, long messagesPerType) {
+    const uint64_t expected = static_cast<uint64_t>(messagesPerType) * SERVICE_COUNT * 2U;
+    std::printf("%-16s sockets %zu  handled %llu/%llu  receiver cpu %.0f ns/record\n", label, result.sockets,
+                static_cast<unsigned long long>(result.handled), static_cast<unsigned long long>(expected),
+                (result.handled > 0U) ? static_cast<double>(result.cpuNs) * 2.0 / static_cast<double>(result.handled)
+                                      : 0.0);
+}
+
+}  // namespace
+
+int main(int argc, char** argv) {
+    const long messagesPerType = bench::argOrDefault(argc, argv, 1, 50000);
+    const std::string interfaceAddress = (argc > 2) ? argv[2] : "127.0.0.1";
+
+    std::printf("=== EndpointManager: %ld messages x %zu services, 2 handlers each ===\n", messagesPerType,
+                SERVICE_COUNT);
+    for (const ServiceDescriptor& service : SERVICE_REGISTRY) {
+        std::printf("  %-24s %s:%d\n", service.name, service.multicastAddress, service.port);
+    }
+    try {
+        print("single loop", runMultiplexed(interfaceAddress, messagesPerType), messagesPerType);
+        print("thread per type", runThreadPerType(interfaceAddress, messagesPerType), messagesPerType);
+    } catch (const std::exception& e) {
+        std::fprintf(stderr, "Hata: %s\n", e.what());
+        return 1;
+    }
+    return 0;
+}
@@ -0,0 +1,166 @@
+// Accuracy versus cost of the history-based extrapolation models.
+// Simulates straight, accelerating and turning (3 g coordinated turn)
+// tracks reported every update period with Gaussian position and
+// velocity noise, fills a full TrackHistoryRing per track and predicts the
+// state at several horizons past the newest report. Prints RMS and max
+// position error per model, scenario and horizon, then the cost of one
+// predict() call per model.
+//
+// Usage: extrapolation_accuracy_benchmark [tracks per scenario] [update period ms] [position noise m] [velocity noise m/s]
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <cstdio>
+#include <random>
+#include <vector>
+
+#include "BenchmarkUtil.hpp"
+#include "HistoryExtrapolator.hpp"
+
+namespace {
+
+enum class Scenario { Straight, Accelerating, Turning };
+
+const char* scenarioName(Scenario scenario) {
+    switch (scenario) {
+        case Scenario::Straight:
+            return "straight";
+        case Scenario::Accelerating:
+            return "accel";
+        case Scenario::Turning:
+        default:
+            return "turn";
+    }
+}
+
+struct Truth {
+    Scenario scenario;
+    std::array<double, 3> origin;
+    double speed;
+    double heading;
+
+    /// Exact state t seconds after the track started
+    void at(double t, std::array<double, 3>& position, std::array<double, 3>& velocity) const {
+        double along = speed * t;
+        double alongSpeed = speed;
+        double ux = std::cos(heading);
+        double uy = std::sin(heading);
+        if (scenario == Scenario::Accelerating) {
+            along += 0.5 * 4.0 * t * t;
+            alongSpeed += 4.0 * t;
+        }
+        if (scenario == Scenario::Turning) {
+            const double omega = (3.0 * 9.81) / speed;
+            const double radius = speed / omega;
+            const double angle = heading + (omega * t);
+            position = {origin[0], origin[1] + (radius * (std::sin(angle) - std::sin(heading))),
+                        origin[2] - (radius * (std::cos(angle) - std::cos(heading)))};
+            velocity = {0.0, speed * std::cos(angle), speed * std::sin(angle)};
+            return;
+        }
+        position = {origin[0], origin[1] + (along * ux), origin[2] + (along * uy)};
+        velocity = {0.0, alongSpeed * ux, alongSpeed * uy};
+    }
+};
+
+struct Model {
+    const char* label;
+    ExtrapolatorOptions options;
+};
+
+}  // namespace
+
+int main(int argc, char** argv) {
+    const long tracks = bench::argOrDefault(argc, argv, 1, 2000);
+    const double period = static_cast<double>(bench::argOrDefault(argc, argv, 2, 1000)) / 1000.0;
+    const double positionNoise = static_cast<double>(bench::argOrDefault(argc, argv, 3, 5));
+    const double velocityNoise = static_cast<double>(bench::argOrDefault(argc, argv, 4, 1));
+    const std::array<double, 5> horizons = {0.1, 0.5, 1.0, 2.0, 4.0};
+
+    const std::array<Model, 5> models = {{
+        {"cv", {ExtrapolationModel::ConstantVelocity, 2U, 6U}},
+        {"ca", {ExtrapolationModel::ConstantAcceleration, 2U, 6U}},
+        {"poly1/6", {ExtrapolationModel::Polynomial, 1U, 6U}},
+        {"poly2/6", {ExtrapolationModel::Polynomial, 2U, 6U}},
+        {"poly3/8", {ExtrapolationModel::Polynomial, 3U, 8U}},
+    }};
+
+    std::printf("=== History extrapolation: %ld tracks/scenario, updates every %.0f ms, noise %.1f m / %.1f m/s ===\n",
+                tracks, period * 1000.0, positionNoise, velocityNoise);
+    std::printf("%-9s %-9s", "scenario", "model");
+    for (const double horizon : horizons) {
+        std::printf("   rms@%.1fs   max@%.1fs", horizon, horizon);
+    }
+    std::printf("\n");
+
+    std::mt19937_64 random(11U);
+    std::normal_distribution<double> positionError(0.0, positionNoise);
+    std::normal_distribution<double> velocityError(0.0, velocityNoise);
+    std::uniform_real_distribution<double> headings(0.0, 6.283185307179586);
+    std::uniform_real_distribution<double> speeds(150.0, 300.0);
+
+    std::vector<TrackHistoryRing> histories;
+    for (const Scenario scenario : {Scenario::Straight, Scenario::Accelerating, Scenario::Turning}) {
+        std::vector<Truth> truths;
+        histories.assign(static_cast<std::size_t>(tracks), TrackHistoryRing{});
+        for (long track = 0; track < tracks; ++track) {
+            truths.push_back(Truth{scenario, {6.4e6, 0.0, 0.0}, speeds(random), headings(random)});
+            for (std::size_t k = 0U; k < TrackHistoryRing::CAPACITY; ++k) {
+                TrackSample sample;
+                sample.time = static_cast<int64_t>(static_cast<double>(k) * period * 1e9);
+                truths.back().at(static_cast<double>(k) * period, sample.position, sample.velocity);
+                for (std::size_t axis = 0U; axis < 3U; ++axis) {
+                    sample.position[axis] += positionError(random);
+                    sample.velocity[axis] += velocityError(random);
+                }
+                (void)histories[static_cast<std::size_t>(track)].push(sample);
+            }
+        }
+        const double now = static_cast<double>(TrackHistoryRing::CAPACITY - 1U) * period;
+
+        for (const Model& model : models) {
+            const HistoryExtrapolator extrapolator(model.options);
+            std::printf("%-9s %-9s", scenarioName(scenario), model.label);
+            for (const double horizon : horizons) {
+                double squared = 0.0;
+                double worst = 0.0;
+                for (long track = 0; track < tracks; ++track) {
+                    std::array<double, 3> truePosition{};
+                    std::array<double, 3> trueVelocity{};
+                    truths[static_cast<std::size_t>(track)].at(now + horizon, truePosition, trueVelocity);
+                    std::array<double, 3> position{};
+                    std::array<double, 3> velocity{};
+                    (void)extrapolator.predict(histories[static_cast<std::size_t>(track)],
+                                               static_cast<int64_t>((now + horizon) * 1e9), position, velocity);
+                    const double error = std::sqrt(((position[0] - truePosition[0]) * (position[0] - truePosition[0])) +
+                                                   ((position[1] - truePosition[1]) * (position[1] - truePosition[1])) +
+                                                   ((position[2] - truePosition[2]) * (position[2] - truePosition[2])));
+                    squared += error * error;
+                    worst = std::max(worst, error);
+                }
+                std::printf(" %10.2f %10.2f", std::sqrt(squared / static_cast<double>(tracks)), worst);
+            }
+            std::printf("\n");
+        }
+    }
+
+    std::printf("Cost per predict()\n");
+    const int64_t target = static_cast<int64_t>((static_cast<double>(TrackHistoryRing::CAPACITY) * period) * 1e9);
+    for (const Model& model : models) {
+        const HistoryExtrapolator extrapolator(model.options);
+        std::array<double, 3> position{};
+        std::array<double, 3> velocity{};
+        const long rounds = 200;
+        const int64_t start = bench::nowNs();
+        for (long round = 0; round < rounds; ++round) {
+            for (const TrackHistoryRing& history : histories) {
+                (void)extrapolator.predict(history, target + round, position, velocity);
+                bench::doNotOptimize(position[1]);
+            }
+        }
+        const double calls = static_cast<double>(rounds) * static_cast<double>(histories.size());
+        std::printf("  %-9s %8.1f ns\n", model.label, static_cast<double>(bench::nowNs() - start) / calls);
+    }
+    return 0;
+}
@@ -0,0 +1,95 @@
+// Constant-velocity extrapolation of ProcessedTrackData columns.
+// Times one ExtrapolationEngine::extrapolate() call over the whole track
+// set per kernel the CPU supports, reports ns per track and the memory
+// bandwidth it implies (7 input + 3 output columns of 8 bytes), and checks
+// every kernel against the scalar one. Finally times toMessage(), the
+// per-row conversion to ExtrapTrackData.
+//
+// Usage: extrapolation_benchmark [tracks] [calls]
+
+#include <algorithm>
+#include <cmath>
+#include <cstdio>
+#include <random>
+#include <vector>
+
+#include "BenchmarkUtil.hpp"
+#include "ExtrapolationEngine.hpp"
+
+namespace {
+
+TrackColumns makeTracks(std::size_t count) {
+    std::mt19937_64 random(7U);
+    std::uniform_real_distribution<double> position(-7.0e6, 7.0e6);
+    std::uniform_real_distribution<double> velocity(-800.0, 800.0);
+    std::uniform_int_distribution<int64_t> age(0, 2000000000);
+    TrackColumns tracks;
+    tracks.resize(count);
+    for (std::size_t i = 0U; i < count; ++i) {
+        tracks.trackId[i] = static_cast<int64_t>(i + 1U);
+        tracks.xPosition[i] = position(random);
+        tracks.yPosition[i] = position(random);
+        tracks.zPosition[i] = position(random);
+        tracks.xVelocity[i] = velocity(random);
+        tracks.yVelocity[i] = velocity(random);
+        tracks.zVelocity[i] = velocity(random);
+        tracks.updateTime[i] = 1700000000000000000LL - age(random);
+    }
+    return tracks;
+}
+
+double maxDifference(const PositionColumns& a, const PositionColumns& b) {
+    double worst = 0.0;
+    for (std::size_t i = 0U; i < a.size(); ++i) {
+        worst = std::max({worst, std::fabs(a.x[i] - b.x[i]), std::fabs(a.y[i] - b.y[i]), std::fabs(a.z[i] - b.z[i])});
+    }
+    return worst;
+}
+
+}  // namespace
+
+int main(int argc, char** argv) {
+    const std::size_t count = static_cast<std::size_t>(bench::argOrDefault(argc, argv, 1, 1000000));
+    const long calls = bench::argOrDefault(argc, argv, 2, 50);
+    const TrackColumns tracks = makeTracks(count);
+    const int64_t target = 1700000000000000000LL + 20000000LL;
+
+    std::printf("=== Extrapolation of %zu tracks, %ld calls per kernel (detected %s) ===\n", count, calls,
+                simdLevelName(ExtrapolationEngine::detectSimdLevel()));
+    std::printf("%-8s %12s %10s %10s %14s\n", "kernel", "ms/call", "ns/track", "GB/s", "max diff m");
+
+    PositionColumns reference;
+    ExtrapolationEngine(SimdLevel::Scalar).extrapolate(tracks, target, reference);
+    for (const SimdLevel level : {SimdLevel::Scalar, SimdLevel::Avx2, SimdLevel::Avx512}) {
+        if (!ExtrapolationEngine::isSupported(level)) {
+            std::printf("%-8s unsupported\n", simdLevelName(level));
+            continue;
+        }
+        const ExtrapolationEngine engine(level);
+        PositionColumns positions;
+        engine.extrapolate(tracks, target, positions);
+        int64_t best = INT64_MAX;
+        for (long call = 0; call < calls; ++call) {
+            const int64_t start = bench::nowNs();
+            engine.extrapolate(tracks, target + call, positions);
+            best = std::min(best, bench::nowNs() - start);
+            bench::doNotOptimize(positions.x[count / 2U]);
+        }
+        engine.extrapolate(tracks, target, positions);
+        const double bytes = static_cast<double>(count) * 10.0 * 8.0;
+        std::printf("%-8s %12.3f %10.3f %10.2f %14.3g\n", simdLevelName(level), static_cast<double>(best) / 1e6,
+                    static_cast<double>(best) / static_cast<double>(count), bytes / static_cast<double>(best),
+                    maxDifference(positions, reference));
+    }
+
+    ExtrapTrackData message;
+    std::size_t converted = 0U;
+    const int64_t start = bench::nowNs();
+    for (std::size_t i = 0U; i < count; ++i) {
+        converted += ExtrapolationEngine::toMessage(tracks, reference, i, target, message) ? 1U : 0U;
+    }
+    const int64_t elapsed = bench::nowNs() - start;
+    std::printf("toMessage %8.2f ns/track, %zu/%zu converted\n",
+                static_cast<double>(elapsed) / static_cast<double>(count), converted, count);
+    return 0;
+}
@@ -0,0 +1,209 @@
+// Loss recovery and CPU cost of XOR / Reed-Solomon parity on track groups.
+// Datagrams and their parity are built in memory with the publisher's
+// encoding, random datagrams (data and parity alike) are dropped with a
+// fixed probability, and the survivors go through a TrackMessageDispatcher
+// with FEC enabled. Every delivered record is checked against the
+// datagram index it was built from, so a wrong reconstruction counts as
+// corrupt rather than recovered. Reports residual loss, recovery rate,
+// bandwidth overhead and the encode / receive cost per data datagram.
+//
+// Usage: fec_benchmark [datagrams] [loss per mille list: 10,50,100] [seed]
+
+#include <cstdio>
+#include <cstdlib>
+#include <random>
+#include <string>
+#include <vector>
+
+#include "BenchmarkUtil.hpp"
+#include "ExtrapTrackData.hpp"
+#include "FinalCalcTrackData.hpp"
+#include "ForwardErrorCorrection.hpp"
+#include "TrackMessageDispatcher.hpp"
+#include "TrackPublisher.hpp"
+
+namespace {
+
+struct Config {
+    const char* label;
+    FecOptions options;
+};
+
+struct Settings {
+    long datagrams{200000};
+    std::vector<long> lossPerMille{10, 50, 100};
+    unsigned seed{1U};
+};
+
+template <typename T>
+void fill(T& message, long i);
+
+template <>
+void fill(ExtrapTrackData& message, long i) {
+    message.setTrackId(static_cast<uint32_t>(i % 5000));
+    message.setUpdateTime(i);
+    message.setXPositionECEF(static_cast<double>(i));
+}
+
+template <>
+void fill(FinalCalcTrackData& message, long i) {
+    message.setTrackId(static_cast<int64_t>(i % 5000));
+    message.setUpdateTime(i);
+    message.setXPositionECEF(static_cast<double>(i));
+}
+
+/// True when message carries exactly what fill() wrote for some index below count
+template <typename T>
+bool matchesFill(const T& message, long count) {
+    const long index = static_cast<long>(message.getUpdateTime());
+    return (index >= 0) && (index < count) && (message.getXPositionECEF() == static_cast<double>(index)) &&
+           (static_cast<long>(message.getTrackId()) == (index % 5000));
+}
+
+template <typename T>
+void run(const Settings& settings, const Config& config, long lossPerMille) {
+    const std::string group = TrackMessageTraits<T>::GROUP;
+    std::vector<std::vector<uint8_t>> wire;
+    wire.reserve(static_cast<std::size_t>(settings.datagrams) * 2U);
+    std::vector<bool> isData;
+    isData.reserve(wire.capacity());
+
+    std::vector<std::vector<uint8_t>> data(static_cast<std::size_t>(settings.datagrams));
+    T message;
+    for (long i = 0; i < settings.datagrams; ++i) {
+        fill(message, i);
+        TrackPublisher::encode(message, static_cast<uint64_t>(i), data[static_cast<std::size_t>(i)]);
+    }
+
+    // Only the parity work is timed; serialization is the same for every scheme
+    std::unique_ptr<FecEncoder> encoder;
+    if (config.options.scheme != FecScheme::None) {
+        encoder = std::make_unique<FecEncoder>(config.options);
+    }
+    std::vector<std::vector<uint8_t>> parities;
+    std::vector<std::size_t> parityAfter;
+    std::vector<uint8_t> framed;
+    const int64_t encodeStart = bench::nowNs();
+    for (long i = 0; (i < settings.datagrams) && encoder; ++i) {
+        const std::vector<uint8_t>& datagram = data[static_cast<std::size_t>(i)];
+        const std::size_t bodyOffset = 1U + datagram[0];
+        if (encoder->add(static_cast<uint64_t>(i), &datagram[bodyOffset], datagram.size() - bodyOffset)) {
+            for (const std::vector<uint8_t>& parity : encoder->getParityBodies()) {
+                RadioDishFrame::encode(group, parity.data(), parity.size(), framed);
+                parities.push_back(framed);
+                parityAfter.push_back(static_cast<std::size_t>(i));
+            }
+        }
+    }
+    const int64_t encodeNs = bench::nowNs() - encodeStart;
+
+    // Wire order: each window's parity right after its last data datagram
+    std::size_t nextParity = 0U;
+    for (long i = 0; i < settings.datagrams; ++i) {
+        wire.push_back(data[static_cast<std::size_t>(i)]);
+        isData.push_back(true);
+        while ((nextParity < parities.size()) && (parityAfter[nextParity] == static_cast<std::size_t>(i))) {
+            wire.push_back(parities[nextParity]);
+            isData.push_back(false);
+            ++nextParity;
+        }
+    }
+
+    std::mt19937 random(settings.seed);
+    std::uniform_int_distribution<long> perMille(0, 999);
+    std::vector<bool> dropped(wire.size());
+    uint64_t lostData = 0U;
+    std::size_t wireBytes = 0U;
+    std::size_t dataBytes = 0U;
+    for (std::size_t i = 0U; i < wire.size(); ++i) {
+        dropped[i] = perMille(random) < lossPerMille;
+        lostData += (dropped[i] && isData[i]) ? 1U : 0U;
+        wireBytes += wire[i].size();
+        dataBytes += isData[i] ? wire[i].size() : 0U;
+    }
+
+    uint64_t delivered = 0U;
+    uint64_t corrupt = 0U;
+    TrackMessageDispatcher dispatcher;
+    dispatcher.subscribe<T>([&delivered, &corrupt, &settings](const T& received) {
+        if (matchesFill(received, settings.datagrams)) {
+            ++delivered;
+        } else {
+            ++corrupt;
+        }
+    });
+    if (encoder) {
+        dispatcher.enableFec<T>();
+    }
+    const int64_t start = bench::nowNs();
+    for (std::size_t i = 0U; i < wire.size(); ++i) {
+        if (!dropped[i]) {
+            (void)dispatcher.dispatch(wire[i].data(), wire[i].size());
+        }
+    }
+    const int64_t receiveNs = bench::nowNs() - start;
+
+    const uint64_t residual = static_cast<uint64_t>(settings.datagrams) - delivered;
+    const uint64_t recovered = lostData - residual;
+    const double datagrams = static_cast<double>(settings.datagrams);
+    std::printf("%-18s %-12s %6.1f%% %9llu %9llu %8llu %8.2f%% %9.1f%% %8.1f%% %10.1f %10.1f\n",
+                group.c_str(), config.label, static_cast<double>(lossPerMille) / 10.0,
+                static_cast<unsigned long long>(lostData), static_cast<unsigned long long>(recovered),
+                static_cast<unsigned long long>(corrupt),
+                100.0 * static_cast<double>(residual) / datagrams,
+                (lostData > 0U) ? (100.0 * static_cast<double>(recovered) / static_cast<double>(lostData)) : 100.0,
+                100.0 * static_cast<double>(wireBytes - dataBytes) / static_cast<double>(dataBytes),
+                static_cast<double>(encodeNs) / datagrams, static_cast<double>(receiveNs) / datagrams);
+}
+
+template <typename T>
+void runAll(const Settings& settings, const std::vector<Config>& configs) {
+    for (const long loss : settings.lossPerMille) {
+        for (const Config& config : configs) {
+            run<T>(settings, config, loss);
+        }
+    }
+}
+
+std::vector<long> parseList(const char* text) {
+    std::vector<long> values;
+    char* end = nullptr;
+    for (const char* cursor = text; *cursor != '\0'; cursor = (*end == ',') ? end + 1 : end) {
+        values.push_back(std::strtol(cursor, &end, 10));
+        if (end == cursor) {
+            break;
+        }
+    }
+    return values;
+}
+
+}  // namespace
+
+int main(int argc, char** argv) {
+    Settings settings;
+    settings.datagrams = bench::argOrDefault(argc, argv, 1, 200000);
+    if (argc > 2) {
+        settings.lossPerMille = parseList(argv[2]);
+    }
+    settings.seed = static_cast<unsigned>(bench::argOrDefault(argc, argv, 3, 1));
+
+    const std::vector<Config> configs = {
+        {"none", FecOptions{FecScheme::None, 0U, 0U}},
+        {"xor 8+1", FecOptions{FecScheme::Xor, 8U, 1U}},
+        {"rs 8+2", FecOptions{FecScheme::ReedSolomon, 8U, 2U}},
+        {"rs 16+4", FecOptions{FecScheme::ReedSolomon, 16U, 4U}},
+    };
+
+    std::printf("=== FEC: %ld datagrams per run, independent random loss, seed %u ===\n", settings.datagrams,
+                settings.seed);
+    std::printf("%-18s %-12s %7s %9s %9s %8s %9s %10s %9s %10s %10s\n", "group", "scheme", "loss", "lost",
+                "recovered", "corrupt", "residual", "recovery", "overhead", "enc ns/dg", "rx ns/dg");
+    try {
+        runAll<ExtrapTrackData>(settings, configs);
+        runAll<FinalCalcTrackData>(settings, configs);
+    } catch (const std::exception& e) {
+        std::fprintf(stderr, "Hata: %s\n", e.what());
+        return 1;
+    }
+    return 0;
+}
@@ -0,0 +1,228 @@
+// End-to-end cost of the processing chain
+//   ExtrapTrackData -> DelayCalcStage -> DelayCalcTrackData -> FinalCalcStage -> FinalCalcTrackData
+// Part 1 times FinalCalcStage::process() from memory into an engine that
+// only counts bytes, with and without delay compensation. Part 2 runs the
+// whole chain on loopback with each stage on its own pinned thread and
+// kernel receive timestamps. The source keeps a bounded number of records
+// in flight, and the sink reports the rate and the per-hop and total
+// delay percentiles carried in the FinalCalcTrackData it receives.
+//
+// Usage: final_calc_stage_benchmark [messages] [first cpu] [interface address]
+
+#include <atomic>
+#include <cstdio>
+#include <memory>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "BenchmarkUtil.hpp"
+#include "DelayCalcStage.hpp"
+#include "FinalCalcStage.hpp"
+#include "IoEngine.hpp"
+#include "ThreadTuning.hpp"
+
+namespace {
+
+/// Engine that accepts every datagram without sending it
+class CountingEngine final : public IoEngine {
+public:
+    std::size_t addReceiver(const EndpointConfig&) override { return 0U; }
+    std::size_t addSender(const EndpointConfig&) override { return 0U; }
+    bool send(std::size_t, const uint8_t*, std::size_t size) override {
+        bytes_ += size;
+        return true;
+    }
+    bool sendv(std::size_t, const iovec* vectors, std::size_t count) override {
+        for (std::size_t i = 0U; i < count; ++i) {
+            bytes_ += vectors[i].iov_len;
+        }
+        return true;
+    }
+    void flush() override {}
+    bool readTransmitTimestamp(std::size_t, TransmitTimestamp&) override { return false; }
+    std::size_t poll(int) override { return 0U; }
+    [[nodiscard]] const char* name() const noexcept override { return "counting"; }
+
+private:
+    uint64_t bytes_{0U};
+};
+
+void measureProcess(std::size_t total) {
+    const int64_t now = TscClock::realtimeNs();
+    std::vector<DelayCalcTrackData> messages(4096U);
+    for (std::size_t i = 0U; i < messages.size(); ++i) {
+        DelayCalcTrackData& message = messages[i];
+        message.setTrackId(static_cast<uint16_t>(1U + (i % 9999U)));
+        message.setXPositionECEF(4.0e6 + static_cast<double>(i));
+        message.setYPositionECEF(1.0e6);
+        message.setZPositionECEF(4.5e6);
+        message.setXVelocityECEF(200.0F);
+        message.setYVelocityECEF(-50.0);
+        message.setZVelocityECEF(10.0);
+        message.setUpdateTime(now - 3000000);
+        message.setFirstHopSentTime(now - 2000000);
+        message.setFirstHopDelayTime(1000000);
+        message.setSecondHopSentTime(now - 500000);
+    }
+    std::printf("%14s %12s %12s\n", "compensation", "ns/record", "Mrec/s");
+    for (const bool compensate : {false, true}) {
+        CountingEngine engine;
+        TrackPublisher publisher(engine);
+        publisher.advertise<FinalCalcTrackData>();
+        FinalCalcStageOptions options;
+        options.compensateDelay = compensate;
+        FinalCalcStage stage(publisher, nullptr, options);
+        const int64_t start = bench::nowNs();
+        for (std::size_t done = 0U; done < total; done += messages.size()) {
+            bench::doNotOptimize(stage.process(messages.data(), messages.size(), now));
+        }
+        (void)stage.flush();
+        const double elapsed = static_cast<double>(bench::nowNs() - start);
+        const double processed = static_cast<double>(stage.getProcessedCount());
+        std::printf("%14s %12.2f %12.2f\n", compensate ? "on" : "off", elapsed / processed,
+                    processed / elapsed * 1e3);
+    }
+}
+
+/// Polls engine on a pinned thread until stop, flushing the stage after every poll
+template <typename Stage>
+std::thread runStage(IoEngine& engine, Stage& stage, int cpu, const std::atomic<bool>& stop) {
+    return std::thread([&engine, &stage, cpu, &stop]() {
+        ThreadTuning tuning;
+        tuning.cpu = cpu;
+        (void)tuning.apply();
+        while (!stop.load(std::memory_order_relaxed)) {
+            (void)engine.poll(0);
+            (void)stage.flush();
+        }
+    });
+}
+
+void measureLoopback(std::size_t total, int firstCpu, const std::string& address) {
+    const int cpuCount = static_cast<int>(std::thread::hardware_concurrency());
+    std::unique_ptr<IoEngine> sourceEngine = IoEngine::create(IoEngineKind::Epoll);
+    std::unique_ptr<IoEngine> delayEngine = IoEngine::create(IoEngineKind::Epoll);
+    std::unique_ptr<IoEngine> finalEngine = IoEngine::create(IoEngineKind::Epoll);
+    std::unique_ptr<IoEngine> sinkEngine = IoEngine::create(IoEngineKind::Epoll);
+
+    EndpointConfig extrapConfig = makeEndpointConfig<ExtrapTrackData>(address);
+    extrapConfig.timestamping = TimestampingMode::Software;
+    EndpointConfig delayConfig = makeEndpointConfig<DelayCalcTrackData>(address);
+    delayConfig.timestamping = TimestampingMode::Software;
+
+    TscClock clock;
+    TrackPublisher source(*sourceEngine);
+    source.advertise<ExtrapTrackData>(extrapConfig);
+
+    TrackPublisher delayPublisher(*delayEngine);
+    delayPublisher.advertise<DelayCalcTrackData>(delayConfig);
+    DelayCalcStage delayStage(delayPublisher, &clock);
+    TrackMessageDispatcher delayDispatcher;
+    delayStage.attach(delayDispatcher);
+    delayEngine->setHandler([&delayDispatcher](const ReceivedDatagram& d) {
+        (void)delayDispatcher.dispatch(d.data, d.size, d.timestamps);
+    });
+    (void)delayEngine->addReceiver(extrapConfig);
+
+    TrackPublisher finalPublisher(*finalEngine);
+    finalPublisher.advertise<FinalCalcTrackData>(address);
+    FinalCalcStage finalStage(finalPublisher, &clock);
+    TrackMessageDispatcher finalDispatcher;
+    finalStage.attach(finalDispatcher);
+    finalEngine->setHandler([&finalDispatcher](const ReceivedDatagram& d) {
+        (void)finalDispatcher.dispatch(d.data, d.size, d.timestamps);
+    });
+    (void)finalEngine->addReceiver(delayConfig);
+
+    std::vector<int64_t> firstHop;
+    std::vector<int64_t> secondHop;
+    std::vector<int64_t> totalDelay;
+    firstHop.reserve(total);
+    secondHop.reserve(total);
+    totalDelay.reserve(total);
+    TrackMessageDispatcher sinkDispatcher;
+    sinkDispatcher.subscribe<FinalCalcTrackData>([&](const FinalCalcTrackData& message) {
+        firstHop.push_back(message.getFirstHopDelayTime());
+        secondHop.push_back(message.getSecondHopDelayTime());
+        totalDelay.push_back(message.getTotalDelayTime());
+    });
+    sinkEngine->setHandler([&sinkDispatcher](const ReceivedDatagram& d) {
+        (void)sinkDispatcher.dispatch(d.data, d.size, d.timestamps);
+    });
+    (void)sinkEngine->addReceiver(makeEndpointConfig<FinalCalcTrackData>(address));
+
+    std::atomic<bool> stop{false};
+    std::thread delayThread = runStage(*delayEngine, delayStage, firstCpu % cpuCount, stop);
+    std::thread finalThread = runStage(*finalEngine, finalStage, (firstCpu + 1) % cpuCount, stop);
+    (void)ThreadTuning::pinCurrentThread((firstCpu + 2) % cpuCount);
+
+    constexpr std::size_t BURST = 32U;
+    constexpr std::size_t IN_FLIGHT = 512U;
+    std::vector<ExtrapTrackData> burst(BURST);
+    for (std::size_t i = 0U; i < BURST; ++i) {
+        burst[i].setTrackId(1U + static_cast<uint32_t>(i));
+        burst[i].setXPositionECEF(4.0e6);
+        burst[i].setYPositionECEF(1.0e6);
+        burst[i].setZPositionECEF(4.5e6);
+        burst[i].setXVelocityECEF(200.0F);
+    }
+    const int64_t start = bench::nowNs();
+    std::size_t sent = 0U;
+    std::size_t lost = 0U;
+    int64_t lastProgress = start;
+    std::size_t lastReceived = 0U;
+    while ((totalDelay.size() + lost) < total) {
+        if ((sent < total) && ((sent - totalDelay.size() - lost) < IN_FLIGHT)) {
+            const int64_t sentNs = clock.nowNs();
+            for (ExtrapTrackData& message : burst) {
+                message.setUpdateTime(sentNs);
+                message.setFirstHopSentTime(sentNs);
+            }
+            (void)source.publishBatch(burst.data(), burst.size());
+            sent += BURST;
+        }
+        (void)sinkEngine->poll(0);
+        const int64_t now = bench::nowNs();
+        if (totalDelay.size() != lastReceived) {
+            lastReceived = totalDelay.size();
+            lastProgress = now;
+        } else if ((now - lastProgress) > 200000000LL) {
+            // Datagrams lost on the way: stop waiting for them
+            lost = sent - totalDelay.size();
+            lastProgress = now;
+        }
+    }
+    const double elapsed = static_cast<double>(bench::nowNs() - start);
+    stop.store(true, std::memory_order_relaxed);
+    delayThread.join();
+    finalThread.join();
+
+    std::printf("Loopback chain: %zu sent, %zu received, %zu lost, %.2f Mrec/s, negative hops %llu/%llu, kernel stamped %llu/%llu\n",
+                sent, totalDelay.size(), lost, static_cast<double>(totalDelay.size()) / elapsed * 1e3,
+                static_cast<unsigned long long>(finalStage.getNegativeFirstHopCount()),
+                static_cast<unsigned long long>(finalStage.getNegativeSecondHopCount()),
+                static_cast<unsigned long long>(delayStage.getKernelStampedCount()),
+                static_cast<unsigned long long>(finalStage.getKernelStampedCount()));
+    bench::printPercentiles("first hop", firstHop);
+    bench::printPercentiles("second hop", secondHop);
+    bench::printPercentiles("total", totalDelay);
+}
+
+}  // namespace
+
+int main(int argc, char** argv) {
+    const std::size_t total = static_cast<std::size_t>(bench::argOrDefault(argc, argv, 1, 1000000));
+    const int firstCpu = static_cast<int>(bench::argOrDefault(argc, argv, 2, 1));
+    const std::string address = (argc > 3) ? argv[3] : "127.0.0.1";
+
+    std::printf("=== Final calculation stage, %zu records ===\n", total);
+    try {
+        measureProcess(total);
+        measureLoopback(total, firstCpu, address);
+    } catch (const std::exception& e) {
+        std::fprintf(stderr, "Hata: %s\n", e.what());
+        return 1;
+    }
+    return 0;
+}
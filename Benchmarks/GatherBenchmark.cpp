@@ -0,0 +1,190 @@
+// Contiguous versus gathered sends of TrackStatics batches.
+// "copy" is the pre-gather path: serialize() every record into its own
+// vector and append it behind the header of one contiguous datagram.
+// "batch" is TrackPublisher::publishBatch(): records are serialized in place
+// and the header goes out as a separate iovec. "serialized" is
+// publishSerialized() over records the caller already holds, one iovec per
+// record. Part 1 sends to an engine that only gathers into a socket-sized
+// buffer (what the kernel does) to isolate user-space cost; part 2 repeats
+// the run over loopback with the epoll engine and checks every record
+// arrives.
+//
+// Usage: gather_benchmark [batches] [records per batch] [checksums 0/1] [interface address]
+
+#include <cstdio>
+#include <cstring>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "BenchmarkUtil.hpp"
+#include "IoEngine.hpp"
+#include "MessageEnvelope.hpp"
+#include "RadioDishFrame.hpp"
+#include "TrackMessageDispatcher.hpp"
+#include "TrackPublisher.hpp"
+
+namespace {
+
+/// Engine whose sends only gather into one buffer, standing in for the kernel copy
+class GatherOnlyEngine final : public IoEngine {
+public:
+    std::size_t addReceiver(const EndpointConfig&) override { return 0U; }
+    std::size_t addSender(const EndpointConfig&) override { return 0U; }
+    bool send(std::size_t, const uint8_t* data, std::size_t size) override {
+        std::memcpy(sink_.data(), data, size);
+        bench::doNotOptimize(sink_[0]);
+        return true;
+    }
+    bool sendv(std::size_t, const iovec* vectors, std::size_t count) override {
+        std::size_t offset = 0U;
+        for (std::size_t i = 0U; i < count; ++i) {
+            std::memcpy(&sink_[offset], vectors[i].iov_base, vectors[i].iov_len);
+            offset += vectors[i].iov_len;
+        }
+        bench::doNotOptimize(sink_[0]);
+        return true;
+    }
+    void flush() override {}
+    bool readTransmitTimestamp(std::size_t, TransmitTimestamp&) override { return false; }
+    std::size_t poll(int) override { return 0U; }
+    [[nodiscard]] const char* name() const noexcept override { return "gather-only"; }
+
+private:
+    std::vector<uint8_t> sink_ = std::vector<uint8_t>(65536U);
+};
+
+enum class Mode { Copy, Batch, Serialized };
+
+const char* modeName(Mode mode) {
+    switch (mode) {
+        case Mode::Copy:
+            return "copy";
+        case Mode::Batch:
+            return "batch";
+        case Mode::Serialized:
+        default:
+            return "serialized";
+    }
+}
+
+std::vector<TrackStatics> makeRecords(std::size_t count) {
+    std::vector<TrackStatics> records(count);
+    for (std::size_t i = 0U; i < count; ++i) {
+        records[i].setTrackId(static_cast<int64_t>(i + 1U));
+        records[i].setFirstHopDelayDataMean(1.5 * static_cast<double>(i));
+        records[i].setUpdateTime(static_cast<int64_t>(i) * 1000);
+    }
+    return records;
+}
+
+/// The pre-gather path: one temporary vector per record, then a copy into the datagram
+bool sendCopied(IoEngine& engine, std::size_t endpoint, const std::vector<TrackStatics>& records, uint64_t sequence,
+                bool checksums, std::vector<uint8_t>& datagram) {
+    RadioDishFrame::beginFrame(TrackMessageTraits<TrackStatics>::GROUP, datagram);
+    MessageEnvelope envelope;
+    envelope.recordCount = static_cast<uint16_t>(records.size());
+    envelope.sequence = sequence;
+    envelope.flags = checksums ? MessageEnvelope::FLAG_CHECKSUM : 0U;
+    const std::size_t offset = datagram.size();
+    datagram.resize(offset + MessageEnvelope::SIZE);
+    envelope.encode(&datagram[offset]);
+    for (const TrackStatics& record : records) {
+        const std::vector<uint8_t> bytes = checksums ? record.serializeWithChecksum() : record.serialize();
+        datagram.insert(datagram.end(), bytes.begin(), bytes.end());
+    }
+    return engine.send(endpoint, datagram.data(), datagram.size());
+}
+
+/// Sends batches batches of records in mode; returns ns per batch
+double runMode(Mode mode, IoEngine& engine, long batches, const std::vector<TrackStatics>& records, bool checksums,
+               const std::string& interfaceAddress, IoEngine* receiver) {
+    TrackPublisher publisher(engine);
+    publisher.advertise<TrackStatics>(interfaceAddress);
+    publisher.enableChecksum<TrackStatics>(checksums);
+    const std::size_t endpoint = 0U;
+
+    std::vector<std::vector<uint8_t>> held;
+    std::vector<const uint8_t*> pointers;
+    for (const TrackStatics& record : records) {
+        held.push_back(record.serialize());
+        pointers.push_back(held.back().data());
+    }
+    std::vector<uint8_t> datagram;
+    datagram.reserve(65536U);
+
+    const int64_t start = bench::nowNs();
+    for (long batch = 0; batch < batches; ++batch) {
+        switch (mode) {
+            case Mode::Copy:
+                (void)sendCopied(engine, endpoint, records, static_cast<uint64_t>(batch), checksums, datagram);
+                break;
+            case Mode::Batch:
+                (void)publisher.publishBatch(records.data(), records.size(), 65000U);
+                break;
+            case Mode::Serialized:
+            default:
+                (void)publisher.publishSerialized<TrackStatics>(pointers.data(), pointers.size());
+                break;
+        }
+        if (receiver != nullptr) {
+            (void)receiver->poll(0);
+        }
+    }
+    return static_cast<double>(bench::nowNs() - start) / static_cast<double>(batches);
+}
+
+void runLoopback(Mode mode, long batches, const std::vector<TrackStatics>& records, bool checksums,
+                 const std::string& interfaceAddress) {
+    std::unique_ptr<IoEngine> receiver = IoEngine::create(IoEngineKind::Epoll);
+    std::unique_ptr<IoEngine> sender = IoEngine::create(IoEngineKind::Epoll);
+    TrackMessageDispatcher dispatcher;
+    uint64_t received = 0U;
+    dispatcher.subscribe<TrackStatics>([&received](const TrackStatics&) { ++received; });
+    receiver->setHandler([&dispatcher](const ReceivedDatagram& datagram) {
+        (void)dispatcher.dispatch(datagram.data, datagram.size);
+    });
+    (void)receiver->addReceiver(makeEndpointConfig<TrackStatics>(interfaceAddress));
+
+    const double perBatch = runMode(mode, *sender, batches, records, checksums, interfaceAddress, receiver.get());
+    while (receiver->poll(20) > 0U) {
+    }
+    const uint64_t expected = static_cast<uint64_t>(batches) * records.size();
+    std::printf("  %-10s %10.1f ns/batch  received %llu/%llu records  checksum failures %llu\n", modeName(mode),
+                perBatch, static_cast<unsigned long long>(received), static_cast<unsigned long long>(expected),
+                static_cast<unsigned long long>(dispatcher.getChecksumFailureCount()));
+}
+
+}  // namespace
+
+int main(int argc, char** argv) {
+    const long batches = bench::argOrDefault(argc, argv, 1, 200000);
+    const std::size_t perBatch = static_cast<std::size_t>(bench::argOrDefault(argc, argv, 2, 64));
+    const bool checksums = bench::argOrDefault(argc, argv, 3, 0) != 0;
+    const std::string interfaceAddress = (argc > 4) ? argv[4] : "127.0.0.1";
+    if ((perBatch == 0U) || (perBatch > TrackPublisher::MAX_GATHER_RECORDS)) {
+        std::fprintf(stderr, "Hata: records per batch must be 1..%zu\n", TrackPublisher::MAX_GATHER_RECORDS);
+        return 1;
+    }
+    const std::vector<TrackStatics> records = makeRecords(perBatch);
+
+    std::printf("=== TrackStatics batches: %zu records x %zu bytes%s ===\n", perBatch,
+                records[0].getSerializedSize(), checksums ? " + CRC32C" : "");
+    try {
+        std::printf("User-space cost (gather-only engine)\n");
+        for (const Mode mode : {Mode::Copy, Mode::Batch, Mode::Serialized}) {
+            GatherOnlyEngine engine;
+            const double ns = runMode(mode, engine, batches, records, checksums, interfaceAddress, nullptr);
+            std::printf("  %-10s %10.1f ns/batch %8.2f ns/record\n", modeName(mode), ns,
+                        ns / static_cast<double>(perBatch));
+        }
+        std::printf("Loopback (epoll engine, %ld batches)\n", batches / 10);
+        for (const Mode mode : {Mode::Copy, Mode::Batch, Mode::Serialized}) {
+            runLoopback(mode, batches / 10, records, checksums, interfaceAddress);
+        }
+    } catch (const std::exception& e) {
+        std::fprintf(stderr, "Hata: %s\n", e.what());
+        return 1;
+    }
+    return 0;
+}
@@ -0,0 +1,175 @@
+// io_uring / epoll engine versus a plain blocking receive loop.
+// Receives all five track groups (ports 9595-9599) on loopback and reports
+// delivered messages, receiver CPU time per message and wall time.
+//
+// Usage: io_engine_benchmark [messages per group] [interface address]
+
+#include <atomic>
+#include <cstdio>
+#include <memory>
+#include <string>
+#include <sys/socket.h>
+#include <thread>
+#include <vector>
+
+#include "BenchmarkUtil.hpp"
+#include "IoEngine.hpp"
+#include "MulticastSocket.hpp"
+#include "TrackMessageDispatcher.hpp"
+#include "TrackPublisher.hpp"
+
+namespace {
+
+constexpr int IDLE_TIMEOUT_MS = 300;
+
+struct Result {
+    uint64_t received{0U};
+    int64_t cpuNs{0};
+    int64_t wallNs{0};
+};
+
+std::vector<EndpointConfig> trackEndpoints(const std::string& interfaceAddress) {
+    return {makeEndpointConfig<DelayCalcTrackData>(interfaceAddress),
+            makeEndpointConfig<ExtrapTrackData>(interfaceAddress),
+            makeEndpointConfig<FinalCalcTrackData>(interfaceAddress),
+            makeEndpointConfig<ProcessedTrackData>(interfaceAddress),
+            makeEndpointConfig<TrackStatics>(interfaceAddress)};
+}
+
+void subscribeAll(TrackMessageDispatcher& dispatcher, std::atomic<uint64_t>& decoded) {
+    dispatcher.subscribe<DelayCalcTrackData>([&decoded](const DelayCalcTrackData&) { decoded.fetch_add(1U, std::memory_order_relaxed); });
+    dispatcher.subscribe<ExtrapTrackData>([&decoded](const ExtrapTrackData&) { decoded.fetch_add(1U, std::memory_order_relaxed); });
+    dispatcher.subscribe<FinalCalcTrackData>([&decoded](const FinalCalcTrackData&) { decoded.fetch_add(1U, std::memory_order_relaxed); });
+    dispatcher.subscribe<ProcessedTrackData>([&decoded](const ProcessedTrackData&) { decoded.fetch_add(1U, std::memory_order_relaxed); });
+    dispatcher.subscribe<TrackStatics>([&decoded](const TrackStatics&) { decoded.fetch_add(1U, std::memory_order_relaxed); });
+}
+
+/// Sends messagesPerGroup records to every group, interleaved, in small bursts
+void publish(const std::string& interfaceAddress, long messagesPerGroup) {
+    std::unique_ptr<IoEngine> engine = IoEngine::create(IoEngineKind::Epoll);
+    TrackPublisher publisher(*engine);
+    publisher.advertise<DelayCalcTrackData>(interfaceAddress);
+    publisher.advertise<ExtrapTrackData>(interfaceAddress);
+    publisher.advertise<FinalCalcTrackData>(interfaceAddress);
+    publisher.advertise<ProcessedTrackData>(interfaceAddress);
+    publisher.advertise<TrackStatics>(interfaceAddress);
+
+    const DelayCalcTrackData delayCalc;
+    const ExtrapTrackData extrap;
+    const FinalCalcTrackData finalCalc;
+    const ProcessedTrackData processed;
+    const TrackStatics statics;
+    for (long i = 0; i < messagesPerGroup; ++i) {
+        (void)publisher.publish(delayCalc);
+        (void)publisher.publish(extrap);
+        (void)publisher.publish(finalCalc);
+        (void)publisher.publish(processed);
+        (void)publisher.publish(statics);
+        if ((i % 16) == 15) {
+            std::this_thread::yield();
+        }
+    }
+}
+
+Result runEngine(IoEngineKind kind, const std::vector<EndpointConfig>& endpoints, long messagesPerGroup) {
+    std::unique_ptr<IoEngine> engine = IoEngine::create(kind);
+    std::printf("%-10s", engine->name());
+
+    TrackMessageDispatcher dispatcher;
+    std::atomic<uint64_t> decoded{0U};
+    subscribeAll(dispatcher, decoded);
+    engine->setHandler([&dispatcher](const ReceivedDatagram& datagram) {
+        (void)dispatcher.dispatch(datagram.data, datagram.size);
+    });
+    for (const EndpointConfig& config : endpoints) {
+        (void)engine->addReceiver(config);
+    }
+
+    const uint64_t expected = static_cast<uint64_t>(messagesPerGroup) * endpoints.size();
+    const int64_t startWall = bench::nowNs();
+    const int64_t startCpu = bench::threadCpuNs();
+    std::thread sender(publish, endpoints.front().interfaceAddress, messagesPerGroup);
+    while (decoded.load(std::memory_order_relaxed) < expected) {
+        if (engine->poll(IDLE_TIMEOUT_MS) == 0U) {
+            break;
+        }
+    }
+    Result result;
+    result.cpuNs = bench::threadCpuNs() - startCpu;
+    result.wallNs = bench::nowNs() - startWall;
+    sender.join();
+    result.received = decoded.load();
+    return result;
+}
+
+/// Baseline: one thread per group doing blocking recv() and decoding
+Result runBlocking(const std::vector<EndpointConfig>& endpoints, long messagesPerGroup) {
+    std::printf("%-10s", "blocking");
+    std::atomic<uint64_t> decoded{0U};
+    std::atomic<int64_t> cpuNs{0};
+    std::vector<MulticastSocket> sockets;
+    for (const EndpointConfig& config : endpoints) {
+        sockets.push_back(MulticastSocket::openReceiver(config));
+        timeval timeout{0, IDLE_TIMEOUT_MS * 1000};
+        (void)setsockopt(sockets.back().fd(), SOL_SOCKET, SO_RCVTIMEO, &timeout, sizeof(timeout));
+    }
+
+    const int64_t startWall = bench::nowNs();
+    std::vector<std::thread> receivers;
+    for (MulticastSocket& socket : sockets) {
+        receivers.emplace_back([&socket, &decoded, &cpuNs, messagesPerGroup]() {
+            const int64_t startCpu = bench::threadCpuNs();
+            TrackMessageDispatcher dispatcher;
+            subscribeAll(dispatcher, decoded);
+            std::vector<uint8_t> buffer(65536U);
+            for (long i = 0; i < messagesPerGroup; ++i) {
+                const ssize_t size = socket.receive(buffer.data(), buffer.size());
+                if (size < 0) {
+                    break;
+                }
+                (void)dispatcher.dispatch(buffer.data(), static_cast<std::size_t>(size));
+            }
+            cpuNs.fetch_add(bench::threadCpuNs() - startCpu);
+        });
+    }
+    std::thread sender(publish, endpoints.front().interfaceAddress, messagesPerGroup);
+    sender.join();
+    for (std::thread& receiver : receivers) {
+        receiver.join();
+    }
+
+    Result result;
+    result.received = decoded.load();
+    result.cpuNs = cpuNs.load();
+    result.wallNs = bench::nowNs() - startWall;
+    return result;
+}
+
+void report(const Result& result, uint64_t expected) {
+    const double perMessage = (result.received > 0U)
+                                  ? static_cast<double>(result.cpuNs) / static_cast<double>(result.received)
+                                  : 0.0;
+    std::printf(" received %8llu/%-8llu  rx cpu %8.1f ns/msg  wall %8.1f ms\n",
+                static_cast<unsigned long long>(result.received), static_cast<unsigned long long>(expected),
+                perMessage, static_cast<double>(result.wallNs) / 1e6);
+}
+
+}  // namespace
+
+int main(int argc, char** argv) {
+    const long messagesPerGroup = bench::argOrDefault(argc, argv, 1, 20000);
+    const std::string interfaceAddress = (argc > 2) ? argv[2] : "127.0.0.1";
+    const std::vector<EndpointConfig> endpoints = trackEndpoints(interfaceAddress);
+    const uint64_t expected = static_cast<uint64_t>(messagesPerGroup) * endpoints.size();
+
+    std::printf("=== IoEngine benchmark: %ld messages x %zu groups ===\n", messagesPerGroup, endpoints.size());
+    try {
+        report(runBlocking(endpoints, messagesPerGroup), expected);
+        report(runEngine(IoEngineKind::Epoll, endpoints, messagesPerGroup), expected);
+        report(runEngine(IoEngineKind::Auto, endpoints, messagesPerGroup), expected);
+    } catch (const std::exception& e) {
+        std::fprintf(stderr, "Hata: %s\n", e.what());
+        return 1;
+    }
+    return 0;
+}
@@ -0,0 +1,152 @@
+// Receive latency distribution of blocking recv, epoll and busy-poll.
+// A paced sender stamps firstHopSentTime (CLOCK_MONOTONIC) into each
+// ExtrapTrackData; the receiver records now - firstHopSentTime.
+//
+// Usage: jitter_benchmark [messages] [rate msgs/s] [receiver cpu] [SCHED_FIFO priority] [SO_BUSY_POLL us]
+
+#include <atomic>
+#include <cstdio>
+#include <memory>
+#include <sys/socket.h>
+#include <thread>
+#include <vector>
+
+#include "BenchmarkUtil.hpp"
+#include "BusyPollEngine.hpp"
+#include "IoEngine.hpp"
+#include "ThreadTuning.hpp"
+#include "TrackMessageDispatcher.hpp"
+#include "TrackPublisher.hpp"
+
+namespace {
+
+const char* const INTERFACE_ADDRESS = "127.0.0.1";
+
+struct Settings {
+    long messages{20000};
+    long rate{10000};
+    ThreadTuning tuning;
+    int busyPollMicros{0};
+};
+
+void publishPaced(const Settings& settings, std::atomic<bool>& receiverReady) {
+    while (!receiverReady.load(std::memory_order_acquire)) {
+        std::this_thread::yield();
+    }
+    // Keep the sender off the receiver's CPU when there is another one
+    const int cpuCount = static_cast<int>(std::thread::hardware_concurrency());
+    if ((settings.tuning.cpu >= 0) && (cpuCount > 1)) {
+        (void)ThreadTuning::pinCurrentThread((settings.tuning.cpu + 1) % cpuCount);
+    }
+    std::unique_ptr<IoEngine> engine = IoEngine::create(IoEngineKind::Epoll);
+    TrackPublisher publisher(*engine);
+    publisher.advertise<ExtrapTrackData>(INTERFACE_ADDRESS);
+
+    ExtrapTrackData message;
+    message.setTrackId(1U);
+    const auto period = std::chrono::nanoseconds(1000000000LL / settings.rate);
+    auto next = std::chrono::steady_clock::now();
+    for (long i = 0; i < settings.messages; ++i) {
+        next += period;
+        std::this_thread::sleep_until(next);
+        message.setFirstHopSentTime(bench::nowNs());
+        (void)publisher.publish(message);
+    }
+}
+
+void recordLatency(std::vector<int64_t>& samples, const ExtrapTrackData& message) {
+    samples.push_back(bench::nowNs() - message.getFirstHopSentTime());
+}
+
+void runBlocking(const Settings& settings) {
+    std::vector<int64_t> samples;
+    samples.reserve(static_cast<std::size_t>(settings.messages));
+    std::atomic<bool> ready{false};
+
+    std::thread receiver([&settings, &samples, &ready]() {
+        (void)settings.tuning.apply();
+        MulticastSocket socket = MulticastSocket::openReceiver(makeEndpointConfig<ExtrapTrackData>(INTERFACE_ADDRESS));
+        timeval timeout{0, 500000};
+        (void)setsockopt(socket.fd(), SOL_SOCKET, SO_RCVTIMEO, &timeout, sizeof(timeout));
+        TrackMessageDispatcher dispatcher;
+        dispatcher.subscribe<ExtrapTrackData>([&samples](const ExtrapTrackData& m) { recordLatency(samples, m); });
+        std::vector<uint8_t> buffer(65536U);
+        ready.store(true, std::memory_order_release);
+        while (samples.size() < static_cast<std::size_t>(settings.messages)) {
+            const ssize_t size = socket.receive(buffer.data(), buffer.size());
+            if (size < 0) {
+                break;
+            }
+            (void)dispatcher.dispatch(buffer.data(), static_cast<std::size_t>(size));
+        }
+    });
+    publishPaced(settings, ready);
+    receiver.join();
+    bench::printPercentiles("blocking", samples);
+}
+
+void runEngine(const Settings& settings, IoEngineKind kind) {
+    std::vector<int64_t> samples;
+    samples.reserve(static_cast<std::size_t>(settings.messages));
+    std::atomic<bool> ready{false};
+    const char* label = "";
+
+    std::thread receiver([&settings, &samples, &ready, &label, kind]() {
+        const ThreadTuning::Result tuned = settings.tuning.apply();
+        std::unique_ptr<IoEngine> engine;
+        if (kind == IoEngineKind::BusyPoll) {
+            BusyPollEngine::Options options;
+            options.busyPollMicros = settings.busyPollMicros;
+            engine = std::make_unique<BusyPollEngine>(options);
+        } else {
+            engine = IoEngine::create(kind);
+        }
+        label = engine->name();
+        if ((settings.tuning.cpu >= 0 && !tuned.pinned) || (settings.tuning.realtimePriority > 0 && !tuned.realtime)) {
+            std::printf("(%s: pinning/SCHED_FIFO not permitted, running untuned)\n", label);
+        }
+        TrackMessageDispatcher dispatcher;
+        dispatcher.subscribe<ExtrapTrackData>([&samples](const ExtrapTrackData& m) { recordLatency(samples, m); });
+        engine->setHandler([&dispatcher](const ReceivedDatagram& d) { (void)dispatcher.dispatch(d.data, d.size); });
+        (void)engine->addReceiver(makeEndpointConfig<ExtrapTrackData>(INTERFACE_ADDRESS));
+        ready.store(true, std::memory_order_release);
+        while (samples.size() < static_cast<std::size_t>(settings.messages)) {
+            if (engine->poll(500) == 0U) {
+                break;
+            }
+        }
+    });
+    publishPaced(settings, ready);
+    receiver.join();
+    bench::printPercentiles(label, samples);
+}
+
+}  // namespace
+
+int main(int argc, char** argv) {
+    Settings settings;
+    settings.messages = bench::argOrDefault(argc, argv, 1, 20000);
+    settings.rate = bench::argOrDefault(argc, argv, 2, 10000);
+    settings.tuning.cpu = static_cast<int>(bench::argOrDefault(argc, argv, 3, -1));
+    settings.tuning.realtimePriority = static_cast<int>(bench::argOrDefault(argc, argv, 4, 0));
+    settings.busyPollMicros = static_cast<int>(bench::argOrDefault(argc, argv, 5, 0));
+
+    std::printf("=== Receive jitter: %ld messages at %ld msgs/s, cpu %d, fifo %d, busy_poll %d us ===\n",
+                settings.messages, settings.rate, settings.tuning.cpu, settings.tuning.realtimePriority,
+                settings.busyPollMicros);
+    try {
+        runBlocking(settings);
+        runEngine(settings, IoEngineKind::Epoll);
+        Settings busyPoll = settings;
+        if ((busyPoll.tuning.realtimePriority > 0) && (std::thread::hardware_concurrency() < 2U)) {
+            // A spinning SCHED_FIFO thread would starve the sender on a single CPU
+            std::printf("(busy-poll: single CPU, SCHED_FIFO disabled)\n");
+            busyPoll.tuning.realtimePriority = 0;
+        }
+        runEngine(busyPoll, IoEngineKind::BusyPoll);
+    } catch (const std::exception& e) {
+        std::fprintf(stderr, "Hata: %s\n", e.what());
+        return 1;
+    }
+    return 0;
+}
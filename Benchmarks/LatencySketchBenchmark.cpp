@@ -0,0 +1,161 @@
+// Cost and accuracy of the per-track latency histograms behind TrackStaticsPercentiles.
+// Part 1 runs LatencyHistogram over log-normal delays (median 30 us, long
+// tail) for several precisions. It reports record(), merge() and
+// four-quantile extraction cost, and the worst relative error of
+// p50/p90/p99/p99.9 against the exact sorted quantiles. Part 2 times
+// TrackStaticsAggregator::update() and a full publication with and
+// without percentiles, and merges every track's histograms into a
+// fleet-wide one.
+//
+// Usage: latency_sketch_benchmark [samples] [tracks]
+
+#include <algorithm>
+#include <cmath>
+#include <cstdio>
+#include <random>
+#include <vector>
+
+#include "BenchmarkUtil.hpp"
+#include "IoEngine.hpp"
+#include "LatencyHistogram.hpp"
+#include "TrackStaticsAggregator.hpp"
+#include "TscClock.hpp"
+
+namespace {
+
+/// Engine that accepts every datagram without sending it
+class CountingEngine final : public IoEngine {
+public:
+    std::size_t addReceiver(const EndpointConfig&) override { return 0U; }
+    std::size_t addSender(const EndpointConfig&) override { return 0U; }
+    bool send(std::size_t, const uint8_t*, std::size_t) override { return true; }
+    bool sendv(std::size_t, const iovec*, std::size_t) override { return true; }
+    void flush() override {}
+    bool readTransmitTimestamp(std::size_t, TransmitTimestamp&) override { return false; }
+    std::size_t poll(int) override { return 0U; }
+    [[nodiscard]] const char* name() const noexcept override { return "counting"; }
+};
+
+constexpr double QUANTILES[4] = {0.5, 0.9, 0.99, 0.999};
+
+std::vector<int64_t> makeDelays(std::size_t count) {
+    std::mt19937_64 random(17U);
+    std::lognormal_distribution<double> delay(std::log(30000.0), 0.8);
+    std::vector<int64_t> delays(count);
+    for (int64_t& value : delays) {
+        value = static_cast<int64_t>(delay(random));
+    }
+    return delays;
+}
+
+void measureHistogram(const std::vector<int64_t>& delays) {
+    std::vector<int64_t> sorted = delays;
+    std::sort(sorted.begin(), sorted.end());
+    int64_t exact[4];
+    for (std::size_t i = 0U; i < 4U; ++i) {
+        const std::size_t rank = static_cast<std::size_t>(std::ceil(QUANTILES[i] * static_cast<double>(sorted.size())));
+        exact[i] = sorted[std::max<std::size_t>(rank, 1U) - 1U];
+    }
+    std::printf("exact p50 %.1f us, p90 %.1f us, p99 %.1f us, p99.9 %.1f us\n", static_cast<double>(exact[0]) / 1e3,
+                static_cast<double>(exact[1]) / 1e3, static_cast<double>(exact[2]) / 1e3,
+                static_cast<double>(exact[3]) / 1e3);
+    std::printf("%6s %9s %8s %12s %12s %14s %14s\n", "bits", "buckets", "bytes", "record ns", "merge ns",
+                "quantiles ns", "max error %");
+    for (const unsigned bits : {4U, 5U, 6U, 7U, 8U, 10U}) {
+        LatencyHistogram histogram(10000000000LL, bits);
+        const int64_t start = bench::nowNs();
+        for (const int64_t value : delays) {
+            histogram.record(value);
+        }
+        const double recordNs = static_cast<double>(bench::nowNs() - start) / static_cast<double>(delays.size());
+
+        LatencyHistogram merged(10000000000LL, bits);
+        const int rounds = 1000;
+        const int64_t mergeStart = bench::nowNs();
+        for (int i = 0; i < rounds; ++i) {
+            merged.merge(histogram);
+        }
+        const double mergeNs = static_cast<double>(bench::nowNs() - mergeStart) / rounds;
+
+        int64_t values[4];
+        const int64_t quantileStart = bench::nowNs();
+        for (int i = 0; i < rounds; ++i) {
+            histogram.valuesAtQuantiles(QUANTILES, 4U, values);
+            bench::doNotOptimize(values[0]);
+        }
+        const double quantileNs = static_cast<double>(bench::nowNs() - quantileStart) / rounds;
+        double worst = 0.0;
+        for (std::size_t i = 0U; i < 4U; ++i) {
+            worst = std::max(worst, std::fabs(static_cast<double>(values[i] - exact[i])) / static_cast<double>(exact[i]));
+        }
+        std::printf("%6u %9zu %8zu %12.2f %12.0f %14.0f %14.3f\n", bits, histogram.getBucketCount(),
+                    histogram.getBucketCount() * sizeof(uint64_t), recordNs, mergeNs, quantileNs, worst * 100.0);
+    }
+}
+
+void measureAggregator(const std::vector<int64_t>& delays, std::size_t tracks) {
+    CountingEngine engine;
+    TrackPublisher publisher(engine);
+    publisher.advertise<TrackStatics>();
+    publisher.advertise<TrackStaticsPercentiles>();
+    std::vector<FinalCalcTrackData> messages(1U << 20U);
+    std::mt19937_64 random(9U);
+    std::uniform_int_distribution<int64_t> track(1, static_cast<int64_t>(tracks));
+    for (std::size_t i = 0U; i < messages.size(); ++i) {
+        const int64_t first = delays[i % delays.size()];
+        const int64_t second = delays[(i * 7U) % delays.size()];
+        messages[i].setTrackId(track(random));
+        messages[i].setFirstHopDelayTime(first);
+        messages[i].setSecondHopDelayTime(second);
+        messages[i].setTotalDelayTime(first + second);
+    }
+
+    std::printf("%12s %12s %14s %16s\n", "percentiles", "update ns", "publish ms", "fleet merge ms");
+    for (const bool percentiles : {false, true}) {
+        TrackStaticsOptions options;
+        options.maxTracks = tracks;
+        options.percentiles = percentiles;
+        TrackStaticsAggregator aggregator(publisher, options);
+        const int64_t start = bench::nowNs();
+        for (const FinalCalcTrackData& message : messages) {
+            bench::doNotOptimize(aggregator.update(message));
+        }
+        const double perUpdate = static_cast<double>(bench::nowNs() - start) / static_cast<double>(messages.size());
+        const int64_t publishStart = bench::nowNs();
+        (void)aggregator.publish(TscClock::realtimeNs());
+        const double publishMs = static_cast<double>(bench::nowNs() - publishStart) / 1e6;
+        double mergeMs = 0.0;
+        if (percentiles) {
+            TrackDelayHistograms fleet(std::chrono::duration_cast<std::chrono::nanoseconds>(options.histogramRange).count(),
+                                       options.histogramPrecisionBits);
+            const int64_t mergeStart = bench::nowNs();
+            (void)aggregator.mergeHistograms(fleet);
+            mergeMs = static_cast<double>(bench::nowNs() - mergeStart) / 1e6;
+            std::printf("fleet total delay: p50 %.1f us, p99 %.1f us, p99.9 %.1f us over %llu samples\n",
+                        static_cast<double>(fleet.total.valueAtQuantile(0.5)) / 1e3,
+                        static_cast<double>(fleet.total.valueAtQuantile(0.99)) / 1e3,
+                        static_cast<double>(fleet.total.valueAtQuantile(0.999)) / 1e3,
+                        static_cast<unsigned long long>(fleet.total.getCount()));
+        }
+        std::printf("%12s %12.1f %14.2f %16.2f\n", percentiles ? "on" : "off", perUpdate, publishMs, mergeMs);
+    }
+}
+
+}  // namespace
+
+int main(int argc, char** argv) {
+    const std::size_t samples = static_cast<std::size_t>(bench::argOrDefault(argc, argv, 1, 1000000));
+    const std::size_t tracks = static_cast<std::size_t>(bench::argOrDefault(argc, argv, 2, 10000));
+
+    std::printf("=== Latency histograms, %zu log-normal samples ===\n", samples);
+    try {
+        const std::vector<int64_t> delays = makeDelays(samples);
+        measureHistogram(delays);
+        std::printf("TrackStaticsAggregator, %zu tracks\n", tracks);
+        measureAggregator(delays, tracks);
+    } catch (const std::exception& e) {
+        std::fprintf(stderr, "Hata: %s\n", e.what());
+        return 1;
+    }
+    return 0;
+}
@@ -0,0 +1,111 @@
+// Queueing latency and shedding of the TrackShardPool overflow policies.
+// A paced producer submits FinalCalcTrackData records in bursts faster than
+// a single slow worker can handle them; updateTime carries the submit time
+// (CLOCK_MONOTONIC) and the worker records now - updateTime. Block is the
+// lossless baseline whose latency grows with the backlog; the dropping
+// policies keep it bounded by the high-water mark and report what was shed.
+//
+// Usage: overflow_policy_benchmark [records] [tracks] [high-water mark] [burst] [burst period us] [work ns]
+
+#include <chrono>
+#include <cstdio>
+#include <thread>
+#include <vector>
+
+#include "BenchmarkUtil.hpp"
+#include "EndpointConfig.hpp"
+#include "FinalCalcTrackData.hpp"
+#include "TrackShardPool.hpp"
+
+namespace {
+
+struct Settings {
+    long records{200000};
+    long tracks{200};
+    long highWaterMark{256};
+    long burst{64};
+    long burstPeriodUs{50};
+    long workNs{2000};
+};
+
+struct TrackState {
+    uint64_t updates{0U};
+};
+
+void spinFor(int64_t ns) {
+    const int64_t until = bench::nowNs() + ns;
+    while (bench::nowNs() < until) {
+    }
+}
+
+void run(const Settings& settings, OverflowPolicy policy) {
+    std::vector<int64_t> samples;
+    samples.reserve(static_cast<std::size_t>(settings.records));
+    // The limit travels with the receiver's endpoint configuration
+    EndpointConfig endpoint = makeEndpointConfig<FinalCalcTrackData>();
+    endpoint.highWaterMark = HighWaterMark{static_cast<std::size_t>(settings.highWaterMark), policy};
+    TrackShardPool<FinalCalcTrackData, TrackState> pool(
+        1U,
+        [&samples, &settings](const FinalCalcTrackData& update, TrackState& state) {
+            spinFor(settings.workNs);
+            samples.push_back(bench::nowNs() - update.getUpdateTime());
+            ++state.updates;
+        },
+        endpoint);
+    pool.start();
+
+    FinalCalcTrackData message;
+    std::vector<uint8_t> record;
+    const auto period = std::chrono::microseconds(settings.burstPeriodUs);
+    auto next = std::chrono::steady_clock::now();
+    const int64_t start = bench::nowNs();
+    for (long i = 0; i < settings.records;) {
+        for (long k = 0; (k < settings.burst) && (i < settings.records); ++k, ++i) {
+            message.setTrackId(static_cast<int64_t>(i % settings.tracks));
+            message.setUpdateTime(bench::nowNs());
+            record = message.serialize();
+            pool.submitRecord(record.data(), record.size());
+        }
+        next += period;
+        std::this_thread::sleep_until(next);
+    }
+    pool.stop();
+    const double seconds = static_cast<double>(bench::nowNs() - start) / 1e9;
+
+    std::printf("%-20s %10llu %10llu %10llu %10llu %10llu %9.2fs\n", overflowPolicyName(policy),
+                static_cast<unsigned long long>(pool.getProcessedCount()),
+                static_cast<unsigned long long>(pool.getBackpressureCount()),
+                static_cast<unsigned long long>(pool.getDroppedNewest()),
+                static_cast<unsigned long long>(pool.getDroppedOldest()),
+                static_cast<unsigned long long>(pool.getConflatedCount()), seconds);
+    bench::printPercentiles(overflowPolicyName(policy), samples);
+}
+
+}  // namespace
+
+int main(int argc, char** argv) {
+    Settings settings;
+    settings.records = bench::argOrDefault(argc, argv, 1, 200000);
+    settings.tracks = bench::argOrDefault(argc, argv, 2, 200);
+    settings.highWaterMark = bench::argOrDefault(argc, argv, 3, 256);
+    settings.burst = bench::argOrDefault(argc, argv, 4, 64);
+    settings.burstPeriodUs = bench::argOrDefault(argc, argv, 5, 50);
+    settings.workNs = bench::argOrDefault(argc, argv, 6, 2000);
+
+    std::printf("=== Overflow policies: %ld records, %ld tracks, HWM %ld, %ld records every %ld us, %ld ns/record ===\n",
+                settings.records, settings.tracks, settings.highWaterMark, settings.burst, settings.burstPeriodUs,
+                settings.workNs);
+    try {
+        const OverflowPolicy policies[] = {OverflowPolicy::Block, OverflowPolicy::DropNewest,
+                                           OverflowPolicy::DropOldest, OverflowPolicy::ConflatePerTrack};
+        for (const OverflowPolicy policy : policies) {
+            std::printf("%-20s %10s %10s %10s %10s %10s %10s\n", "policy", "processed", "backpress", "drop_new",
+                        "drop_old", "conflated", "elapsed");
+            run(settings, policy);
+        }
+    } catch (const std::exception& e) {
+        std::fprintf(stderr, "Hata: %s\n", e.what());
+        return 1;
+    }
+    return 0;
+}
@@ -0,0 +1,77 @@
+// Scaling of TrackShardPool from 1 to 16 workers on ExtrapTrackData.
+// Datagrams are pre-encoded in memory so the run measures the front-end,
+// the SPSC hand-off and per-worker decode + processing, not the NIC.
+//
+// Usage: shard_pool_benchmark [datagrams] [tracks] [work iterations per message]
+
+#include <atomic>
+#include <cmath>
+#include <cstdio>
+#include <vector>
+
+#include "BenchmarkUtil.hpp"
+#include "TrackPublisher.hpp"
+#include "TrackShardPool.hpp"
+
+namespace {
+
+struct TrackState {
+    int64_t lastUpdateTime{-1};
+    uint64_t updates{0U};
+    double accumulator{0.0};
+};
+
+}  // namespace
+
+int main(int argc, char** argv) {
+    const long datagramCount = bench::argOrDefault(argc, argv, 1, 2000000);
+    const long trackCount = bench::argOrDefault(argc, argv, 2, 10000);
+    const long workIterations = bench::argOrDefault(argc, argv, 3, 64);
+
+    std::vector<std::vector<uint8_t>> datagrams(static_cast<std::size_t>(datagramCount));
+    ExtrapTrackData message;
+    for (long i = 0; i < datagramCount; ++i) {
+        message.setTrackId(static_cast<uint32_t>(i % trackCount));
+        message.setUpdateTime(i);
+        message.setXPositionECEF(static_cast<double>(i));
+        TrackPublisher::encode(message, static_cast<uint64_t>(i), datagrams[static_cast<std::size_t>(i)]);
+    }
+
+    std::printf("=== TrackShardPool scaling: %ld datagrams, %ld tracks, %ld work iterations, %u hw threads ===\n",
+                datagramCount, trackCount, workIterations, std::thread::hardware_concurrency());
+    std::printf("%8s %14s %12s %12s\n", "workers", "msgs/s", "speedup", "violations");
+
+    double baseline = 0.0;
+    for (std::size_t workers = 1U; workers <= 16U; workers *= 2U) {
+        std::atomic<uint64_t> violations{0U};
+        TrackShardPool<ExtrapTrackData, TrackState> pool(
+            workers, [&violations, workIterations](const ExtrapTrackData& update, TrackState& state) {
+                if (update.getUpdateTime() <= state.lastUpdateTime) {
+                    violations.fetch_add(1U, std::memory_order_relaxed);
+                }
+                state.lastUpdateTime = update.getUpdateTime();
+                ++state.updates;
+                double value = update.getXPositionECEF();
+                for (long k = 0; k < workIterations; ++k) {
+                    value = std::sqrt(value + static_cast<double>(k));
+                }
+                state.accumulator += value;
+            });
+        pool.start();
+
+        const int64_t start = bench::nowNs();
+        for (const std::vector<uint8_t>& datagram : datagrams) {
+            (void)pool.dispatch(datagram.data(), datagram.size());
+        }
+        pool.stop();
+        const double seconds = static_cast<double>(bench::nowNs() - start) / 1e9;
+
+        const double rate = static_cast<double>(pool.getProcessedCount()) / seconds;
+        if (workers == 1U) {
+            baseline = rate;
+        }
+        std::printf("%8zu %14.0f %11.2fx %12llu\n", workers, rate, rate / baseline,
+                    static_cast<unsigned long long>(violations.load()));
+    }
+    return 0;
+}
@@ -0,0 +1,138 @@
+// Per-subscriber traffic with trackId sharding. A publisher spreads
+// ExtrapTrackData over 4 shards; subscribers JOIN some of them and count the
+// datagrams their sockets deliver, the records their handlers get, and records
+// from shards they did not ask for (must be 0).
+//
+// Usage: sharding_benchmark [messages] [tracks] [interface address]
+
+#include <cstdio>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "BenchmarkUtil.hpp"
+#include "EndpointManager.hpp"
+#include "TrackSharding.hpp"
+
+namespace {
+
+constexpr long BURST = 32;
+
+struct Subscriber {
+    const char* label{""};
+    std::vector<uint32_t> shards;
+    std::unique_ptr<EndpointManager> manager;
+    uint64_t datagrams{0U};
+    uint64_t records{0U};
+    uint64_t foreign{0U};
+};
+
+void attach(Subscriber& subscriber, const TrackShardScheme* scheme, const std::string& interfaceAddress) {
+    subscriber.manager = std::make_unique<EndpointManager>(IoEngineKind::Epoll, interfaceAddress);
+    Subscriber* const self = &subscriber;
+    if (scheme == nullptr) {
+        subscriber.manager->subscribe<ExtrapTrackData>([self](const ExtrapTrackData&) { ++self->records; });
+    } else {
+        std::vector<bool> wanted(scheme->getShardCount(), false);
+        for (const uint32_t shard : subscriber.shards) {
+            wanted[shard] = true;
+        }
+        subscriber.manager->subscribeShards<ExtrapTrackData>(
+            *scheme, subscriber.shards, [self, scheme, wanted](const ExtrapTrackData& message) {
+                ++self->records;
+                self->foreign += wanted[scheme->shardOf(message.getTrackId())] ? 0U : 1U;
+            });
+    }
+    EndpointManager& manager = *subscriber.manager;
+    manager.getEngine().setHandler([self, &manager](const ReceivedDatagram& datagram) {
+        ++self->datagrams;
+        (void)manager.getDispatcher().dispatch(datagram.data, datagram.size, datagram.timestamps);
+    });
+}
+
+void run(const char* title, const TrackShardScheme* scheme, std::vector<Subscriber>& subscribers, long messages,
+         long tracks, const std::string& interfaceAddress) {
+    for (Subscriber& subscriber : subscribers) {
+        attach(subscriber, scheme, interfaceAddress);
+    }
+    EndpointManager publisher(IoEngineKind::Epoll, interfaceAddress);
+    if (scheme != nullptr) {
+        publisher.advertiseShards<ExtrapTrackData>(*scheme);
+    }
+
+    ExtrapTrackData message;
+    const int64_t start = bench::nowNs();
+    for (long i = 0; i < messages; ++i) {
+        message.setTrackId(static_cast<uint32_t>(i % tracks));
+        (void)publisher.publish(message);
+        if ((i % BURST) == (BURST - 1)) {
+            for (Subscriber& subscriber : subscribers) {
+                while (subscriber.manager->poll(0) > 0U) {
+                }
+            }
+        }
+    }
+    for (Subscriber& subscriber : subscribers) {
+        while (subscriber.manager->poll(50) > 0U) {
+        }
+    }
+    const double seconds = static_cast<double>(bench::nowNs() - start) / 1e9;
+
+    std::printf("--- %s: published %ld (%.0f msgs/s) ---\n", title, messages, static_cast<double>(messages) / seconds);
+    for (const Subscriber& subscriber : subscribers) {
+        std::printf("  %-22s datagrams %7llu (%5.1f%%)  records %7llu  foreign %llu\n", subscriber.label,
+                    static_cast<unsigned long long>(subscriber.datagrams),
+                    100.0 * static_cast<double>(subscriber.datagrams) / static_cast<double>(messages),
+                    static_cast<unsigned long long>(subscriber.records),
+                    static_cast<unsigned long long>(subscriber.foreign));
+    }
+}
+
+std::vector<Subscriber> makeSubscribers(const std::vector<std::pair<const char*, std::vector<uint32_t>>>& specs) {
+    std::vector<Subscriber> subscribers(specs.size());
+    for (std::size_t i = 0U; i < specs.size(); ++i) {
+        subscribers[i].label = specs[i].first;
+        subscribers[i].shards = specs[i].second;
+    }
+    return subscribers;
+}
+
+}  // namespace
+
+int main(int argc, char** argv) {
+    const long messages = bench::argOrDefault(argc, argv, 1, 200000);
+    const long tracks = bench::argOrDefault(argc, argv, 2, 10000);
+    const std::string interfaceAddress = (argc > 3) ? argv[3] : "127.0.0.1";
+    const ServiceDescriptor& service = TrackMessageTraits<ExtrapTrackData>::DESCRIPTOR;
+
+    std::printf("=== trackId sharding: %ld messages over %ld tracks ===\n", messages, tracks);
+    try {
+        std::vector<Subscriber> plain = makeSubscribers({{"all tracks", {}}});
+        run("unsharded", nullptr, plain, messages, tracks, interfaceAddress);
+
+        ShardingOptions hashed;
+        hashed.addressBase = "239.1.2.0";
+        const TrackShardScheme hashScheme(service, hashed, interfaceAddress);
+        std::vector<Subscriber> hashSubscribers =
+            makeSubscribers({{"shards 0-3", {0U, 1U, 2U, 3U}}, {"shard 0", {0U}}, {"shards 1,2", {1U, 2U}}});
+        run("hash x4, address per shard", &hashScheme, hashSubscribers, messages, tracks, interfaceAddress);
+
+        ShardingOptions ranged;
+        ranged.mode = ShardingMode::Range;
+        ranged.rangeWidth = static_cast<uint64_t>((tracks + 3) / 4);
+        ranged.addressBase = "239.1.3.0";
+        const TrackShardScheme rangeScheme(service, ranged, interfaceAddress);
+        std::vector<Subscriber> rangeSubscribers =
+            makeSubscribers({{"first quarter of ids", rangeScheme.shardsForRange(0U, ranged.rangeWidth - 1U)}});
+        run("range x4, address per shard", &rangeScheme, rangeSubscribers, messages, tracks, interfaceAddress);
+
+        ShardingOptions shared;
+        const TrackShardScheme sharedScheme(service, shared, interfaceAddress);
+        std::vector<Subscriber> sharedSubscribers = makeSubscribers({{"shard 0", {0U}}});
+        run("hash x4, shared address", &sharedScheme, sharedSubscribers, messages, tracks, interfaceAddress);
+    } catch (const std::exception& e) {
+        std::fprintf(stderr, "Hata: %s\n", e.what());
+        return 1;
+    }
+    return 0;
+}
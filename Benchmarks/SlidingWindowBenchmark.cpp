@@ -0,0 +1,158 @@
+// Per-update cost of sliding event-time window statistics as the window grows.
+// Samples arrive at a fixed event-time rate. For each window length, part 1
+// times SlidingDelayWindow::add() followed by an O(1) max() query. It also
+// times one snapshot() (mean/std), with 1 s buckets so the bucket count
+// grows with the window. The reference keeps every sample in a deque,
+// expires from the front and rescans for mean/std/min/max after each
+// update, which is what the buckets avoid. Part 2 times
+// TrackStaticsAggregator::update() with 10 s windows over many tracks.
+//
+// Usage: sliding_window_benchmark [samples per second] [tracks]
+
+#include <cmath>
+#include <cstdio>
+#include <deque>
+#include <random>
+#include <vector>
+
+#include "BenchmarkUtil.hpp"
+#include "IoEngine.hpp"
+#include "SlidingDelayWindow.hpp"
+#include "TrackStaticsAggregator.hpp"
+
+namespace {
+
+/// Engine that accepts every datagram without sending it
+class CountingEngine final : public IoEngine {
+public:
+    std::size_t addReceiver(const EndpointConfig&) override { return 0U; }
+    std::size_t addSender(const EndpointConfig&) override { return 0U; }
+    bool send(std::size_t, const uint8_t*, std::size_t) override { return true; }
+    bool sendv(std::size_t, const iovec*, std::size_t) override { return true; }
+    void flush() override {}
+    bool readTransmitTimestamp(std::size_t, TransmitTimestamp&) override { return false; }
+    std::size_t poll(int) override { return 0U; }
+    [[nodiscard]] const char* name() const noexcept override { return "counting"; }
+};
+
+struct Sample {
+    int64_t timeNs;
+    double value;
+};
+
+/// Rescans every sample in the window; what the buckets replace
+double rescan(const std::deque<Sample>& samples) {
+    DelayAccumulator accumulator;
+    for (const Sample& sample : samples) {
+        accumulator.add(sample.value);
+    }
+    return accumulator.stddev() + accumulator.max;
+}
+
+void measureWindows(long rate) {
+    const int64_t stepNs = 1000000000LL / rate;
+    std::mt19937_64 random(3U);
+    std::normal_distribution<double> delay(30000.0, 5000.0);
+    std::vector<double> values(1U << 16U);
+    for (double& value : values) {
+        value = delay(random);
+    }
+
+    std::printf("%10s %9s %9s %14s %14s %16s\n", "window s", "buckets", "samples", "add+max ns", "snapshot ns",
+                "rescan ns/update");
+    for (const long seconds : {1L, 10L, 60L, 300L, 600L}) {
+        const int64_t windowNs = seconds * 1000000000LL;
+        const std::size_t buckets = static_cast<std::size_t>(seconds);
+        SlidingDelayWindow window(windowNs, buckets);
+        // Fill one window first, so every timed add() also expires
+        const std::size_t warmup = static_cast<std::size_t>(seconds * rate);
+        int64_t now = 0;
+        for (std::size_t i = 0U; i < warmup; ++i, now += stepNs) {
+            (void)window.add(now, values[i & (values.size() - 1U)]);
+        }
+        const std::size_t updates = 4000000U;
+        const int64_t start = bench::nowNs();
+        for (std::size_t i = 0U; i < updates; ++i, now += stepNs) {
+            (void)window.add(now, values[i & (values.size() - 1U)]);
+            bench::doNotOptimize(window.max());
+        }
+        const double perAdd = static_cast<double>(bench::nowNs() - start) / static_cast<double>(updates);
+        const int64_t snapshotStart = bench::nowNs();
+        const DelayAccumulator snapshot = window.snapshot();
+        const int64_t snapshotNs = bench::nowNs() - snapshotStart;
+        bench::doNotOptimize(snapshot.mean);
+
+        // The rescan reference over the same window, for a few hundred updates
+        std::deque<Sample> samples;
+        int64_t referenceNow = 0;
+        for (std::size_t i = 0U; i < warmup; ++i, referenceNow += stepNs) {
+            samples.push_back(Sample{referenceNow, values[i & (values.size() - 1U)]});
+        }
+        const std::size_t referenceUpdates = 200U;
+        const int64_t referenceStart = bench::nowNs();
+        for (std::size_t i = 0U; i < referenceUpdates; ++i, referenceNow += stepNs) {
+            samples.push_back(Sample{referenceNow, values[i & (values.size() - 1U)]});
+            while (samples.front().timeNs <= (referenceNow - windowNs)) {
+                samples.pop_front();
+            }
+            bench::doNotOptimize(rescan(samples));
+        }
+        const double perRescan =
+            static_cast<double>(bench::nowNs() - referenceStart) / static_cast<double>(referenceUpdates);
+        std::printf("%10ld %9zu %9zu %14.1f %14lld %16.0f\n", seconds, buckets, samples.size(), perAdd,
+                    static_cast<long long>(snapshotNs), perRescan);
+    }
+}
+
+void measureAggregator(std::size_t tracks, long rate) {
+    CountingEngine engine;
+    TrackPublisher publisher(engine);
+    publisher.advertise<TrackStatics>();
+    std::printf("%10s %12s %14s\n", "window s", "update ns", "publish ms");
+    for (const long seconds : {0L, 10L}) {
+        TrackStaticsOptions options;
+        options.maxTracks = tracks;
+        options.window = std::chrono::seconds(seconds);
+        TrackStaticsAggregator aggregator(publisher, options);
+        std::mt19937_64 random(5U);
+        std::uniform_int_distribution<int64_t> track(1, static_cast<int64_t>(tracks));
+        std::vector<FinalCalcTrackData> messages(1U << 20U);
+        const int64_t stepNs = 1000000000LL / rate;
+        int64_t now = 1000000000LL;
+        for (FinalCalcTrackData& message : messages) {
+            message.setTrackId(track(random));
+            message.setFirstHopDelayTime(20000);
+            message.setSecondHopDelayTime(10000 + (now % 7000));
+            message.setTotalDelayTime(30000 + (now % 7000));
+            message.setThirdHopSentTime(now);
+            now += stepNs;
+        }
+        const int64_t start = bench::nowNs();
+        for (const FinalCalcTrackData& message : messages) {
+            bench::doNotOptimize(aggregator.update(message));
+        }
+        const double perUpdate = static_cast<double>(bench::nowNs() - start) / static_cast<double>(messages.size());
+        const int64_t publishStart = bench::nowNs();
+        (void)aggregator.publish(now);
+        std::printf("%10ld %12.1f %14.2f\n", seconds, perUpdate,
+                    static_cast<double>(bench::nowNs() - publishStart) / 1e6);
+    }
+}
+
+}  // namespace
+
+int main(int argc, char** argv) {
+    const long rate = bench::argOrDefault(argc, argv, 1, 10000);
+    const std::size_t tracks = static_cast<std::size_t>(bench::argOrDefault(argc, argv, 2, 10000));
+
+    std::printf("=== Sliding window statistics, %ld samples/s of event time ===\n", rate);
+    try {
+        measureWindows(rate);
+        std::printf("TrackStaticsAggregator, %zu tracks (window 0 = cumulative)\n", tracks);
+        measureAggregator(tracks, rate);
+    } catch (const std::exception& e) {
+        std::fprintf(stderr, "Hata: %s\n", e.what());
+        return 1;
+    }
+    return 0;
+}
@@ -0,0 +1,151 @@
+// How many tracks one core can extrapolate and publish per tick.
+// For growing live-track counts, runs ExtrapolationTickScheduler::tick()
+// repeatedly and reports the median time of each phase (extrapolate,
+// convert to ExtrapTrackData, publishBatch). Part 1 publishes into an
+// engine that only counts bytes; part 2 sends real datagrams through the
+// loopback epoll engine. The last column is the track count that would
+// fill the tick period at that cost. Finally a real-time poll() loop at
+// the largest count that fits reports missed ticks and overruns.
+//
+// Usage: tick_scheduler_benchmark [ticks per size] [period ms] [interface address]
+
+#include <algorithm>
+#include <cstdio>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "BenchmarkUtil.hpp"
+#include "ExtrapolationTickScheduler.hpp"
+#include "IoEngine.hpp"
+#include "TscClock.hpp"
+
+namespace {
+
+/// Engine that accepts every datagram without sending it
+class CountingEngine final : public IoEngine {
+public:
+    std::size_t addReceiver(const EndpointConfig&) override { return 0U; }
+    std::size_t addSender(const EndpointConfig&) override { return 0U; }
+    bool send(std::size_t, const uint8_t*, std::size_t size) override {
+        bytes_ += size;
+        return true;
+    }
+    bool sendv(std::size_t, const iovec* vectors, std::size_t count) override {
+        for (std::size_t i = 0U; i < count; ++i) {
+            bytes_ += vectors[i].iov_len;
+        }
+        return true;
+    }
+    void flush() override {}
+    bool readTransmitTimestamp(std::size_t, TransmitTimestamp&) override { return false; }
+    std::size_t poll(int) override { return 0U; }
+    [[nodiscard]] const char* name() const noexcept override { return "counting"; }
+
+private:
+    uint64_t bytes_{0U};
+};
+
+void fill(ExtrapolationTickScheduler& scheduler, std::size_t tracks, int64_t now) {
+    ProcessedTrackData track;
+    for (std::size_t i = 0U; i < tracks; ++i) {
+        track.setTrackId(static_cast<int64_t>(i + 1U));
+        track.setXPositionECEF(4.0e6 + static_cast<double>(i));
+        track.setYPositionECEF(1.0e6);
+        track.setZPositionECEF(4.5e6);
+        track.setXVelocityECEF(200.0);
+        track.setYVelocityECEF(-50.0);
+        track.setZVelocityECEF(10.0);
+        track.setUpdateTime(now - static_cast<int64_t>(i % 1000U) * 1000000);
+        (void)scheduler.update(track);
+    }
+}
+
+int64_t median(std::vector<int64_t>& values) {
+    std::sort(values.begin(), values.end());
+    return values[values.size() / 2U];
+}
+
+/// Returns the median total tick time
+int64_t measure(IoEngine& engine, std::size_t tracks, long ticks, int64_t periodNs, const std::string& address) {
+    TrackPublisher publisher(engine);
+    publisher.advertise<ExtrapTrackData>(address);
+    TickSchedulerOptions options;
+    options.maxTracks = tracks;
+    options.staleAfter = std::chrono::hours(1);
+    ExtrapolationTickScheduler scheduler(publisher, options);
+    const int64_t now = TscClock::realtimeNs();
+    fill(scheduler, tracks, now);
+
+    std::vector<int64_t> extrapolate;
+    std::vector<int64_t> convert;
+    std::vector<int64_t> publish;
+    std::vector<int64_t> total;
+    for (long tick = 0; tick < ticks; ++tick) {
+        (void)scheduler.tick(now + (tick * periodNs));
+        const TickTimings& timings = scheduler.getLastTickTimings();
+        extrapolate.push_back(timings.extrapolateNs);
+        convert.push_back(timings.convertNs);
+        publish.push_back(timings.publishNs);
+        total.push_back(timings.totalNs());
+    }
+    const int64_t totalNs = median(total);
+    const double perTrack = static_cast<double>(totalNs) / static_cast<double>(tracks);
+    std::printf("%9zu %12.3f %12.3f %12.3f %12.3f %10.1f %12.0f\n", tracks, static_cast<double>(median(extrapolate)) / 1e6,
+                static_cast<double>(median(convert)) / 1e6, static_cast<double>(median(publish)) / 1e6,
+                static_cast<double>(totalNs) / 1e6, perTrack, static_cast<double>(periodNs) / perTrack);
+    return totalNs;
+}
+
+}  // namespace
+
+int main(int argc, char** argv) {
+    const long ticks = bench::argOrDefault(argc, argv, 1, 20);
+    const int64_t periodNs = bench::argOrDefault(argc, argv, 2, 20) * 1000000LL;
+    const std::string address = (argc > 3) ? argv[3] : "127.0.0.1";
+    const std::size_t sizes[] = {1000U, 10000U, 100000U, 250000U, 1000000U};
+
+    std::printf("=== Tick scheduler, %.0f ms period, %ld ticks per size, %s kernel ===\n",
+                static_cast<double>(periodNs) / 1e6, ticks,
+                simdLevelName(ExtrapolationEngine::detectSimdLevel()));
+    try {
+        for (const bool loopback : {false, true}) {
+            std::printf("%s\n", loopback ? "Loopback epoll engine" : "Counting engine (user space only)");
+            std::printf("%9s %12s %12s %12s %12s %10s %12s\n", "tracks", "extrap ms", "convert ms", "publish ms",
+                        "total ms", "ns/track", "fit/tick");
+            for (const std::size_t tracks : sizes) {
+                if (loopback) {
+                    std::unique_ptr<IoEngine> engine = IoEngine::create(IoEngineKind::Epoll);
+                    (void)measure(*engine, tracks, ticks, periodNs, address);
+                } else {
+                    CountingEngine engine;
+                    (void)measure(engine, tracks, ticks, periodNs, address);
+                }
+            }
+        }
+
+        const std::size_t tracks = 100000U;
+        std::unique_ptr<IoEngine> engine = IoEngine::create(IoEngineKind::Epoll);
+        TrackPublisher publisher(*engine);
+        publisher.advertise<ExtrapTrackData>(address);
+        TickSchedulerOptions options;
+        options.period = std::chrono::microseconds(periodNs / 1000);
+        options.maxTracks = tracks;
+        options.staleAfter = std::chrono::hours(1);
+        ExtrapolationTickScheduler scheduler(publisher, options);
+        fill(scheduler, tracks, TscClock::realtimeNs());
+        const int64_t end = TscClock::realtimeNs() + 1000000000LL;
+        while (TscClock::realtimeNs() < end) {
+            (void)scheduler.poll();
+        }
+        std::printf("Real time, %zu tracks for 1 s: ticks %llu missed %llu overruns %llu max tick %.3f ms\n", tracks,
+                    static_cast<unsigned long long>(scheduler.getTickCount()),
+                    static_cast<unsigned long long>(scheduler.getMissedTickCount()),
+                    static_cast<unsigned long long>(scheduler.getOverrunCount()),
+                    static_cast<double>(scheduler.getMaxTickNs()) / 1e6);
+    } catch (const std::exception& e) {
+        std::fprintf(stderr, "Hata: %s\n", e.what());
+        return 1;
+    }
+    return 0;
+}
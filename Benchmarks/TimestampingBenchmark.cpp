@@ -0,0 +1,135 @@
+// Splits one loopback hop into kernel-timestamped segments with SO_TIMESTAMPING
+// software stamps (CLOCK_REALTIME):
+//   send path  : application send() -> TX software stamp
+//   stack      : TX stamp -> RX software stamp
+//   wakeup     : RX stamp -> application handler
+// Runs once per engine (io_uring RECVMSG, epoll, busy-poll) and checks that
+// transmit timestamp ids line up with the envelope sequence; a last epoll run
+// adds FEC parity datagrams on the same endpoint.
+//
+// Usage: timestamping_benchmark [messages]
+
+#include <cstdio>
+#include <ctime>
+#include <memory>
+#include <vector>
+
+#include "BenchmarkUtil.hpp"
+#include "IoEngine.hpp"
+#include "TrackMessageDispatcher.hpp"
+#include "TrackPublisher.hpp"
+
+namespace {
+
+const char* const INTERFACE_ADDRESS = "127.0.0.1";
+
+int64_t realtimeNs() noexcept {
+    timespec now{};
+    (void)clock_gettime(CLOCK_REALTIME, &now);
+    return (static_cast<int64_t>(now.tv_sec) * 1000000000LL) + now.tv_nsec;
+}
+
+void run(IoEngineKind kind, long messages, bool fec = false) {
+    std::unique_ptr<IoEngine> receiverEngine;
+    try {
+        receiverEngine = IoEngine::create(kind);
+    } catch (const std::system_error& e) {
+        std::printf("(engine unavailable: %s)\n", e.what());
+        return;
+    }
+    std::unique_ptr<IoEngine> senderEngine = IoEngine::create(IoEngineKind::Epoll);
+
+    EndpointConfig config = makeEndpointConfig<ExtrapTrackData>(INTERFACE_ADDRESS);
+    config.timestamping = TimestampingMode::Software;
+    TrackPublisher publisher(*senderEngine);
+    publisher.advertise<ExtrapTrackData>(config);
+    if (fec) {
+        // Parity shares the socket and its timestamp ids
+        FecOptions options;
+        options.scheme = FecScheme::ReedSolomon;
+        options.dataPackets = 4U;
+        options.parityPackets = 2U;
+        publisher.enableFec<ExtrapTrackData>(options);
+    }
+
+    std::vector<int64_t> sendPath;
+    std::vector<int64_t> stack;
+    std::vector<int64_t> wakeup;
+    sendPath.reserve(static_cast<std::size_t>(messages));
+    stack.reserve(static_cast<std::size_t>(messages));
+    wakeup.reserve(static_cast<std::size_t>(messages));
+
+    TrackMessageDispatcher dispatcher;
+    int64_t appSentNs = 0;
+    int64_t rxStampNs = 0;
+    bool received = false;
+    dispatcher.subscribe<ExtrapTrackData>([&](const ExtrapTrackData&) {
+        const int64_t handledNs = realtimeNs();
+        rxStampNs = dispatcher.getReceiveTimestamps().softwareNs;
+        if (rxStampNs != 0) {
+            wakeup.push_back(handledNs - rxStampNs);
+        }
+        received = true;
+    });
+    receiverEngine->setHandler([&dispatcher](const ReceivedDatagram& d) {
+        (void)dispatcher.dispatch(d.data, d.size, d.timestamps);
+    });
+    (void)receiverEngine->addReceiver(config);
+
+    ExtrapTrackData message;
+    message.setTrackId(1U);
+    long missingRx = 0;
+    long missingTx = 0;
+    long idMismatch = 0;
+    for (long i = 0; i < messages; ++i) {
+        const uint64_t sequence = publisher.getNextSequence<ExtrapTrackData>();
+        received = false;
+        rxStampNs = 0;
+        appSentNs = realtimeNs();
+        (void)publisher.publish(message);
+        while (!received) {
+            if (receiverEngine->poll(500) == 0U) {
+                break;
+            }
+        }
+        if (rxStampNs == 0) {
+            ++missingRx;
+        }
+
+        TransmitTimestamp tx;
+        if (!publisher.readTransmitTimestamp<ExtrapTrackData>(tx) || (tx.softwareNs == 0)) {
+            ++missingTx;
+            continue;
+        }
+        if (tx.id != static_cast<uint32_t>(sequence)) {
+            ++idMismatch;
+        }
+        sendPath.push_back(tx.softwareNs - appSentNs);
+        if (rxStampNs != 0) {
+            stack.push_back(rxStampNs - tx.softwareNs);
+        }
+    }
+
+    std::printf("--- %s%s: missing rx %ld, missing tx %ld, tx id mismatches %ld ---\n", receiverEngine->name(),
+                fec ? " + FEC" : "", missingRx, missingTx, idMismatch);
+    bench::printPercentiles("send path", sendPath);
+    bench::printPercentiles("stack", stack);
+    bench::printPercentiles("wakeup", wakeup);
+}
+
+}  // namespace
+
+int main(int argc, char** argv) {
+    const long messages = bench::argOrDefault(argc, argv, 1, 20000);
+    std::printf("=== SO_TIMESTAMPING loopback breakdown: %ld messages ===\n", messages);
+    try {
+        run(IoEngineKind::IoUring, messages);
+        run(IoEngineKind::Epoll, messages);
+        run(IoEngineKind::BusyPoll, messages);
+        run(IoEngineKind::Epoll, messages, true);
+    } catch (const std::exception& e) {
+        std::fprintf(stderr, "Hata: %s\n", e.what());
+        return 1;
+    }
+    return 0;
+}
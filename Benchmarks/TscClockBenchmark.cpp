@@ -0,0 +1,96 @@
+// Cost of one timestamp read (clock_gettime vs TscClock) and drift of the
+// TSC clock against CLOCK_REALTIME, with and without background recalibration.
+//
+// Usage: tsc_clock_benchmark [drift seconds] [recalibration ms]
+
+#include <chrono>
+#include <cstdio>
+#include <ctime>
+#include <thread>
+#include <vector>
+
+#include "BenchmarkUtil.hpp"
+#include "TscClock.hpp"
+
+namespace {
+
+constexpr long READS = 20000000L;
+
+template <typename Read>
+void measureCost(const char* label, Read read) {
+    int64_t sink = 0;
+    const int64_t start = bench::nowNs();
+    for (long i = 0; i < READS; ++i) {
+        sink += read();
+    }
+    const int64_t elapsed = bench::nowNs() - start;
+    bench::doNotOptimize(sink);
+    std::printf("%-24s %6.2f ns/read\n", label, static_cast<double>(elapsed) / static_cast<double>(READS));
+}
+
+/// CLOCK_REALTIME minus the TSC reading, bracketed to keep the sampling error small
+int64_t offsetNs(const TscClock& clock) {
+    int64_t best = 0;
+    int64_t bestWindow = INT64_MAX;
+    for (int attempt = 0; attempt < 5; ++attempt) {
+        const int64_t before = clock.nowNs();
+        const int64_t reference = TscClock::realtimeNs();
+        const int64_t after = clock.nowNs();
+        if ((after - before) < bestWindow) {
+            bestWindow = after - before;
+            best = reference - (before + (bestWindow / 2));
+        }
+    }
+    return best;
+}
+
+void measureDrift(const char* label, long seconds, std::chrono::milliseconds interval) {
+    TscClock::Options options;
+    options.recalibrationInterval = interval;
+    TscClock clock(options);
+    if (!clock.isTscAvailable()) {
+        std::printf("%-24s no invariant TSC, clock_gettime() fallback\n", label);
+        return;
+    }
+
+    std::vector<int64_t> errors;
+    long backwards = 0;
+    int64_t previous = clock.nowNs();
+    const auto end = std::chrono::steady_clock::now() + std::chrono::seconds(seconds);
+    while (std::chrono::steady_clock::now() < end) {
+        const int64_t offset = offsetNs(clock);
+        errors.push_back((offset < 0) ? -offset : offset);
+        // Burst of reads to catch a reading going backwards across a recalibration
+        for (int i = 0; i < 10000; ++i) {
+            const int64_t now = clock.nowNs();
+            backwards += (now < previous) ? 1 : 0;
+            previous = now;
+        }
+        std::this_thread::sleep_for(std::chrono::milliseconds(20));
+    }
+    std::printf("%-24s freq %.6f GHz, final offset %lld ns, recalibrations %llu, steps %llu, backwards %ld\n",
+                label, static_cast<double>(clock.getFrequencyHz()) / 1e9,
+                static_cast<long long>(offsetNs(clock)),
+                static_cast<unsigned long long>(clock.getRecalibrationCount()),
+                static_cast<unsigned long long>(clock.getStepCount()), backwards);
+    bench::printPercentiles("  |offset|", errors);
+}
+
+}  // namespace
+
+int main(int argc, char** argv) {
+    const long seconds = bench::argOrDefault(argc, argv, 1, 5);
+    const std::chrono::milliseconds interval(bench::argOrDefault(argc, argv, 2, 500));
+
+    TscClock clock;
+    std::printf("=== TSC clock: invariant TSC %s, %.6f GHz ===\n", clock.isTscAvailable() ? "yes" : "no",
+                static_cast<double>(clock.getFrequencyHz()) / 1e9);
+    measureCost("clock_gettime(REALTIME)", []() { return TscClock::realtimeNs(); });
+    measureCost("rdtsc", []() { return static_cast<int64_t>(TscClock::readTsc()); });
+    measureCost("TscClock::nowNs", [&clock]() { return clock.nowNs(); });
+
+    std::printf("--- drift over %ld s ---\n", seconds);
+    measureDrift("free running", seconds, std::chrono::milliseconds(0));
+    measureDrift("recalibrated", seconds, interval);
+    return 0;
+}
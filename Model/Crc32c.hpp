@@ -0,0 +1,115 @@
+#pragma once
+
+// MISRA C++ 2023 compliant includes
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#if defined(__x86_64__) || defined(__i386__)
+#include <cpuid.h>
+#include <nmmintrin.h>
+#endif
+
+/**
+ * @brief CRC32C (Castagnoli) of the optional record trailer.
+ * compute() uses the SSE4.2 crc32 instruction when the CPU has it and a
+ * slicing-by-8 table otherwise; both give the same value.
+ * Auto-generated helper, shared by all model classes
+ */
+class Crc32c final {
+public:
+    static constexpr uint32_t POLYNOMIAL = 0x82F63B78U;  // reflected 0x1EDC6F41
+
+    [[nodiscard]] static uint32_t compute(const uint8_t* data, std::size_t size) noexcept {
+        return hasHardwareSupport() ? computeHardware(data, size) : computeSoftware(data, size);
+    }
+
+    [[nodiscard]] static bool hasHardwareSupport() noexcept {
+#if defined(__x86_64__) || defined(__i386__)
+        static const bool supported = []() {
+            unsigned int eax = 0U;
+            unsigned int ebx = 0U;
+            unsigned int ecx = 0U;
+            unsigned int edx = 0U;
+            return (__get_cpuid(1U, &eax, &ebx, &ecx, &edx) != 0) && ((ecx & bit_SSE4_2) != 0U);
+        }();
+        return supported;
+#else
+        return false;
+#endif
+    }
+
+    [[nodiscard]] static uint32_t computeSoftware(const uint8_t* data, std::size_t size) noexcept {
+        const Tables& tables = getTables();
+        uint32_t crc = 0xFFFFFFFFU;
+        while (size >= 8U) {
+            uint32_t low = 0U;
+            uint32_t high = 0U;
+            std::memcpy(&low, data, sizeof(low));
+            std::memcpy(&high, data + 4, sizeof(high));
+            low ^= crc;
+            crc = tables.slice[7][low & 0xFFU] ^ tables.slice[6][(low >> 8U) & 0xFFU] ^
+                  tables.slice[5][(low >> 16U) & 0xFFU] ^ tables.slice[4][low >> 24U] ^
+                  tables.slice[3][high & 0xFFU] ^ tables.slice[2][(high >> 8U) & 0xFFU] ^
+                  tables.slice[1][(high >> 16U) & 0xFFU] ^ tables.slice[0][high >> 24U];
+            data += 8;
+            size -= 8U;
+        }
+        while (size > 0U) {
+            crc = tables.slice[0][(crc ^ *data) & 0xFFU] ^ (crc >> 8U);
+            ++data;
+            --size;
+        }
+        return ~crc;
+    }
+
+#if defined(__x86_64__)
+    __attribute__((target("sse4.2"))) [[nodiscard]] static uint32_t computeHardware(const uint8_t* data,
+                                                                                    std::size_t size) noexcept {
+        uint64_t crc = 0xFFFFFFFFU;
+        while (size >= 8U) {
+            uint64_t word = 0U;
+            std::memcpy(&word, data, sizeof(word));
+            crc = _mm_crc32_u64(crc, word);
+            data += 8;
+            size -= 8U;
+        }
+        uint32_t tail = static_cast<uint32_t>(crc);
+        while (size > 0U) {
+            tail = _mm_crc32_u8(tail, *data);
+            ++data;
+            --size;
+        }
+        return ~tail;
+    }
+#else
+    [[nodiscard]] static uint32_t computeHardware(const uint8_t* data, std::size_t size) noexcept {
+        return computeSoftware(data, size);
+    }
+#endif
+
+private:
+    struct Tables {
+        uint32_t slice[8][256];
+    };
+
+    [[nodiscard]] static const Tables& getTables() noexcept {
+        static const Tables tables = []() {
+            Tables built{};
+            for (uint32_t i = 0U; i < 256U; ++i) {
+                uint32_t crc = i;
+                for (int bit = 0; bit < 8; ++bit) {
+                    crc = ((crc & 1U) != 0U) ? ((crc >> 1U) ^ POLYNOMIAL) : (crc >> 1U);
+                }
+                built.slice[0][i] = crc;
+            }
+            for (uint32_t i = 0U; i < 256U; ++i) {
+                for (int k = 1; k < 8; ++k) {
+                    const uint32_t previous = built.slice[k - 1][i];
+                    built.slice[k][i] = (previous >> 8U) ^ built.slice[0][previous & 0xFFU];
+                }
+            }
+            return built;
+        }();
+        return tables;
+    }
+};
@@ -76,6 +76,19 @@ public:
     bool deserialize(const std::vector<uint8_t>& data) noexcept;
     [[nodiscard]] std::size_t getSerializedSize() const noexcept;
 
+    // Zero-copy Binary Serialization - MISRA compliant
+    /// Writes getSerializedSize() bytes to out and returns that count
+    std::size_t serializeInto(uint8_t* out) const noexcept;
+    bool deserialize(const uint8_t* data, std::size_t size) noexcept;
+
+    // Binary Serialization with CRC32C trailer - MISRA compliant
+    static constexpr std::size_t CHECKSUM_SIZE = 4U;
+    [[nodiscard]] std::vector<uint8_t> serializeWithChecksum() const;
+    /// Writes getSerializedSize() + CHECKSUM_SIZE bytes to out and returns that count
+    std::size_t serializeWithChecksumInto(uint8_t* out) const noexcept;
+    bool deserializeWithChecksum(const std::vector<uint8_t>& data) noexcept;
+    bool deserializeWithChecksum(const uint8_t* data, std::size_t size) noexcept;
+
 private:
     // Member variables
     /// İz için benzersiz tam sayı kimliği
@@ -1,4 +1,5 @@
 #include "FinalCalcTrackData.hpp"
+#include "Crc32c.hpp"
 
 // MISRA C++ 2023 compliant constructor implementation
 FinalCalcTrackData::FinalCalcTrackData() noexcept {
@@ -269,111 +270,90 @@ bool FinalCalcTrackData::isValid() const noexcept {
 
 // MISRA C++ 2023 compliant Binary Serialization Implementation
 std::vector<uint8_t> FinalCalcTrackData::serialize() const {
-    std::vector<uint8_t> buffer;
-    buffer.reserve(getSerializedSize());
+    std::vector<uint8_t> buffer(getSerializedSize());
+    (void)serializeInto(buffer.data());
+    return buffer;
+}
+
+std::size_t FinalCalcTrackData::serializeInto(uint8_t* out) const noexcept {
+    std::size_t offset = 0U;
     
     // Serialize trackId_
-    {
-        const uint8_t* ptr = reinterpret_cast<const uint8_t*>(&trackId_);
-        buffer.insert(buffer.end(), ptr, ptr + sizeof(trackId_));
-    }
+    std::memcpy(&out[offset], &trackId_, sizeof(trackId_));
+    offset += sizeof(trackId_);
     
     // Serialize xVelocityECEF_
-    {
-        const uint8_t* ptr = reinterpret_cast<const uint8_t*>(&xVelocityECEF_);
-        buffer.insert(buffer.end(), ptr, ptr + sizeof(xVelocityECEF_));
-    }
+    std::memcpy(&out[offset], &xVelocityECEF_, sizeof(xVelocityECEF_));
+    offset += sizeof(xVelocityECEF_);
     
     // Serialize yVelocityECEF_
-    {
-        const uint8_t* ptr = reinterpret_cast<const uint8_t*>(&yVelocityECEF_);
-        buffer.insert(buffer.end(), ptr, ptr + sizeof(yVelocityECEF_));
-    }
+    std::memcpy(&out[offset], &yVelocityECEF_, sizeof(yVelocityECEF_));
+    offset += sizeof(yVelocityECEF_);
     
     // Serialize zVelocityECEF_
-    {
-        const uint8_t* ptr = reinterpret_cast<const uint8_t*>(&zVelocityECEF_);
-        buffer.insert(buffer.end(), ptr, ptr + sizeof(zVelocityECEF_));
-    }
+    std::memcpy(&out[offset], &zVelocityECEF_, sizeof(zVelocityECEF_));
+    offset += sizeof(zVelocityECEF_);
     
     // Serialize xPositionECEF_
-    {
-        const uint8_t* ptr = reinterpret_cast<const uint8_t*>(&xPositionECEF_);
-        buffer.insert(buffer.end(), ptr, ptr + sizeof(xPositionECEF_));
-    }
+    std::memcpy(&out[offset], &xPositionECEF_, sizeof(xPositionECEF_));
+    offset += sizeof(xPositionECEF_);
     
     // Serialize yPositionECEF_
-    {
-        const uint8_t* ptr = reinterpret_cast<const uint8_t*>(&yPositionECEF_);
-        buffer.insert(buffer.end(), ptr, ptr + sizeof(yPositionECEF_));
-    }
+    std::memcpy(&out[offset], &yPositionECEF_, sizeof(yPositionECEF_));
+    offset += sizeof(yPositionECEF_);
     
     // Serialize zPositionECEF_
-    {
-        const uint8_t* ptr = reinterpret_cast<const uint8_t*>(&zPositionECEF_);
-        buffer.insert(buffer.end(), ptr, ptr + sizeof(zPositionECEF_));
-    }
+    std::memcpy(&out[offset], &zPositionECEF_, sizeof(zPositionECEF_));
+    offset += sizeof(zPositionECEF_);
     
     // Serialize originalUpdateTime_
-    {
-        const uint8_t* ptr = reinterpret_cast<const uint8_t*>(&originalUpdateTime_);
-        buffer.insert(buffer.end(), ptr, ptr + sizeof(originalUpdateTime_));
-    }
+    std::memcpy(&out[offset], &originalUpdateTime_, sizeof(originalUpdateTime_));
+    offset += sizeof(originalUpdateTime_);
     
     // Serialize updateTime_
-    {
-        const uint8_t* ptr = reinterpret_cast<const uint8_t*>(&updateTime_);
-        buffer.insert(buffer.end(), ptr, ptr + sizeof(updateTime_));
-    }
+    std::memcpy(&out[offset], &updateTime_, sizeof(updateTime_));
+    offset += sizeof(updateTime_);
     
     // Serialize firstHopSentTime_
-    {
-        const uint8_t* ptr = reinterpret_cast<const uint8_t*>(&firstHopSentTime_);
-        buffer.insert(buffer.end(), ptr, ptr + sizeof(firstHopSentTime_));
-    }
+    std::memcpy(&out[offset], &firstHopSentTime_, sizeof(firstHopSentTime_));
+    offset += sizeof(firstHopSentTime_);
     
     // Serialize firstHopDelayTime_
-    {
-        const uint8_t* ptr = reinterpret_cast<const uint8_t*>(&firstHopDelayTime_);
-        buffer.insert(buffer.end(), ptr, ptr + sizeof(firstHopDelayTime_));
-    }
+    std::memcpy(&out[offset], &firstHopDelayTime_, sizeof(firstHopDelayTime_));
+    offset += sizeof(firstHopDelayTime_);
     
     // Serialize secondHopSentTime_
-    {
-        const uint8_t* ptr = reinterpret_cast<const uint8_t*>(&secondHopSentTime_);
-        buffer.insert(buffer.end(), ptr, ptr + sizeof(secondHopSentTime_));
-    }
+    std::memcpy(&out[offset], &secondHopSentTime_, sizeof(secondHopSentTime_));
+    offset += sizeof(secondHopSentTime_);
     
     // Serialize secondHopDelayTime_
-    {
-        const uint8_t* ptr = reinterpret_cast<const uint8_t*>(&secondHopDelayTime_);
-        buffer.insert(buffer.end(), ptr, ptr + sizeof(secondHopDelayTime_));
-    }
+    std::memcpy(&out[offset], &secondHopDelayTime_, sizeof(secondHopDelayTime_));
+    offset += sizeof(secondHopDelayTime_);
     
     // Serialize totalDelayTime_
-    {
-        const uint8_t* ptr = reinterpret_cast<const uint8_t*>(&totalDelayTime_);
-        buffer.insert(buffer.end(), ptr, ptr + sizeof(totalDelayTime_));
-    }
+    std::memcpy(&out[offset], &totalDelayTime_, sizeof(totalDelayTime_));
+    offset += sizeof(totalDelayTime_);
     
     // Serialize thirdHopSentTime_
-    {
-        const uint8_t* ptr = reinterpret_cast<const uint8_t*>(&thirdHopSentTime_);
-        buffer.insert(buffer.end(), ptr, ptr + sizeof(thirdHopSentTime_));
-    }
+    std::memcpy(&out[offset], &thirdHopSentTime_, sizeof(thirdHopSentTime_));
+    offset += sizeof(thirdHopSentTime_);
     
-    return buffer;
+    return offset;
 }
 
 bool FinalCalcTrackData::deserialize(const std::vector<uint8_t>& data) noexcept {
-    if (data.size() < getSerializedSize()) {
+    return deserialize(data.data(), data.size());
+}
+
+bool FinalCalcTrackData::deserialize(const uint8_t* data, std::size_t size) noexcept {
+    if (size < getSerializedSize()) {
         return false;
     }
     
     std::size_t offset = 0U;
     
     // Deserialize trackId_
-    if (offset + sizeof(trackId_) <= data.size()) {
+    if (offset + sizeof(trackId_) <= size) {
         std::memcpy(&trackId_, &data[offset], sizeof(trackId_));
         offset += sizeof(trackId_);
     } else {
@@ -381,7 +361,7 @@ bool FinalCalcTrackData::deserialize(const std::vector<uint8_t>& data) noexcept
     }
     
     // Deserialize xVelocityECEF_
-    if (offset + sizeof(xVelocityECEF_) <= data.size()) {
+    if (offset + sizeof(xVelocityECEF_) <= size) {
         std::memcpy(&xVelocityECEF_, &data[offset], sizeof(xVelocityECEF_));
         offset += sizeof(xVelocityECEF_);
     } else {
@@ -389,7 +369,7 @@ bool FinalCalcTrackData::deserialize(const std::vector<uint8_t>& data) noexcept
     }
     
     // Deserialize yVelocityECEF_
-    if (offset + sizeof(yVelocityECEF_) <= data.size()) {
+    if (offset + sizeof(yVelocityECEF_) <= size) {
         std::memcpy(&yVelocityECEF_, &data[offset], sizeof(yVelocityECEF_));
         offset += sizeof(yVelocityECEF_);
     } else {
@@ -397,7 +377,7 @@ bool FinalCalcTrackData::deserialize(const std::vector<uint8_t>& data) noexcept
     }
     
     // Deserialize zVelocityECEF_
-    if (offset + sizeof(zVelocityECEF_) <= data.size()) {
+    if (offset + sizeof(zVelocityECEF_) <= size) {
         std::memcpy(&zVelocityECEF_, &data[offset], sizeof(zVelocityECEF_));
         offset += sizeof(zVelocityECEF_);
     } else {
@@ -405,7 +385,7 @@ bool FinalCalcTrackData::deserialize(const std::vector<uint8_t>& data) noexcept
     }
     
     // Deserialize xPositionECEF_
-    if (offset + sizeof(xPositionECEF_) <= data.size()) {
+    if (offset + sizeof(xPositionECEF_) <= size) {
         std::memcpy(&xPositionECEF_, &data[offset], sizeof(xPositionECEF_));
         offset += sizeof(xPositionECEF_);
     } else {
@@ -413,7 +393,7 @@ bool FinalCalcTrackData::deserialize(const std::vector<uint8_t>& data) noexcept
     }
     
     // Deserialize yPositionECEF_
-    if (offset + sizeof(yPositionECEF_) <= data.size()) {
+    if (offset + sizeof(yPositionECEF_) <= size) {
         std::memcpy(&yPositionECEF_, &data[offset], sizeof(yPositionECEF_));
         offset += sizeof(yPositionECEF_);
     } else {
@@ -421,7 +401,7 @@ bool FinalCalcTrackData::deserialize(const std::vector<uint8_t>& data) noexcept
     }
     
     // Deserialize zPositionECEF_
-    if (offset + sizeof(zPositionECEF_) <= data.size()) {
+    if (offset + sizeof(zPositionECEF_) <= size) {
         std::memcpy(&zPositionECEF_, &data[offset], sizeof(zPositionECEF_));
         offset += sizeof(zPositionECEF_);
     } else {
@@ -429,7 +409,7 @@ bool FinalCalcTrackData::deserialize(const std::vector<uint8_t>& data) noexcept
     }
     
     // Deserialize originalUpdateTime_
-    if (offset + sizeof(originalUpdateTime_) <= data.size()) {
+    if (offset + sizeof(originalUpdateTime_) <= size) {
         std::memcpy(&originalUpdateTime_, &data[offset], sizeof(originalUpdateTime_));
         offset += sizeof(originalUpdateTime_);
     } else {
@@ -437,7 +417,7 @@ bool FinalCalcTrackData::deserialize(const std::vector<uint8_t>& data) noexcept
     }
     
     // Deserialize updateTime_
-    if (offset + sizeof(updateTime_) <= data.size()) {
+    if (offset + sizeof(updateTime_) <= size) {
         std::memcpy(&updateTime_, &data[offset], sizeof(updateTime_));
         offset += sizeof(updateTime_);
     } else {
@@ -445,7 +425,7 @@ bool FinalCalcTrackData::deserialize(const std::vector<uint8_t>& data) noexcept
     }
     
     // Deserialize firstHopSentTime_
-    if (offset + sizeof(firstHopSentTime_) <= data.size()) {
+    if (offset + sizeof(firstHopSentTime_) <= size) {
         std::memcpy(&firstHopSentTime_, &data[offset], sizeof(firstHopSentTime_));
         offset += sizeof(firstHopSentTime_);
     } else {
@@ -453,7 +433,7 @@ bool FinalCalcTrackData::deserialize(const std::vector<uint8_t>& data) noexcept
     }
     
     // Deserialize firstHopDelayTime_
-    if (offset + sizeof(firstHopDelayTime_) <= data.size()) {
+    if (offset + sizeof(firstHopDelayTime_) <= size) {
         std::memcpy(&firstHopDelayTime_, &data[offset], sizeof(firstHopDelayTime_));
         offset += sizeof(firstHopDelayTime_);
     } else {
@@ -461,7 +441,7 @@ bool FinalCalcTrackData::deserialize(const std::vector<uint8_t>& data) noexcept
     }
     
     // Deserialize secondHopSentTime_
-    if (offset + sizeof(secondHopSentTime_) <= data.size()) {
+    if (offset + sizeof(secondHopSentTime_) <= size) {
         std::memcpy(&secondHopSentTime_, &data[offset], sizeof(secondHopSentTime_));
         offset += sizeof(secondHopSentTime_);
     } else {
@@ -469,7 +449,7 @@ bool FinalCalcTrackData::deserialize(const std::vector<uint8_t>& data) noexcept
     }
     
     // Deserialize secondHopDelayTime_
-    if (offset + sizeof(secondHopDelayTime_) <= data.size()) {
+    if (offset + sizeof(secondHopDelayTime_) <= size) {
         std::memcpy(&secondHopDelayTime_, &data[offset], sizeof(secondHopDelayTime_));
         offset += sizeof(secondHopDelayTime_);
     } else {
@@ -477,7 +457,7 @@ bool FinalCalcTrackData::deserialize(const std::vector<uint8_t>& data) noexcept
     }
     
     // Deserialize totalDelayTime_
-    if (offset + sizeof(totalDelayTime_) <= data.size()) {
+    if (offset + sizeof(totalDelayTime_) <= size) {
         std::memcpy(&totalDelayTime_, &data[offset], sizeof(totalDelayTime_));
         offset += sizeof(totalDelayTime_);
     } else {
@@ -485,7 +465,7 @@ bool FinalCalcTrackData::deserialize(const std::vector<uint8_t>& data) noexcept
     }
     
     // Deserialize thirdHopSentTime_
-    if (offset + sizeof(thirdHopSentTime_) <= data.size()) {
+    if (offset + sizeof(thirdHopSentTime_) <= size) {
         std::memcpy(&thirdHopSentTime_, &data[offset], sizeof(thirdHopSentTime_));
         offset += sizeof(thirdHopSentTime_);
     } else {
@@ -516,3 +496,36 @@ std::size_t FinalCalcTrackData::getSerializedSize() const noexcept {
     
     return size;
 }
+
+std::vector<uint8_t> FinalCalcTrackData::serializeWithChecksum() const {
+    std::vector<uint8_t> buffer(getSerializedSize() + CHECKSUM_SIZE);
+    (void)serializeWithChecksumInto(buffer.data());
+    return buffer;
+}
+
+std::size_t FinalCalcTrackData::serializeWithChecksumInto(uint8_t* out) const noexcept {
+    const std::size_t size = serializeInto(out);
+    const uint32_t checksum = Crc32c::compute(out, size);
+    std::memcpy(&out[size], &checksum, sizeof(checksum));
+    return size + sizeof(checksum);
+}
+
+bool FinalCalcTrackData::deserializeWithChecksum(const std::vector<uint8_t>& data) noexcept {
+    return deserializeWithChecksum(data.data(), data.size());
+}
+
+bool FinalCalcTrackData::deserializeWithChecksum(const uint8_t* data, std::size_t size) noexcept {
+    if (size < CHECKSUM_SIZE) {
+        return false;
+    }
+    
+    const std::size_t payloadSize = size - CHECKSUM_SIZE;
+    uint32_t checksum{0U};
+    std::memcpy(&checksum, &data[payloadSize], sizeof(checksum));
+    if (checksum != Crc32c::compute(data, payloadSize)) {
+        return false;
+    }
+    
+    // Check the size first so a rejected record leaves the object untouched
+    return (getSerializedSize() == payloadSize) && deserialize(data, payloadSize);
+}
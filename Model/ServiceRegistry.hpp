@@ -0,0 +1,105 @@
+#pragma once
+
+// MISRA C++ 2023 compliant includes
+#include <cstddef>
+#include <cstring>
+#include <tuple>
+
+#include "DelayCalcTrackData.hpp"
+#include "ExtrapTrackData.hpp"
+#include "FinalCalcTrackData.hpp"
+#include "ProcessedTrackData.hpp"
+#include "TrackStatics.hpp"
+#include "TrackStaticsPercentiles.hpp"
+
+/**
+ * @brief Endpoint of one message type, taken from its x-service-metadata block.
+ * The RADIO/DISH group equals the schema title.
+ * Auto-generated from the zmq_messages schemas by generate_simple_models.sh
+ */
+struct ServiceDescriptor final {
+    const char* name;
+    const char* group;
+    const char* protocol;
+    const char* multicastAddress;
+    int port;
+    std::size_t index;
+};
+
+/// Number of message types with a service endpoint
+constexpr std::size_t SERVICE_COUNT = 6U;
+
+/// All service endpoints, ordered by schema file name
+inline constexpr ServiceDescriptor SERVICE_REGISTRY[SERVICE_COUNT] = {
+    {"DelayCalcTrackData", "DelayCalcTrackData", "udp", "239.1.1.5", 9595, 0U},
+    {"ExtrapTrackData", "ExtrapTrackData", "udp", "239.1.1.5", 9596, 1U},
+    {"FinalCalcTrackData", "FinalCalcTrackData", "udp", "239.1.1.5", 9597, 2U},
+    {"ProcessedTrackData", "ProcessedTrackData", "udp", "239.1.1.5", 9598, 3U},
+    {"TrackStatics", "TrackStatics", "udp", "239.1.1.5", 9599, 4U},
+    {"TrackStaticsPercentiles", "TrackStaticsPercentiles", "udp", "239.1.1.5", 9600, 5U},
+};
+
+/// Looks a service up by message type name; nullptr when unknown
+inline const ServiceDescriptor* findService(const char* name) noexcept {
+    for (const ServiceDescriptor& service : SERVICE_REGISTRY) {
+        if (std::strcmp(service.name, name) == 0) {
+            return &service;
+        }
+    }
+    return nullptr;
+}
+
+/**
+ * @brief Compile-time registry entry of a generated message type.
+ * INDEX addresses per-type state such as publisher sequence numbers.
+ */
+template <typename T>
+struct ServiceTraits;
+
+template <>
+struct ServiceTraits<DelayCalcTrackData> {
+    static constexpr const char* GROUP = "DelayCalcTrackData";
+    static constexpr std::size_t INDEX = 0U;
+    static constexpr const ServiceDescriptor& DESCRIPTOR = SERVICE_REGISTRY[0U];
+};
+
+template <>
+struct ServiceTraits<ExtrapTrackData> {
+    static constexpr const char* GROUP = "ExtrapTrackData";
+    static constexpr std::size_t INDEX = 1U;
+    static constexpr const ServiceDescriptor& DESCRIPTOR = SERVICE_REGISTRY[1U];
+};
+
+template <>
+struct ServiceTraits<FinalCalcTrackData> {
+    static constexpr const char* GROUP = "FinalCalcTrackData";
+    static constexpr std::size_t INDEX = 2U;
+    static constexpr const ServiceDescriptor& DESCRIPTOR = SERVICE_REGISTRY[2U];
+};
+
+template <>
+struct ServiceTraits<ProcessedTrackData> {
+    static constexpr const char* GROUP = "ProcessedTrackData";
+    static constexpr std::size_t INDEX = 3U;
+    static constexpr const ServiceDescriptor& DESCRIPTOR = SERVICE_REGISTRY[3U];
+};
+
+template <>
+struct ServiceTraits<TrackStatics> {
+    static constexpr const char* GROUP = "TrackStatics";
+    static constexpr std::size_t INDEX = 4U;
+    static constexpr const ServiceDescriptor& DESCRIPTOR = SERVICE_REGISTRY[4U];
+};
+
+template <>
+struct ServiceTraits<TrackStaticsPercentiles> {
+    static constexpr const char* GROUP = "TrackStaticsPercentiles";
+    static constexpr std::size_t INDEX = 5U;
+    static constexpr const ServiceDescriptor& DESCRIPTOR = SERVICE_REGISTRY[5U];
+};
+
+/// Every message type with a service endpoint, in SERVICE_REGISTRY order
+using ServiceTypes = std::tuple<DelayCalcTrackData, ExtrapTrackData, FinalCalcTrackData, ProcessedTrackData,
+                                TrackStatics, TrackStaticsPercentiles>;
+
+static_assert(std::tuple_size<ServiceTypes>::value == SERVICE_COUNT, "ServiceTypes must list every service");
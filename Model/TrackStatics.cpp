@@ -1,4 +1,5 @@
 #include "TrackStatics.hpp"
+#include "Crc32c.hpp"
 
 // MISRA C++ 2023 compliant constructor implementation
 TrackStatics::TrackStatics() noexcept {
@@ -252,105 +253,86 @@ bool TrackStatics::isValid() const noexcept {
 
 // MISRA C++ 2023 compliant Binary Serialization Implementation
 std::vector<uint8_t> TrackStatics::serialize() const {
-    std::vector<uint8_t> buffer;
-    buffer.reserve(getSerializedSize());
+    std::vector<uint8_t> buffer(getSerializedSize());
+    (void)serializeInto(buffer.data());
+    return buffer;
+}
+
+std::size_t TrackStatics::serializeInto(uint8_t* out) const noexcept {
+    std::size_t offset = 0U;
     
     // Serialize trackId_
-    {
-        const uint8_t* ptr = reinterpret_cast<const uint8_t*>(&trackId_);
-        buffer.insert(buffer.end(), ptr, ptr + sizeof(trackId_));
-    }
+    std::memcpy(&out[offset], &trackId_, sizeof(trackId_));
+    offset += sizeof(trackId_);
     
     // Serialize firstHopDelayDataMean_
-    {
-        const uint8_t* ptr = reinterpret_cast<const uint8_t*>(&firstHopDelayDataMean_);
-        buffer.insert(buffer.end(), ptr, ptr + sizeof(firstHopDelayDataMean_));
-    }
+    std::memcpy(&out[offset], &firstHopDelayDataMean_, sizeof(firstHopDelayDataMean_));
+    offset += sizeof(firstHopDelayDataMean_);
     
     // Serialize firstHopDelayDataStd_
-    {
-        const uint8_t* ptr = reinterpret_cast<const uint8_t*>(&firstHopDelayDataStd_);
-        buffer.insert(buffer.end(), ptr, ptr + sizeof(firstHopDelayDataStd_));
-    }
+    std::memcpy(&out[offset], &firstHopDelayDataStd_, sizeof(firstHopDelayDataStd_));
+    offset += sizeof(firstHopDelayDataStd_);
     
     // Serialize firstHopDelayDataMin_
-    {
-        const uint8_t* ptr = reinterpret_cast<const uint8_t*>(&firstHopDelayDataMin_);
-        buffer.insert(buffer.end(), ptr, ptr + sizeof(firstHopDelayDataMin_));
-    }
+    std::memcpy(&out[offset], &firstHopDelayDataMin_, sizeof(firstHopDelayDataMin_));
+    offset += sizeof(firstHopDelayDataMin_);
     
     // Serialize firstHopDelayDataMax_
-    {
-        const uint8_t* ptr = reinterpret_cast<const uint8_t*>(&firstHopDelayDataMax_);
-        buffer.insert(buffer.end(), ptr, ptr + sizeof(firstHopDelayDataMax_));
-    }
+    std::memcpy(&out[offset], &firstHopDelayDataMax_, sizeof(firstHopDelayDataMax_));
+    offset += sizeof(firstHopDelayDataMax_);
     
     // Serialize secondHopDelayDataMean_
-    {
-        const uint8_t* ptr = reinterpret_cast<const uint8_t*>(&secondHopDelayDataMean_);
-        buffer.insert(buffer.end(), ptr, ptr + sizeof(secondHopDelayDataMean_));
-    }
+    std::memcpy(&out[offset], &secondHopDelayDataMean_, sizeof(secondHopDelayDataMean_));
+    offset += sizeof(secondHopDelayDataMean_);
     
     // Serialize secondHopDelayDataStd_
-    {
-        const uint8_t* ptr = reinterpret_cast<const uint8_t*>(&secondHopDelayDataStd_);
-        buffer.insert(buffer.end(), ptr, ptr + sizeof(secondHopDelayDataStd_));
-    }
+    std::memcpy(&out[offset], &secondHopDelayDataStd_, sizeof(secondHopDelayDataStd_));
+    offset += sizeof(secondHopDelayDataStd_);
     
     // Serialize secondHopDelayDataMin_
-    {
-        const uint8_t* ptr = reinterpret_cast<const uint8_t*>(&secondHopDelayDataMin_);
-        buffer.insert(buffer.end(), ptr, ptr + sizeof(secondHopDelayDataMin_));
-    }
+    std::memcpy(&out[offset], &secondHopDelayDataMin_, sizeof(secondHopDelayDataMin_));
+    offset += sizeof(secondHopDelayDataMin_);
     
     // Serialize secondHopDelayDataMax_
-    {
-        const uint8_t* ptr = reinterpret_cast<const uint8_t*>(&secondHopDelayDataMax_);
-        buffer.insert(buffer.end(), ptr, ptr + sizeof(secondHopDelayDataMax_));
-    }
+    std::memcpy(&out[offset], &secondHopDelayDataMax_, sizeof(secondHopDelayDataMax_));
+    offset += sizeof(secondHopDelayDataMax_);
     
     // Serialize totalHopDelayDataMean_
-    {
-        const uint8_t* ptr = reinterpret_cast<const uint8_t*>(&totalHopDelayDataMean_);
-        buffer.insert(buffer.end(), ptr, ptr + sizeof(totalHopDelayDataMean_));
-    }
+    std::memcpy(&out[offset], &totalHopDelayDataMean_, sizeof(totalHopDelayDataMean_));
+    offset += sizeof(totalHopDelayDataMean_);
     
     // Serialize totalHopDelayDataStd_
-    {
-        const uint8_t* ptr = reinterpret_cast<const uint8_t*>(&totalHopDelayDataStd_);
-        buffer.insert(buffer.end(), ptr, ptr + sizeof(totalHopDelayDataStd_));
-    }
+    std::memcpy(&out[offset], &totalHopDelayDataStd_, sizeof(totalHopDelayDataStd_));
+    offset += sizeof(totalHopDelayDataStd_);
     
     // Serialize totalHopDelayDataMin_
-    {
-        const uint8_t* ptr = reinterpret_cast<const uint8_t*>(&totalHopDelayDataMin_);
-        buffer.insert(buffer.end(), ptr, ptr + sizeof(totalHopDelayDataMin_));
-    }
+    std::memcpy(&out[offset], &totalHopDelayDataMin_, sizeof(totalHopDelayDataMin_));
+    offset += sizeof(totalHopDelayDataMin_);
     
     // Serialize totalHopDelayDataMax_
-    {
-        const uint8_t* ptr = reinterpret_cast<const uint8_t*>(&totalHopDelayDataMax_);
-        buffer.insert(buffer.end(), ptr, ptr + sizeof(totalHopDelayDataMax_));
-    }
+    std::memcpy(&out[offset], &totalHopDelayDataMax_, sizeof(totalHopDelayDataMax_));
+    offset += sizeof(totalHopDelayDataMax_);
     
     // Serialize updateTime_
-    {
-        const uint8_t* ptr = reinterpret_cast<const uint8_t*>(&updateTime_);
-        buffer.insert(buffer.end(), ptr, ptr + sizeof(updateTime_));
-    }
+    std::memcpy(&out[offset], &updateTime_, sizeof(updateTime_));
+    offset += sizeof(updateTime_);
     
-    return buffer;
+    return offset;
 }
 
 bool TrackStatics::deserialize(const std::vector<uint8_t>& data) noexcept {
-    if (data.size() < getSerializedSize()) {
+    return deserialize(data.data(), data.size());
+}
+
+bool TrackStatics::deserialize(const uint8_t* data, std::size_t size) noexcept {
+    if (size < getSerializedSize()) {
         return false;
     }
     
     std::size_t offset = 0U;
     
     // Deserialize trackId_
-    if (offset + sizeof(trackId_) <= data.size()) {
+    if (offset + sizeof(trackId_) <= size) {
         std::memcpy(&trackId_, &data[offset], sizeof(trackId_));
         offset += sizeof(trackId_);
     } else {
@@ -358,7 +340,7 @@ bool TrackStatics::deserialize(const std::vector<uint8_t>& data) noexcept {
     }
     
     // Deserialize firstHopDelayDataMean_
-    if (offset + sizeof(firstHopDelayDataMean_) <= data.size()) {
+    if (offset + sizeof(firstHopDelayDataMean_) <= size) {
         std::memcpy(&firstHopDelayDataMean_, &data[offset], sizeof(firstHopDelayDataMean_));
         offset += sizeof(firstHopDelayDataMean_);
     } else {
@@ -366,7 +348,7 @@ bool TrackStatics::deserialize(const std::vector<uint8_t>& data) noexcept {
     }
     
     // Deserialize firstHopDelayDataStd_
-    if (offset + sizeof(firstHopDelayDataStd_) <= data.size()) {
+    if (offset + sizeof(firstHopDelayDataStd_) <= size) {
         std::memcpy(&firstHopDelayDataStd_, &data[offset], sizeof(firstHopDelayDataStd_));
         offset += sizeof(firstHopDelayDataStd_);
     } else {
@@ -374,7 +356,7 @@ bool TrackStatics::deserialize(const std::vector<uint8_t>& data) noexcept {
     }
     
     // Deserialize firstHopDelayDataMin_
-    if (offset + sizeof(firstHopDelayDataMin_) <= data.size()) {
+    if (offset + sizeof(firstHopDelayDataMin_) <= size) {
         std::memcpy(&firstHopDelayDataMin_, &data[offset], sizeof(firstHopDelayDataMin_));
         offset += sizeof(firstHopDelayDataMin_);
     } else {
@@ -382,7 +364,7 @@ bool TrackStatics::deserialize(const std::vector<uint8_t>& data) noexcept {
     }
     
     // Deserialize firstHopDelayDataMax_
-    if (offset + sizeof(firstHopDelayDataMax_) <= data.size()) {
+    if (offset + sizeof(firstHopDelayDataMax_) <= size) {
         std::memcpy(&firstHopDelayDataMax_, &data[offset], sizeof(firstHopDelayDataMax_));
         offset += sizeof(firstHopDelayDataMax_);
     } else {
@@ -390,7 +372,7 @@ bool TrackStatics::deserialize(const std::vector<uint8_t>& data) noexcept {
     }
     
     // Deserialize secondHopDelayDataMean_
-    if (offset + sizeof(secondHopDelayDataMean_) <= data.size()) {
+    if (offset + sizeof(secondHopDelayDataMean_) <= size) {
         std::memcpy(&secondHopDelayDataMean_, &data[offset], sizeof(secondHopDelayDataMean_));
         offset += sizeof(secondHopDelayDataMean_);
     } else {
@@ -398,7 +380,7 @@ bool TrackStatics::deserialize(const std::vector<uint8_t>& data) noexcept {
     }
     
     // Deserialize secondHopDelayDataStd_
-    if (offset + sizeof(secondHopDelayDataStd_) <= data.size()) {
+    if (offset + sizeof(secondHopDelayDataStd_) <= size) {
         std::memcpy(&secondHopDelayDataStd_, &data[offset], sizeof(secondHopDelayDataStd_));
         offset += sizeof(secondHopDelayDataStd_);
     } else {
@@ -406,7 +388,7 @@ bool TrackStatics::deserialize(const std::vector<uint8_t>& data) noexcept {
     }
     
     // Deserialize secondHopDelayDataMin_
-    if (offset + sizeof(secondHopDelayDataMin_) <= data.size()) {
+    if (offset + sizeof(secondHopDelayDataMin_) <= size) {
         std::memcpy(&secondHopDelayDataMin_, &data[offset], sizeof(secondHopDelayDataMin_));
         offset += sizeof(secondHopDelayDataMin_);
     } else {
@@ -414,7 +396,7 @@ bool TrackStatics::deserialize(const std::vector<uint8_t>& data) noexcept {
     }
     
     // Deserialize secondHopDelayDataMax_
-    if (offset + sizeof(secondHopDelayDataMax_) <= data.size()) {
+    if (offset + sizeof(secondHopDelayDataMax_) <= size) {
         std::memcpy(&secondHopDelayDataMax_, &data[offset], sizeof(secondHopDelayDataMax_));
         offset += sizeof(secondHopDelayDataMax_);
     } else {
@@ -422,7 +404,7 @@ bool TrackStatics::deserialize(const std::vector<uint8_t>& data) noexcept {
     }
     
     // Deserialize totalHopDelayDataMean_
-    if (offset + sizeof(totalHopDelayDataMean_) <= data.size()) {
+    if (offset + sizeof(totalHopDelayDataMean_) <= size) {
         std::memcpy(&totalHopDelayDataMean_, &data[offset], sizeof(totalHopDelayDataMean_));
         offset += sizeof(totalHopDelayDataMean_);
     } else {
@@ -430,7 +412,7 @@ bool TrackStatics::deserialize(const std::vector<uint8_t>& data) noexcept {
     }
     
     // Deserialize totalHopDelayDataStd_
-    if (offset + sizeof(totalHopDelayDataStd_) <= data.size()) {
+    if (offset + sizeof(totalHopDelayDataStd_) <= size) {
         std::memcpy(&totalHopDelayDataStd_, &data[offset], sizeof(totalHopDelayDataStd_));
         offset += sizeof(totalHopDelayDataStd_);
     } else {
@@ -438,7 +420,7 @@ bool TrackStatics::deserialize(const std::vector<uint8_t>& data) noexcept {
     }
     
     // Deserialize totalHopDelayDataMin_
-    if (offset + sizeof(totalHopDelayDataMin_) <= data.size()) {
+    if (offset + sizeof(totalHopDelayDataMin_) <= size) {
         std::memcpy(&totalHopDelayDataMin_, &data[offset], sizeof(totalHopDelayDataMin_));
         offset += sizeof(totalHopDelayDataMin_);
     } else {
@@ -446,7 +428,7 @@ bool TrackStatics::deserialize(const std::vector<uint8_t>& data) noexcept {
     }
     
     // Deserialize totalHopDelayDataMax_
-    if (offset + sizeof(totalHopDelayDataMax_) <= data.size()) {
+    if (offset + sizeof(totalHopDelayDataMax_) <= size) {
         std::memcpy(&totalHopDelayDataMax_, &data[offset], sizeof(totalHopDelayDataMax_));
         offset += sizeof(totalHopDelayDataMax_);
     } else {
@@ -454,7 +436,7 @@ bool TrackStatics::deserialize(const std::vector<uint8_t>& data) noexcept {
     }
     
     // Deserialize updateTime_
-    if (offset + sizeof(updateTime_) <= data.size()) {
+    if (offset + sizeof(updateTime_) <= size) {
         std::memcpy(&updateTime_, &data[offset], sizeof(updateTime_));
         offset += sizeof(updateTime_);
     } else {
@@ -484,3 +466,36 @@ std::size_t TrackStatics::getSerializedSize() const noexcept {
     
     return size;
 }
+
+std::vector<uint8_t> TrackStatics::serializeWithChecksum() const {
+    std::vector<uint8_t> buffer(getSerializedSize() + CHECKSUM_SIZE);
+    (void)serializeWithChecksumInto(buffer.data());
+    return buffer;
+}
+
+std::size_t TrackStatics::serializeWithChecksumInto(uint8_t* out) const noexcept {
+    const std::size_t size = serializeInto(out);
+    const uint32_t checksum = Crc32c::compute(out, size);
+    std::memcpy(&out[size], &checksum, sizeof(checksum));
+    return size + sizeof(checksum);
+}
+
+bool TrackStatics::deserializeWithChecksum(const std::vector<uint8_t>& data) noexcept {
+    return deserializeWithChecksum(data.data(), data.size());
+}
+
+bool TrackStatics::deserializeWithChecksum(const uint8_t* data, std::size_t size) noexcept {
+    if (size < CHECKSUM_SIZE) {
+        return false;
+    }
+    
+    const std::size_t payloadSize = size - CHECKSUM_SIZE;
+    uint32_t checksum{0U};
+    std::memcpy(&checksum, &data[payloadSize], sizeof(checksum));
+    if (checksum != Crc32c::compute(data, payloadSize)) {
+        return false;
+    }
+    
+    // Check the size first so a rejected record leaves the object untouched
+    return (getSerializedSize() == payloadSize) && deserialize(data, payloadSize);
+}
@@ -0,0 +1,531 @@
+#include "TrackStaticsPercentiles.hpp"
+#include "Crc32c.hpp"
+
+// MISRA C++ 2023 compliant constructor implementation
+TrackStaticsPercentiles::TrackStaticsPercentiles() noexcept {
+    trackId_ = static_cast<uint32_t>(0);
+    sampleCount_ = static_cast<uint32_t>(0);
+    firstHopDelayDataP50_ = static_cast<float>(0);
+    firstHopDelayDataP90_ = static_cast<float>(0);
+    firstHopDelayDataP99_ = static_cast<float>(0);
+    firstHopDelayDataP999_ = static_cast<float>(0);
+    secondHopDelayDataP50_ = static_cast<float>(0);
+    secondHopDelayDataP90_ = static_cast<float>(0);
+    secondHopDelayDataP99_ = static_cast<float>(0);
+    secondHopDelayDataP999_ = static_cast<float>(0);
+    totalHopDelayDataP50_ = static_cast<float>(0);
+    totalHopDelayDataP90_ = static_cast<float>(0);
+    totalHopDelayDataP99_ = static_cast<float>(0);
+    totalHopDelayDataP999_ = static_cast<float>(0);
+    updateTime_ = static_cast<uint32_t>(0);
+}
+
+    void TrackStaticsPercentiles::validateTrackId(int64_t value) const {
+        if (value < -9223372036854775808LL || value > 9223372036854775807LL) {
+            throw std::out_of_range("TrackId value is out of valid range: " + std::to_string(value));
+        }
+    }
+
+    void TrackStaticsPercentiles::validateSampleCount(uint32_t value) const {
+        if (value > 4294967295U) {
+            throw std::out_of_range("SampleCount value is out of valid range: " + std::to_string(value));
+        }
+    }
+
+    void TrackStaticsPercentiles::validateFirstHopDelayDataP50(double value) const {
+        if (std::isnan(value) || value < 0 || value > 1.0E+6) {
+            throw std::out_of_range("FirstHopDelayDataP50 value is out of valid range: " + std::to_string(value));
+        }
+    }
+
+    void TrackStaticsPercentiles::validateFirstHopDelayDataP90(double value) const {
+        if (std::isnan(value) || value < 0 || value > 1.0E+6) {
+            throw std::out_of_range("FirstHopDelayDataP90 value is out of valid range: " + std::to_string(value));
+        }
+    }
+
+    void TrackStaticsPercentiles::validateFirstHopDelayDataP99(double value) const {
+        if (std::isnan(value) || value < 0 || value > 1.0E+6) {
+            throw std::out_of_range("FirstHopDelayDataP99 value is out of valid range: " + std::to_string(value));
+        }
+    }
+
+    void TrackStaticsPercentiles::validateFirstHopDelayDataP999(double value) const {
+        if (std::isnan(value) || value < 0 || value > 1.0E+6) {
+            throw std::out_of_range("FirstHopDelayDataP999 value is out of valid range: " + std::to_string(value));
+        }
+    }
+
+    void TrackStaticsPercentiles::validateSecondHopDelayDataP50(double value) const {
+        if (std::isnan(value) || value < 0 || value > 1.0E+6) {
+            throw std::out_of_range("SecondHopDelayDataP50 value is out of valid range: " + std::to_string(value));
+        }
+    }
+
+    void TrackStaticsPercentiles::validateSecondHopDelayDataP90(double value) const {
+        if (std::isnan(value) || value < 0 || value > 1.0E+6) {
+            throw std::out_of_range("SecondHopDelayDataP90 value is out of valid range: " + std::to_string(value));
+        }
+    }
+
+    void TrackStaticsPercentiles::validateSecondHopDelayDataP99(double value) const {
+        if (std::isnan(value) || value < 0 || value > 1.0E+6) {
+            throw std::out_of_range("SecondHopDelayDataP99 value is out of valid range: " + std::to_string(value));
+        }
+    }
+
+    void TrackStaticsPercentiles::validateSecondHopDelayDataP999(double value) const {
+        if (std::isnan(value) || value < 0 || value > 1.0E+6) {
+            throw std::out_of_range("SecondHopDelayDataP999 value is out of valid range: " + std::to_string(value));
+        }
+    }
+
+    void TrackStaticsPercentiles::validateTotalHopDelayDataP50(double value) const {
+        if (std::isnan(value) || value < 0 || value > 1.0E+6) {
+            throw std::out_of_range("TotalHopDelayDataP50 value is out of valid range: " + std::to_string(value));
+        }
+    }
+
+    void TrackStaticsPercentiles::validateTotalHopDelayDataP90(double value) const {
+        if (std::isnan(value) || value < 0 || value > 1.0E+6) {
+            throw std::out_of_range("TotalHopDelayDataP90 value is out of valid range: " + std::to_string(value));
+        }
+    }
+
+    void TrackStaticsPercentiles::validateTotalHopDelayDataP99(double value) const {
+        if (std::isnan(value) || value < 0 || value > 1.0E+6) {
+            throw std::out_of_range("TotalHopDelayDataP99 value is out of valid range: " + std::to_string(value));
+        }
+    }
+
+    void TrackStaticsPercentiles::validateTotalHopDelayDataP999(double value) const {
+        if (std::isnan(value) || value < 0 || value > 1.0E+6) {
+            throw std::out_of_range("TotalHopDelayDataP999 value is out of valid range: " + std::to_string(value));
+        }
+    }
+
+    void TrackStaticsPercentiles::validateUpdateTime(int64_t value) const {
+        if (value < -9223372036854775808LL || value > 9223372036854775807LL) {
+            throw std::out_of_range("UpdateTime value is out of valid range: " + std::to_string(value));
+        }
+    }
+
+int64_t TrackStaticsPercentiles::getTrackId() const noexcept {
+    return trackId_;
+}
+
+void TrackStaticsPercentiles::setTrackId(const int64_t& value) {
+    validateTrackId(value);
+    trackId_ = value;
+}
+
+uint32_t TrackStaticsPercentiles::getSampleCount() const noexcept {
+    return sampleCount_;
+}
+
+void TrackStaticsPercentiles::setSampleCount(const uint32_t& value) {
+    validateSampleCount(value);
+    sampleCount_ = value;
+}
+
+double TrackStaticsPercentiles::getFirstHopDelayDataP50() const noexcept {
+    return firstHopDelayDataP50_;
+}
+
+void TrackStaticsPercentiles::setFirstHopDelayDataP50(const double& value) {
+    validateFirstHopDelayDataP50(value);
+    firstHopDelayDataP50_ = value;
+}
+
+double TrackStaticsPercentiles::getFirstHopDelayDataP90() const noexcept {
+    return firstHopDelayDataP90_;
+}
+
+void TrackStaticsPercentiles::setFirstHopDelayDataP90(const double& value) {
+    validateFirstHopDelayDataP90(value);
+    firstHopDelayDataP90_ = value;
+}
+
+double TrackStaticsPercentiles::getFirstHopDelayDataP99() const noexcept {
+    return firstHopDelayDataP99_;
+}
+
+void TrackStaticsPercentiles::setFirstHopDelayDataP99(const double& value) {
+    validateFirstHopDelayDataP99(value);
+    firstHopDelayDataP99_ = value;
+}
+
+double TrackStaticsPercentiles::getFirstHopDelayDataP999() const noexcept {
+    return firstHopDelayDataP999_;
+}
+
+void TrackStaticsPercentiles::setFirstHopDelayDataP999(const double& value) {
+    validateFirstHopDelayDataP999(value);
+    firstHopDelayDataP999_ = value;
+}
+
+double TrackStaticsPercentiles::getSecondHopDelayDataP50() const noexcept {
+    return secondHopDelayDataP50_;
+}
+
+void TrackStaticsPercentiles::setSecondHopDelayDataP50(const double& value) {
+    validateSecondHopDelayDataP50(value);
+    secondHopDelayDataP50_ = value;
+}
+
+double TrackStaticsPercentiles::getSecondHopDelayDataP90() const noexcept {
+    return secondHopDelayDataP90_;
+}
+
+void TrackStaticsPercentiles::setSecondHopDelayDataP90(const double& value) {
+    validateSecondHopDelayDataP90(value);
+    secondHopDelayDataP90_ = value;
+}
+
+double TrackStaticsPercentiles::getSecondHopDelayDataP99() const noexcept {
+    return secondHopDelayDataP99_;
+}
+
+void TrackStaticsPercentiles::setSecondHopDelayDataP99(const double& value) {
+    validateSecondHopDelayDataP99(value);
+    secondHopDelayDataP99_ = value;
+}
+
+double TrackStaticsPercentiles::getSecondHopDelayDataP999() const noexcept {
+    return secondHopDelayDataP999_;
+}
+
+void TrackStaticsPercentiles::setSecondHopDelayDataP999(const double& value) {
+    validateSecondHopDelayDataP999(value);
+    secondHopDelayDataP999_ = value;
+}
+
+double TrackStaticsPercentiles::getTotalHopDelayDataP50() const noexcept {
+    return totalHopDelayDataP50_;
+}
+
+void TrackStaticsPercentiles::setTotalHopDelayDataP50(const double& value) {
+    validateTotalHopDelayDataP50(value);
+    totalHopDelayDataP50_ = value;
+}
+
+double TrackStaticsPercentiles::getTotalHopDelayDataP90() const noexcept {
+    return totalHopDelayDataP90_;
+}
+
+void TrackStaticsPercentiles::setTotalHopDelayDataP90(const double& value) {
+    validateTotalHopDelayDataP90(value);
+    totalHopDelayDataP90_ = value;
+}
+
+double TrackStaticsPercentiles::getTotalHopDelayDataP99() const noexcept {
+    return totalHopDelayDataP99_;
+}
+
+void TrackStaticsPercentiles::setTotalHopDelayDataP99(const double& value) {
+    validateTotalHopDelayDataP99(value);
+    totalHopDelayDataP99_ = value;
+}
+
+double TrackStaticsPercentiles::getTotalHopDelayDataP999() const noexcept {
+    return totalHopDelayDataP999_;
+}
+
+void TrackStaticsPercentiles::setTotalHopDelayDataP999(const double& value) {
+    validateTotalHopDelayDataP999(value);
+    totalHopDelayDataP999_ = value;
+}
+
+int64_t TrackStaticsPercentiles::getUpdateTime() const noexcept {
+    return updateTime_;
+}
+
+void TrackStaticsPercentiles::setUpdateTime(const int64_t& value) {
+    validateUpdateTime(value);
+    updateTime_ = value;
+}
+
+bool TrackStaticsPercentiles::isValid() const noexcept {
+    try {
+        validateTrackId(trackId_);
+        validateSampleCount(sampleCount_);
+        validateFirstHopDelayDataP50(firstHopDelayDataP50_);
+        validateFirstHopDelayDataP90(firstHopDelayDataP90_);
+        validateFirstHopDelayDataP99(firstHopDelayDataP99_);
+        validateFirstHopDelayDataP999(firstHopDelayDataP999_);
+        validateSecondHopDelayDataP50(secondHopDelayDataP50_);
+        validateSecondHopDelayDataP90(secondHopDelayDataP90_);
+        validateSecondHopDelayDataP99(secondHopDelayDataP99_);
+        validateSecondHopDelayDataP999(secondHopDelayDataP999_);
+        validateTotalHopDelayDataP50(totalHopDelayDataP50_);
+        validateTotalHopDelayDataP90(totalHopDelayDataP90_);
+        validateTotalHopDelayDataP99(totalHopDelayDataP99_);
+        validateTotalHopDelayDataP999(totalHopDelayDataP999_);
+        validateUpdateTime(updateTime_);
+        return true;
+    } catch (const std::exception&) {
+        return false;
+    }
+}
+
+// MISRA C++ 2023 compliant Binary Serialization Implementation
+std::vector<uint8_t> TrackStaticsPercentiles::serialize() const {
+    std::vector<uint8_t> buffer(getSerializedSize());
+    (void)serializeInto(buffer.data());
+    return buffer;
+}
+
+std::size_t TrackStaticsPercentiles::serializeInto(uint8_t* out) const noexcept {
+    std::size_t offset = 0U;
+    
+    // Serialize trackId_
+    std::memcpy(&out[offset], &trackId_, sizeof(trackId_));
+    offset += sizeof(trackId_);
+    
+    // Serialize sampleCount_
+    std::memcpy(&out[offset], &sampleCount_, sizeof(sampleCount_));
+    offset += sizeof(sampleCount_);
+    
+    // Serialize firstHopDelayDataP50_
+    std::memcpy(&out[offset], &firstHopDelayDataP50_, sizeof(firstHopDelayDataP50_));
+    offset += sizeof(firstHopDelayDataP50_);
+    
+    // Serialize firstHopDelayDataP90_
+    std::memcpy(&out[offset], &firstHopDelayDataP90_, sizeof(firstHopDelayDataP90_));
+    offset += sizeof(firstHopDelayDataP90_);
+    
+    // Serialize firstHopDelayDataP99_
+    std::memcpy(&out[offset], &firstHopDelayDataP99_, sizeof(firstHopDelayDataP99_));
+    offset += sizeof(firstHopDelayDataP99_);
+    
+    // Serialize firstHopDelayDataP999_
+    std::memcpy(&out[offset], &firstHopDelayDataP999_, sizeof(firstHopDelayDataP999_));
+    offset += sizeof(firstHopDelayDataP999_);
+    
+    // Serialize secondHopDelayDataP50_
+    std::memcpy(&out[offset], &secondHopDelayDataP50_, sizeof(secondHopDelayDataP50_));
+    offset += sizeof(secondHopDelayDataP50_);
+    
+    // Serialize secondHopDelayDataP90_
+    std::memcpy(&out[offset], &secondHopDelayDataP90_, sizeof(secondHopDelayDataP90_));
+    offset += sizeof(secondHopDelayDataP90_);
+    
+    // Serialize secondHopDelayDataP99_
+    std::memcpy(&out[offset], &secondHopDelayDataP99_, sizeof(secondHopDelayDataP99_));
+    offset += sizeof(secondHopDelayDataP99_);
+    
+    // Serialize secondHopDelayDataP999_
+    std::memcpy(&out[offset], &secondHopDelayDataP999_, sizeof(secondHopDelayDataP999_));
+    offset += sizeof(secondHopDelayDataP999_);
+    
+    // Serialize totalHopDelayDataP50_
+    std::memcpy(&out[offset], &totalHopDelayDataP50_, sizeof(totalHopDelayDataP50_));
+    offset += sizeof(totalHopDelayDataP50_);
+    
+    // Serialize totalHopDelayDataP90_
+    std::memcpy(&out[offset], &totalHopDelayDataP90_, sizeof(totalHopDelayDataP90_));
+    offset += sizeof(totalHopDelayDataP90_);
+    
+    // Serialize totalHopDelayDataP99_
+    std::memcpy(&out[offset], &totalHopDelayDataP99_, sizeof(totalHopDelayDataP99_));
+    offset += sizeof(totalHopDelayDataP99_);
+    
+    // Serialize totalHopDelayDataP999_
+    std::memcpy(&out[offset], &totalHopDelayDataP999_, sizeof(totalHopDelayDataP999_));
+    offset += sizeof(totalHopDelayDataP999_);
+    
+    // Serialize updateTime_
+    std::memcpy(&out[offset], &updateTime_, sizeof(updateTime_));
+    offset += sizeof(updateTime_);
+    
+    return offset;
+}
+
+bool TrackStaticsPercentiles::deserialize(const std::vector<uint8_t>& data) noexcept {
+    return deserialize(data.data(), data.size());
+}
+
+bool TrackStaticsPercentiles::deserialize(const uint8_t* data, std::size_t size) noexcept {
+    if (size < getSerializedSize()) {
+        return false;
+    }
+    
+    std::size_t offset = 0U;
+    
+    // Deserialize trackId_
+    if (offset + sizeof(trackId_) <= size) {
+        std::memcpy(&trackId_, &data[offset], sizeof(trackId_));
+        offset += sizeof(trackId_);
+    } else {
+        return false;
+    }
+    
+    // Deserialize sampleCount_
+    if (offset + sizeof(sampleCount_) <= size) {
+        std::memcpy(&sampleCount_, &data[offset], sizeof(sampleCount_));
+        offset += sizeof(sampleCount_);
+    } else {
+        return false;
+    }
+    
+    // Deserialize firstHopDelayDataP50_
+    if (offset + sizeof(firstHopDelayDataP50_) <= size) {
+        std::memcpy(&firstHopDelayDataP50_, &data[offset], sizeof(firstHopDelayDataP50_));
+        offset += sizeof(firstHopDelayDataP50_);
+    } else {
+        return false;
+    }
+    
+    // Deserialize firstHopDelayDataP90_
+    if (offset + sizeof(firstHopDelayDataP90_) <= size) {
+        std::memcpy(&firstHopDelayDataP90_, &data[offset], sizeof(firstHopDelayDataP90_));
+        offset += sizeof(firstHopDelayDataP90_);
+    } else {
+        return false;
+    }
+    
+    // Deserialize firstHopDelayDataP99_
+    if (offset + sizeof(firstHopDelayDataP99_) <= size) {
+        std::memcpy(&firstHopDelayDataP99_, &data[offset], sizeof(firstHopDelayDataP99_));
+        offset += sizeof(firstHopDelayDataP99_);
+    } else {
+        return false;
+    }
+    
+    // Deserialize firstHopDelayDataP999_
+    if (offset + sizeof(firstHopDelayDataP999_) <= size) {
+        std::memcpy(&firstHopDelayDataP999_, &data[offset], sizeof(firstHopDelayDataP999_));
+        offset += sizeof(firstHopDelayDataP999_);
+    } else {
+        return false;
+    }
+    
+    // Deserialize secondHopDelayDataP50_
+    if (offset + sizeof(secondHopDelayDataP50_) <= size) {
+        std::memcpy(&secondHopDelayDataP50_, &data[offset], sizeof(secondHopDelayDataP50_));
+        offset += sizeof(secondHopDelayDataP50_);
+    } else {
+        return false;
+    }
+    
+    // Deserialize secondHopDelayDataP90_
+    if (offset + sizeof(secondHopDelayDataP90_) <= size) {
+        std::memcpy(&secondHopDelayDataP90_, &data[offset], sizeof(secondHopDelayDataP90_));
+        offset += sizeof(secondHopDelayDataP90_);
+    } else {
+        return false;
+    }
+    
+    // Deserialize secondHopDelayDataP99_
+    if (offset + sizeof(secondHopDelayDataP99_) <= size) {
+        std::memcpy(&secondHopDelayDataP99_, &data[offset], sizeof(secondHopDelayDataP99_));
+        offset += sizeof(secondHopDelayDataP99_);
+    } else {
+        return false;
+    }
+    
+    // Deserialize secondHopDelayDataP999_
+    if (offset + sizeof(secondHopDelayDataP999_) <= size) {
+        std::memcpy(&secondHopDelayDataP999_, &data[offset], sizeof(secondHopDelayDataP999_));
+        offset += sizeof(secondHopDelayDataP999_);
+    } else {
+        return false;
+    }
+    
+    // Deserialize totalHopDelayDataP50_
+    if (offset + sizeof(totalHopDelayDataP50_) <= size) {
+        std::memcpy(&totalHopDelayDataP50_, &data[offset], sizeof(totalHopDelayDataP50_));
+        offset += sizeof(totalHopDelayDataP50_);
+    } else {
+        return false;
+    }
+    
+    // Deserialize totalHopDelayDataP90_
+    if (offset + sizeof(totalHopDelayDataP90_) <= size) {
+        std::memcpy(&totalHopDelayDataP90_, &data[offset], sizeof(totalHopDelayDataP90_));
+        offset += sizeof(totalHopDelayDataP90_);
+    } else {
+        return false;
+    }
+    
+    // Deserialize totalHopDelayDataP99_
+    if (offset + sizeof(totalHopDelayDataP99_) <= size) {
+        std::memcpy(&totalHopDelayDataP99_, &data[offset], sizeof(totalHopDelayDataP99_));
+        offset += sizeof(totalHopDelayDataP99_);
+    } else {
+        return false;
+    }
+    
+    // Deserialize totalHopDelayDataP999_
+    if (offset + sizeof(totalHopDelayDataP999_) <= size) {
+        std::memcpy(&totalHopDelayDataP999_, &data[offset], sizeof(totalHopDelayDataP999_));
+        offset += sizeof(totalHopDelayDataP999_);
+    } else {
+        return false;
+    }
+    
+    // Deserialize updateTime_
+    if (offset + sizeof(updateTime_) <= size) {
+        std::memcpy(&updateTime_, &data[offset], sizeof(updateTime_));
+        offset += sizeof(updateTime_);
+    } else {
+        return false;
+    }
+    
+    return true;
+}
+
+std::size_t TrackStaticsPercentiles::getSerializedSize() const noexcept {
+    std::size_t size = 0U;
+    
+    size += sizeof(trackId_);  // uint32_t
+    size += sizeof(sampleCount_);  // uint32_t
+    size += sizeof(firstHopDelayDataP50_);  // float
+    size += sizeof(firstHopDelayDataP90_);  // float
+    size += sizeof(firstHopDelayDataP99_);  // float
+    size += sizeof(firstHopDelayDataP999_);  // float
+    size += sizeof(secondHopDelayDataP50_);  // float
+    size += sizeof(secondHopDelayDataP90_);  // float
+    size += sizeof(secondHopDelayDataP99_);  // float
+    size += sizeof(secondHopDelayDataP999_);  // float
+    size += sizeof(totalHopDelayDataP50_);  // float
+    size += sizeof(totalHopDelayDataP90_);  // float
+    size += sizeof(totalHopDelayDataP99_);  // float
+    size += sizeof(totalHopDelayDataP999_);  // float
+    size += sizeof(updateTime_);  // uint32_t
+    
+    return size;
+}
+
+std::vector<uint8_t> TrackStaticsPercentiles::serializeWithChecksum() const {
+    std::vector<uint8_t> buffer(getSerializedSize() + CHECKSUM_SIZE);
+    (void)serializeWithChecksumInto(buffer.data());
+    return buffer;
+}
+
+std::size_t TrackStaticsPercentiles::serializeWithChecksumInto(uint8_t* out) const noexcept {
+    const std::size_t size = serializeInto(out);
+    const uint32_t checksum = Crc32c::compute(out, size);
+    std::memcpy(&out[size], &checksum, sizeof(checksum));
+    return size + sizeof(checksum);
+}
+
+bool TrackStaticsPercentiles::deserializeWithChecksum(const std::vector<uint8_t>& data) noexcept {
+    return deserializeWithChecksum(data.data(), data.size());
+}
+
+bool TrackStaticsPercentiles::deserializeWithChecksum(const uint8_t* data, std::size_t size) noexcept {
+    if (size < CHECKSUM_SIZE) {
+        return false;
+    }
+    
+    const std::size_t payloadSize = size - CHECKSUM_SIZE;
+    uint32_t checksum{0U};
+    std::memcpy(&checksum, &data[payloadSize], sizeof(checksum));
+    if (checksum != Crc32c::compute(data, payloadSize)) {
+        return false;
+    }
+    
+    // Check the size first so a rejected record leaves the object untouched
+    return (getSerializedSize() == payloadSize) && deserialize(data, payloadSize);
+}
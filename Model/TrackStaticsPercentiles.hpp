@@ -0,0 +1,156 @@
+#pragma once
+
+// MISRA C++ 2023 compliant includes
+#include <string>
+#include <cstdint>
+#include <stdexcept>
+#include <cmath>
+#include <vector>
+#include <cstring>
+
+/**
+ * @brief Bir izin çok adımlı (multi-hop) gecikme verilerinin yüzdelik dilimlerini (p50/p90/p99/p99.9) içerir; TrackStatics mesajını kuyruk gecikmesiyle tamamlar.
+ * Auto-generated from TrackStaticsPercentiles.json
+ * MISRA C++ 2023 compliant implementation
+ */
+class TrackStaticsPercentiles final {
+public:
+    // Network configuration constants
+    static constexpr const char* MULTICAST_ADDRESS = "239.1.1.5";
+    static constexpr int PORT = 9600;
+
+    // MISRA C++ 2023 compliant constructors
+    explicit TrackStaticsPercentiles() noexcept;
+    
+    // Copy constructor
+    TrackStaticsPercentiles(const TrackStaticsPercentiles& other) = default;
+    
+    // Move constructor
+    TrackStaticsPercentiles(TrackStaticsPercentiles&& other) noexcept = default;
+    
+    // Copy assignment operator
+    TrackStaticsPercentiles& operator=(const TrackStaticsPercentiles& other) = default;
+    
+    // Move assignment operator
+    TrackStaticsPercentiles& operator=(TrackStaticsPercentiles&& other) noexcept = default;
+    
+    // Destructor
+    ~TrackStaticsPercentiles() = default;
+    
+    // Getters and Setters
+    int64_t getTrackId() const noexcept;
+    void setTrackId(const int64_t& value);
+
+    uint32_t getSampleCount() const noexcept;
+    void setSampleCount(const uint32_t& value);
+
+    double getFirstHopDelayDataP50() const noexcept;
+    void setFirstHopDelayDataP50(const double& value);
+
+    double getFirstHopDelayDataP90() const noexcept;
+    void setFirstHopDelayDataP90(const double& value);
+
+    double getFirstHopDelayDataP99() const noexcept;
+    void setFirstHopDelayDataP99(const double& value);
+
+    double getFirstHopDelayDataP999() const noexcept;
+    void setFirstHopDelayDataP999(const double& value);
+
+    double getSecondHopDelayDataP50() const noexcept;
+    void setSecondHopDelayDataP50(const double& value);
+
+    double getSecondHopDelayDataP90() const noexcept;
+    void setSecondHopDelayDataP90(const double& value);
+
+    double getSecondHopDelayDataP99() const noexcept;
+    void setSecondHopDelayDataP99(const double& value);
+
+    double getSecondHopDelayDataP999() const noexcept;
+    void setSecondHopDelayDataP999(const double& value);
+
+    double getTotalHopDelayDataP50() const noexcept;
+    void setTotalHopDelayDataP50(const double& value);
+
+    double getTotalHopDelayDataP90() const noexcept;
+    void setTotalHopDelayDataP90(const double& value);
+
+    double getTotalHopDelayDataP99() const noexcept;
+    void setTotalHopDelayDataP99(const double& value);
+
+    double getTotalHopDelayDataP999() const noexcept;
+    void setTotalHopDelayDataP999(const double& value);
+
+    int64_t getUpdateTime() const noexcept;
+    void setUpdateTime(const int64_t& value);
+
+    // Validation - MISRA compliant
+    [[nodiscard]] bool isValid() const noexcept;
+
+    // Binary Serialization - MISRA compliant
+    [[nodiscard]] std::vector<uint8_t> serialize() const;
+    bool deserialize(const std::vector<uint8_t>& data) noexcept;
+    [[nodiscard]] std::size_t getSerializedSize() const noexcept;
+
+    // Zero-copy Binary Serialization - MISRA compliant
+    /// Writes getSerializedSize() bytes to out and returns that count
+    std::size_t serializeInto(uint8_t* out) const noexcept;
+    bool deserialize(const uint8_t* data, std::size_t size) noexcept;
+
+    // Binary Serialization with CRC32C trailer - MISRA compliant
+    static constexpr std::size_t CHECKSUM_SIZE = 4U;
+    [[nodiscard]] std::vector<uint8_t> serializeWithChecksum() const;
+    /// Writes getSerializedSize() + CHECKSUM_SIZE bytes to out and returns that count
+    std::size_t serializeWithChecksumInto(uint8_t* out) const noexcept;
+    bool deserializeWithChecksum(const std::vector<uint8_t>& data) noexcept;
+    bool deserializeWithChecksum(const uint8_t* data, std::size_t size) noexcept;
+
+private:
+    // Member variables
+    /// İz için benzersiz tam sayı kimliği
+    int64_t trackId_;
+    /// Yüzdelik dilimlerin hesaplandığı gecikme örneği sayısı.
+    uint32_t sampleCount_;
+    /// İlk atlama gecikme verisinin 50. yüzdelik değeri.
+    double firstHopDelayDataP50_;
+    /// İlk atlama gecikme verisinin 90. yüzdelik değeri.
+    double firstHopDelayDataP90_;
+    /// İlk atlama gecikme verisinin 99. yüzdelik değeri.
+    double firstHopDelayDataP99_;
+    /// İlk atlama gecikme verisinin 99.9. yüzdelik değeri.
+    double firstHopDelayDataP999_;
+    /// İkinci atlama gecikme verisinin 50. yüzdelik değeri.
+    double secondHopDelayDataP50_;
+    /// İkinci atlama gecikme verisinin 90. yüzdelik değeri.
+    double secondHopDelayDataP90_;
+    /// İkinci atlama gecikme verisinin 99. yüzdelik değeri.
+    double secondHopDelayDataP99_;
+    /// İkinci atlama gecikme verisinin 99.9. yüzdelik değeri.
+    double secondHopDelayDataP999_;
+    /// Toplam gecikme verisinin 50. yüzdelik değeri.
+    double totalHopDelayDataP50_;
+    /// Toplam gecikme verisinin 90. yüzdelik değeri.
+    double totalHopDelayDataP90_;
+    /// Toplam gecikme verisinin 99. yüzdelik değeri.
+    double totalHopDelayDataP99_;
+    /// Toplam gecikme verisinin 99.9. yüzdelik değeri.
+    double totalHopDelayDataP999_;
+    /// Son güncelleme zamanı (nanosaniye)
+    int64_t updateTime_;
+
+    // Validation functions - MISRA compliant
+    void validateTrackId(int64_t value) const;
+    void validateSampleCount(uint32_t value) const;
+    void validateFirstHopDelayDataP50(double value) const;
+    void validateFirstHopDelayDataP90(double value) const;
+    void validateFirstHopDelayDataP99(double value) const;
+    void validateFirstHopDelayDataP999(double value) const;
+    void validateSecondHopDelayDataP50(double value) const;
+    void validateSecondHopDelayDataP90(double value) const;
+    void validateSecondHopDelayDataP99(double value) const;
+    void validateSecondHopDelayDataP999(double value) const;
+    void validateTotalHopDelayDataP50(double value) const;
+    void validateTotalHopDelayDataP90(double value) const;
+    void validateTotalHopDelayDataP99(double value) const;
+    void validateTotalHopDelayDataP999(double value) const;
+    void validateUpdateTime(int64_t value) const;
+};
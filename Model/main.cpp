@@ -8,6 +8,7 @@
 #include "FinalCalcTrackData.hpp"
 #include "ProcessedTrackData.hpp"
 #include "TrackStatics.hpp"
+#include "TrackStaticsPercentiles.hpp"
 
 int main() {
     std::cout << "=== C++ Model Sınıfları Test Programı ===" << std::endl;
@@ -81,6 +82,16 @@ int main() {
         
         std::cout << "Validation: " << (trackstaticsObj.isValid() ? "Geçerli" : "Geçersiz") << std::endl;
         
+        // TrackStaticsPercentiles örneği
+        std::cout << "\n--- TrackStaticsPercentiles ---" << std::endl;
+        TrackStaticsPercentiles trackstaticspercentilesObj;
+        
+        trackstaticspercentilesObj.setTrackId(1234);
+        trackstaticspercentilesObj.setSampleCount(12345);
+        trackstaticspercentilesObj.setFirstHopDelayDataP50(123.45);
+        
+        std::cout << "Validation: " << (trackstaticspercentilesObj.isValid() ? "Geçerli" : "Geçersiz") << std::endl;
+        
     } catch (const std::exception& e) {
         std::cerr << "Hata: " << e.what() << std::endl;
         return 1;
@@ -0,0 +1,128 @@
+#include "DeadReckoningFilter.hpp"
+
+#include <cmath>
+#include <stdexcept>
+
+DeadReckoningFilter::DeadReckoningFilter(const DeadReckoningOptions& options)
+    : options_(options),
+      heartbeatNs_(std::chrono::duration_cast<std::chrono::nanoseconds>(options.heartbeat).count()),
+      references_(options.maxTracks),
+      index_(options.maxTracks) {
+    if (!(options.thresholdMeters >= 0.0) || (options.maxTracks == 0U)) {
+        throw std::invalid_argument("Dead reckoning needs a threshold >= 0 and a track capacity");
+    }
+    freeSlots_.reserve(options.maxTracks);
+    for (std::size_t slot = options.maxTracks; slot > 0U; --slot) {
+        freeSlots_.push_back(static_cast<uint32_t>(slot - 1U));
+    }
+}
+
+bool DeadReckoningFilter::shouldPublish(const ExtrapTrackData& message) {
+    offered_.add();
+    const uint32_t slot = index_.find(message.getTrackId());
+    if (slot == TrackSlotIndex::NOT_FOUND) {
+        return true;
+    }
+    const Reference& reference = references_[slot];
+    if ((message.getUpdateTime() - reference.time) >= heartbeatNs_) {
+        heartbeats_.add();
+    } else if (distanceToPrediction(reference, message) > options_.thresholdMeters) {
+        thresholds_.add();
+    } else {
+        suppressed_.add();
+        return false;
+    }
+    return true;
+}
+
+void DeadReckoningFilter::commit(const ExtrapTrackData& message) {
+    published_.add();
+    const uint64_t key = message.getTrackId();
+    uint32_t slot = index_.find(key);
+    if (slot == TrackSlotIndex::NOT_FOUND) {
+        if (freeSlots_.empty()) {
+            untracked_.add();
+            return;
+        }
+        slot = freeSlots_.back();
+        freeSlots_.pop_back();
+        index_.insert(key, slot);
+    }
+    store(references_[slot], message);
+}
+
+bool DeadReckoningFilter::publish(TrackPublisher& publisher, const ExtrapTrackData& message) {
+    if (!shouldPublish(message)) {
+        return true;
+    }
+    if (!publisher.publish(message)) {
+        return false;
+    }
+    commit(message);
+    return true;
+}
+
+bool DeadReckoningFilter::forget(uint64_t trackId) noexcept {
+    const uint32_t slot = index_.find(trackId);
+    if (slot == TrackSlotIndex::NOT_FOUND) {
+        return false;
+    }
+    (void)index_.erase(trackId);
+    freeSlots_.push_back(slot);
+    return true;
+}
+
+double DeadReckoningFilter::impliedError(const ExtrapTrackData& message) const noexcept {
+    const uint32_t slot = index_.find(message.getTrackId());
+    return (slot == TrackSlotIndex::NOT_FOUND) ? -1.0 : distanceToPrediction(references_[slot], message);
+}
+
+double DeadReckoningFilter::distanceToPrediction(const Reference& reference, const ExtrapTrackData& message) noexcept {
+    const double dt = static_cast<double>(message.getUpdateTime() - reference.time) * 1.0e-9;
+    const double dx = message.getXPositionECEF() - (reference.position[0] + (reference.velocity[0] * dt));
+    const double dy = message.getYPositionECEF() - (reference.position[1] + (reference.velocity[1] * dt));
+    const double dz = message.getZPositionECEF() - (reference.position[2] + (reference.velocity[2] * dt));
+    return std::sqrt((dx * dx) + (dy * dy) + (dz * dz));
+}
+
+void DeadReckoningFilter::store(Reference& reference, const ExtrapTrackData& message) noexcept {
+    reference.position = {message.getXPositionECEF(), message.getYPositionECEF(), message.getZPositionECEF()};
+    reference.velocity = {static_cast<double>(message.getXVelocityECEF()), message.getYVelocityECEF(),
+                          message.getZVelocityECEF()};
+    reference.time = message.getUpdateTime();
+}
+
+uint64_t DeadReckoningFilter::getOfferedCount() const noexcept {
+    return offered_.load();
+}
+
+uint64_t DeadReckoningFilter::getPublishedCount() const noexcept {
+    return published_.load();
+}
+
+uint64_t DeadReckoningFilter::getSuppressedCount() const noexcept {
+    return suppressed_.load();
+}
+
+uint64_t DeadReckoningFilter::getThresholdCount() const noexcept {
+    return thresholds_.load();
+}
+
+uint64_t DeadReckoningFilter::getHeartbeatCount() const noexcept {
+    return heartbeats_.load();
+}
+
+uint64_t DeadReckoningFilter::getUntrackedCount() const noexcept {
+    return untracked_.load();
+}
+
+void DeadReckoningFilter::registerMetrics(TransportMetrics& metrics, const std::string& prefix) const {
+    metrics.addCollector([this, prefix](std::vector<MetricSample>& samples) {
+        samples.push_back({prefix + ".offered", offered_.load()});
+        samples.push_back({prefix + ".published", published_.load()});
+        samples.push_back({prefix + ".suppressed", suppressed_.load()});
+        samples.push_back({prefix + ".threshold", thresholds_.load()});
+        samples.push_back({prefix + ".heartbeat", heartbeats_.load()});
+        samples.push_back({prefix + ".untracked", untracked_.load()});
+    });
+}
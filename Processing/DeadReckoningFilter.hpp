@@ -0,0 +1,98 @@
+#pragma once
+
+// MISRA C++ 2023 compliant includes
+#include <array>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+#include "ExtrapTrackData.hpp"
+#include "RelaxedCounter.hpp"
+#include "TrackPublisher.hpp"
+#include "TrackSlotIndex.hpp"
+#include "TransportMetrics.hpp"
+
+struct DeadReckoningOptions final {
+    /// Largest tolerated distance between the true and the receiver-implied position (m)
+    double thresholdMeters{10.0};
+    /// Longest gap between two publications of a track, even when it is predictable
+    std::chrono::milliseconds heartbeat{1000};
+    /// Tracks whose reference state is kept; further tracks are always published
+    std::size_t maxTracks{100000U};
+};
+
+/**
+ * @brief Suppresses ExtrapTrackData updates that a receiver can predict.
+ * For every track the filter keeps the last published state, which is what
+ * the receiver holds. It extrapolates that state at constant velocity to
+ * the new updateTime, using the velocity as sent (xVelocity is a float on
+ * the wire). An update is published only when the true position differs
+ * from that prediction by more than thresholdMeters, or when heartbeat has
+ * passed since the last publication. An update becomes the new reference
+ * only through commit(), once it was actually sent, so a failed send
+ * leaves the filter in step with the receivers. The receiver-side error
+ * therefore stays within the threshold at every update instant, as long
+ * as no publication is lost. References of tracks that went away must be
+ * dropped with forget(), or they keep their slot in the table.
+ * Not thread-safe.
+ */
+class DeadReckoningFilter final {
+public:
+    /// Throws std::invalid_argument for a negative threshold or zero capacity
+    explicit DeadReckoningFilter(const DeadReckoningOptions& options = {});
+
+    /// True when message has to be published; call commit() once it was sent
+    bool shouldPublish(const ExtrapTrackData& message);
+
+    /// Makes a sent message the track's reference, i.e. what the receivers now hold
+    void commit(const ExtrapTrackData& message);
+
+    /// Publishes message through publisher unless it is predictable; true when sent or suppressed
+    bool publish(TrackPublisher& publisher, const ExtrapTrackData& message);
+
+    /// Drops the reference of trackId, so its next update is published and its slot is reused
+    bool forget(uint64_t trackId) noexcept;
+
+    /// Distance between message and what the receiver predicts for it, -1 when the track has no reference
+    [[nodiscard]] double impliedError(const ExtrapTrackData& message) const noexcept;
+
+    [[nodiscard]] uint64_t getOfferedCount() const noexcept;
+    /// Updates committed after a successful send
+    [[nodiscard]] uint64_t getPublishedCount() const noexcept;
+    [[nodiscard]] uint64_t getSuppressedCount() const noexcept;
+    /// Publications forced by the threshold
+    [[nodiscard]] uint64_t getThresholdCount() const noexcept;
+    /// Publications forced by the heartbeat
+    [[nodiscard]] uint64_t getHeartbeatCount() const noexcept;
+    /// Publications of tracks that did not fit the reference table
+    [[nodiscard]] uint64_t getUntrackedCount() const noexcept;
+
+    /// Exposes the counters under prefix
+    void registerMetrics(TransportMetrics& metrics, const std::string& prefix = "dead_reckoning") const;
+
+private:
+    struct Reference {
+        std::array<double, 3> position{};
+        std::array<double, 3> velocity{};
+        int64_t time{0};
+    };
+
+    [[nodiscard]] static double distanceToPrediction(const Reference& reference,
+                                                     const ExtrapTrackData& message) noexcept;
+    static void store(Reference& reference, const ExtrapTrackData& message) noexcept;
+
+    const DeadReckoningOptions options_;
+    const int64_t heartbeatNs_;
+    std::vector<Reference> references_;
+    std::vector<uint32_t> freeSlots_;
+    TrackSlotIndex index_;
+
+    RelaxedCounter offered_;
+    RelaxedCounter published_;
+    RelaxedCounter suppressed_;
+    RelaxedCounter thresholds_;
+    RelaxedCounter heartbeats_;
+    RelaxedCounter untracked_;
+};
@@ -0,0 +1,71 @@
+#pragma once
+
+// MISRA C++ 2023 compliant includes
+#include <cmath>
+#include <cstdint>
+#include <limits>
+
+/**
+ * @brief Running count, mean, variance, min and max of one delay series.
+ * add() is Welford's update, which stays accurate where summing squares
+ * would cancel catastrophically (delays of ~1e9 ns with ~1e3 ns spread).
+ * merge() combines two accumulators with Chan's parallel formula. It gives
+ * the same result as adding every sample of other, so partial accumulators
+ * (per thread, per time bucket) can be summed later.
+ */
+struct DelayAccumulator final {
+    uint64_t count{0U};
+    double mean{0.0};
+    /// Sum of squared deviations from the mean
+    double m2{0.0};
+    double min{std::numeric_limits<double>::infinity()};
+    double max{-std::numeric_limits<double>::infinity()};
+
+    void add(double value) noexcept {
+        ++count;
+        const double delta = value - mean;
+        mean += delta / static_cast<double>(count);
+        m2 += delta * (value - mean);
+        min = (value < min) ? value : min;
+        max = (value > max) ? value : max;
+    }
+
+    void merge(const DelayAccumulator& other) noexcept {
+        mergeMoments(other);
+        min = (other.min < min) ? other.min : min;
+        max = (other.max > max) ? other.max : max;
+    }
+
+    /// merge() of count, mean and m2 only, for callers that track the extrema separately
+    void mergeMoments(const DelayAccumulator& other) noexcept {
+        if (other.count == 0U) {
+            return;
+        }
+        if (count == 0U) {
+            count = other.count;
+            mean = other.mean;
+            m2 = other.m2;
+            return;
+        }
+        const double n = static_cast<double>(count);
+        const double m = static_cast<double>(other.count);
+        const double total = n + m;
+        const double delta = other.mean - mean;
+        mean += delta * (m / total);
+        m2 += other.m2 + (delta * delta * ((n * m) / total));
+        count += other.count;
+    }
+
+    void reset() noexcept {
+        *this = DelayAccumulator{};
+    }
+
+    /// Population variance (0 for fewer than two samples)
+    [[nodiscard]] double variance() const noexcept {
+        return (count > 1U) ? (m2 / static_cast<double>(count)) : 0.0;
+    }
+
+    [[nodiscard]] double stddev() const noexcept {
+        return std::sqrt(variance());
+    }
+};
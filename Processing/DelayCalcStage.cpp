@@ -0,0 +1,134 @@
+#include "DelayCalcStage.hpp"
+
+#include <exception>
+#include <limits>
+#include <stdexcept>
+
+DelayCalcStage::DelayCalcStage(TrackPublisher& publisher, const TscClock* clock, const DelayCalcStageOptions& options)
+    : publisher_(publisher), clock_(clock), options_(options), batch_(options.batchSize) {
+    if (options.batchSize == 0U) {
+        throw std::invalid_argument("Delay calculation batch size must be positive");
+    }
+}
+
+void DelayCalcStage::attach(TrackMessageDispatcher& dispatcher) {
+    dispatcher.subscribe<ExtrapTrackData>([this, &dispatcher](const ExtrapTrackData& message) {
+        const int64_t kernelNs = dispatcher.getReceiveTimestamps().softwareNs;
+        if (options_.preferKernelTimestamps && (kernelNs != 0)) {
+            kernelStamped_.add();
+            (void)process(message, kernelNs);
+        } else {
+            (void)process(message, nowNs());
+        }
+    });
+}
+
+bool DelayCalcStage::process(const ExtrapTrackData& message, int64_t receiveNs) {
+    processed_.add();
+    const uint32_t trackId = message.getTrackId();
+    if ((trackId < MIN_TRACK_ID) || (trackId > MAX_TRACK_ID)) {
+        rejectedTrackId_.add();
+        return false;
+    }
+    int64_t delay = 0;
+    if (__builtin_sub_overflow(receiveNs, message.getFirstHopSentTime(), &delay)) {
+        saturated_.add();
+        delay = (receiveNs < 0) ? std::numeric_limits<int64_t>::min() : std::numeric_limits<int64_t>::max();
+    }
+    if (delay < 0) {
+        clockSkew_.add();
+    }
+    DelayCalcTrackData& out = batch_[pending_];
+    try {
+        out.setTrackId(static_cast<uint16_t>(trackId));
+        out.setXVelocityECEF(message.getXVelocityECEF());
+        out.setYVelocityECEF(message.getYVelocityECEF());
+        out.setZVelocityECEF(message.getZVelocityECEF());
+        out.setXPositionECEF(message.getXPositionECEF());
+        out.setYPositionECEF(message.getYPositionECEF());
+        out.setZPositionECEF(message.getZPositionECEF());
+        out.setOriginalUpdateTime(message.getOriginalUpdateTime());
+        out.setUpdateTime(message.getUpdateTime());
+        out.setFirstHopSentTime(message.getFirstHopSentTime());
+        out.setFirstHopDelayTime(delay);
+    } catch (const std::exception&) {
+        rangeFailures_.add();
+        return false;
+    }
+    ++pending_;
+    if (pending_ == batch_.size()) {
+        (void)flush();
+    }
+    return true;
+}
+
+std::size_t DelayCalcStage::process(const ExtrapTrackData* messages, std::size_t count, int64_t receiveNs) {
+    std::size_t accepted = 0U;
+    for (std::size_t i = 0U; i < count; ++i) {
+        accepted += process(messages[i], receiveNs) ? 1U : 0U;
+    }
+    return accepted;
+}
+
+bool DelayCalcStage::flush() {
+    if (pending_ == 0U) {
+        return true;
+    }
+    const int64_t sentNs = nowNs();
+    for (std::size_t i = 0U; i < pending_; ++i) {
+        batch_[i].setSecondHopSentTime(sentNs);
+    }
+    const bool sent = publisher_.publishBatch(batch_.data(), pending_, options_.maxDatagramBytes);
+    if (sent) {
+        published_.add(pending_);
+    } else {
+        sendFailures_.add();
+    }
+    pending_ = 0U;
+    return sent;
+}
+
+uint64_t DelayCalcStage::getProcessedCount() const noexcept {
+    return processed_.load();
+}
+
+uint64_t DelayCalcStage::getPublishedCount() const noexcept {
+    return published_.load();
+}
+
+uint64_t DelayCalcStage::getRejectedTrackIdCount() const noexcept {
+    return rejectedTrackId_.load();
+}
+
+uint64_t DelayCalcStage::getRangeFailureCount() const noexcept {
+    return rangeFailures_.load();
+}
+
+uint64_t DelayCalcStage::getClockSkewCount() const noexcept {
+    return clockSkew_.load();
+}
+
+uint64_t DelayCalcStage::getKernelStampedCount() const noexcept {
+    return kernelStamped_.load();
+}
+
+uint64_t DelayCalcStage::getSaturatedCount() const noexcept {
+    return saturated_.load();
+}
+
+uint64_t DelayCalcStage::getSendFailureCount() const noexcept {
+    return sendFailures_.load();
+}
+
+void DelayCalcStage::registerMetrics(TransportMetrics& metrics, const std::string& prefix) const {
+    metrics.addCollector([this, prefix](std::vector<MetricSample>& samples) {
+        samples.push_back({prefix + ".processed", processed_.load()});
+        samples.push_back({prefix + ".published", published_.load()});
+        samples.push_back({prefix + ".rejected_track_id", rejectedTrackId_.load()});
+        samples.push_back({prefix + ".range_failures", rangeFailures_.load()});
+        samples.push_back({prefix + ".clock_skew", clockSkew_.load()});
+        samples.push_back({prefix + ".kernel_stamped", kernelStamped_.load()});
+        samples.push_back({prefix + ".saturated", saturated_.load()});
+        samples.push_back({prefix + ".send_failures", sendFailures_.load()});
+    });
+}
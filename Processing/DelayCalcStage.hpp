@@ -0,0 +1,106 @@
+#pragma once
+
+// MISRA C++ 2023 compliant includes
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+#include "DelayCalcTrackData.hpp"
+#include "ExtrapTrackData.hpp"
+#include "RelaxedCounter.hpp"
+#include "TrackMessageDispatcher.hpp"
+#include "TrackPublisher.hpp"
+#include "TransportMetrics.hpp"
+#include "TscClock.hpp"
+
+struct DelayCalcStageOptions final {
+    /// Records collected before a batch is published (flush() sends a partial one)
+    std::size_t batchSize{256U};
+    /// Datagram budget handed to TrackPublisher::publishBatch()
+    std::size_t maxDatagramBytes{1400U};
+    /// Use the kernel software receive timestamp when the datagram carries one
+    bool preferKernelTimestamps{true};
+};
+
+/**
+ * @brief First processing hop: ExtrapTrackData in, DelayCalcTrackData out.
+ * Every record is stamped with its receive time. That is the kernel
+ * software timestamp when the receiving endpoint enables timestamping,
+ * otherwise the TscClock (or clock_gettime without one). Then
+ *     firstHopDelayTime = receive time - firstHopSentTime
+ * and secondHopSentTime is the time the batch is handed to the publisher.
+ * The uint32 trackId is narrowed to the DelayCalcTrackData domain 1..9999;
+ * records outside it are rejected and counted, never wrapped.
+ * Converted records collect in a preallocated batch that goes out with
+ * publishBatch() when full or on flush(), so processing does not allocate.
+ * A negative delay means the sender's clock is ahead of ours. Such records
+ * are still published, and counted as clock skew. A firstHopSentTime so far
+ * off that the difference overflows saturates at the int64 limits.
+ * Not thread-safe: drive it from the receiving thread and call flush()
+ * after every engine poll.
+ */
+class DelayCalcStage final {
+public:
+    static constexpr uint32_t MIN_TRACK_ID = 1U;
+    static constexpr uint32_t MAX_TRACK_ID = 9999U;
+
+    /// clock may be nullptr; it must outlive the stage. Throws std::invalid_argument for a zero batch size
+    explicit DelayCalcStage(TrackPublisher& publisher, const TscClock* clock = nullptr,
+                            const DelayCalcStageOptions& options = {});
+
+    /// Feeds every ExtrapTrackData that dispatcher decodes into the stage, with its kernel timestamps
+    void attach(TrackMessageDispatcher& dispatcher);
+
+    /// Converts one record received at receiveNs (CLOCK_REALTIME); false when it was rejected
+    bool process(const ExtrapTrackData& message, int64_t receiveNs);
+
+    /// Converts count records sharing one receive time; returns the number accepted
+    std::size_t process(const ExtrapTrackData* messages, std::size_t count, int64_t receiveNs);
+
+    /// Publishes the pending records; true when nothing was pending or the batch was sent
+    bool flush();
+
+    /// Receive time used when the datagram has no kernel timestamp
+    [[nodiscard]] int64_t nowNs() const noexcept {
+        return (clock_ != nullptr) ? clock_->nowNs() : TscClock::realtimeNs();
+    }
+
+    [[nodiscard]] std::size_t getPendingCount() const noexcept {
+        return pending_;
+    }
+
+    [[nodiscard]] uint64_t getProcessedCount() const noexcept;
+    [[nodiscard]] uint64_t getPublishedCount() const noexcept;
+    /// Records whose trackId is outside 1..9999
+    [[nodiscard]] uint64_t getRejectedTrackIdCount() const noexcept;
+    /// Records with a value outside the DelayCalcTrackData schema range
+    [[nodiscard]] uint64_t getRangeFailureCount() const noexcept;
+    /// Records received before they were sent by our clock
+    [[nodiscard]] uint64_t getClockSkewCount() const noexcept;
+    /// Records stamped with a kernel timestamp rather than the clock
+    [[nodiscard]] uint64_t getKernelStampedCount() const noexcept;
+    /// Records whose delay overflowed int64 and was clamped
+    [[nodiscard]] uint64_t getSaturatedCount() const noexcept;
+    /// Batches the publisher failed to send
+    [[nodiscard]] uint64_t getSendFailureCount() const noexcept;
+
+    /// Exposes the counters under prefix
+    void registerMetrics(TransportMetrics& metrics, const std::string& prefix = "delay_calc") const;
+
+private:
+    TrackPublisher& publisher_;
+    const TscClock* const clock_;
+    const DelayCalcStageOptions options_;
+    std::vector<DelayCalcTrackData> batch_;
+    std::size_t pending_{0U};
+
+    RelaxedCounter processed_;
+    RelaxedCounter published_;
+    RelaxedCounter rejectedTrackId_;
+    RelaxedCounter rangeFailures_;
+    RelaxedCounter clockSkew_;
+    RelaxedCounter kernelStamped_;
+    RelaxedCounter saturated_;
+    RelaxedCounter sendFailures_;
+};
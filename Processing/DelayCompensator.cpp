@@ -0,0 +1,79 @@
+#include "DelayCompensator.hpp"
+
+#include <exception>
+
+DelayCompensator::DelayCompensator(const DelayCompensationOptions& options, const ExtrapolationEngine& engine)
+    : engine_(engine),
+      maxCompensationNs_(std::chrono::duration_cast<std::chrono::nanoseconds>(options.maxCompensation).count()) {}
+
+std::size_t DelayCompensator::compensate(FinalCalcTrackData* messages, std::size_t count) {
+    columns_.resize(count);
+    for (std::size_t i = 0U; i < count; ++i) {
+        const FinalCalcTrackData& message = messages[i];
+        int64_t delay = message.getTotalDelayTime();
+        if (delay < 0) {
+            negative_.add();
+            delay = 0;
+        } else if (delay > maxCompensationNs_) {
+            clamped_.add();
+            delay = maxCompensationNs_;
+        }
+        columns_.xPosition[i] = message.getXPositionECEF();
+        columns_.yPosition[i] = message.getYPositionECEF();
+        columns_.zPosition[i] = message.getZPositionECEF();
+        columns_.xVelocity[i] = message.getXVelocityECEF();
+        columns_.yVelocity[i] = message.getYVelocityECEF();
+        columns_.zVelocity[i] = message.getZVelocityECEF();
+        // Target time 0 below: every row moves by its own delay
+        columns_.updateTime[i] = -delay;
+    }
+    engine_.extrapolate(columns_, 0, positions_);
+
+    std::size_t moved = 0U;
+    for (std::size_t i = 0U; i < count; ++i) {
+        const int64_t delay = -columns_.updateTime[i];
+        if (delay == 0) {
+            continue;
+        }
+        FinalCalcTrackData& message = messages[i];
+        const FinalCalcTrackData original = message;
+        try {
+            message.setXPositionECEF(positions_.x[i]);
+            message.setYPositionECEF(positions_.y[i]);
+            message.setZPositionECEF(positions_.z[i]);
+            message.setUpdateTime(message.getUpdateTime() + delay);
+        } catch (const std::exception&) {
+            message = original;
+            rangeFailures_.add();
+            continue;
+        }
+        ++moved;
+    }
+    compensated_.add(moved);
+    return moved;
+}
+
+uint64_t DelayCompensator::getCompensatedCount() const noexcept {
+    return compensated_.load();
+}
+
+uint64_t DelayCompensator::getNegativeDelayCount() const noexcept {
+    return negative_.load();
+}
+
+uint64_t DelayCompensator::getClampedCount() const noexcept {
+    return clamped_.load();
+}
+
+uint64_t DelayCompensator::getRangeFailureCount() const noexcept {
+    return rangeFailures_.load();
+}
+
+void DelayCompensator::registerMetrics(TransportMetrics& metrics, const std::string& prefix) const {
+    metrics.addCollector([this, prefix](std::vector<MetricSample>& samples) {
+        samples.push_back({prefix + ".compensated", compensated_.load()});
+        samples.push_back({prefix + ".negative_delay", negative_.load()});
+        samples.push_back({prefix + ".clamped", clamped_.load()});
+        samples.push_back({prefix + ".range_failures", rangeFailures_.load()});
+    });
+}
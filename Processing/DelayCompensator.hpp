@@ -0,0 +1,61 @@
+#pragma once
+
+// MISRA C++ 2023 compliant includes
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <string>
+
+#include "ExtrapolationEngine.hpp"
+#include "FinalCalcTrackData.hpp"
+#include "RelaxedCounter.hpp"
+#include "TrackColumns.hpp"
+#include "TransportMetrics.hpp"
+
+struct DelayCompensationOptions final {
+    /// Delays above this are compensated by this much only (and counted as clamped)
+    std::chrono::milliseconds maxCompensation{1000};
+};
+
+/**
+ * @brief Moves FinalCalcTrackData states forward by their measured delay.
+ * A FinalCalcTrackData position is valid at updateTime but reaches the
+ * consumer totalDelayTime later. compensate() extrapolates each message at
+ * constant velocity by its own totalDelayTime and advances updateTime by
+ * the same amount. The position is then valid at (about) receive time.
+ * A batch goes through the ExtrapolationEngine in one call: each row gets
+ * updateTime = -delay and a common target time of 0, so every track moves
+ * by its own delay. Messages with a negative delay (clock skew) are left
+ * unchanged and counted.
+ * Not thread-safe; the column buffers are reused across calls.
+ */
+class DelayCompensator final {
+public:
+    explicit DelayCompensator(const DelayCompensationOptions& options = {},
+                              const ExtrapolationEngine& engine = ExtrapolationEngine{});
+
+    /// Compensates count messages in place; returns the number moved
+    std::size_t compensate(FinalCalcTrackData* messages, std::size_t count);
+
+    [[nodiscard]] uint64_t getCompensatedCount() const noexcept;
+    /// Messages skipped because totalDelayTime was negative
+    [[nodiscard]] uint64_t getNegativeDelayCount() const noexcept;
+    /// Messages moved by maxCompensation instead of their full delay
+    [[nodiscard]] uint64_t getClampedCount() const noexcept;
+    /// Messages left unchanged because the moved state left the schema range
+    [[nodiscard]] uint64_t getRangeFailureCount() const noexcept;
+
+    /// Exposes the counters under prefix
+    void registerMetrics(TransportMetrics& metrics, const std::string& prefix = "delay_compensation") const;
+
+private:
+    const ExtrapolationEngine engine_;
+    const int64_t maxCompensationNs_;
+    TrackColumns columns_;
+    PositionColumns positions_;
+
+    RelaxedCounter compensated_;
+    RelaxedCounter negative_;
+    RelaxedCounter clamped_;
+    RelaxedCounter rangeFailures_;
+};
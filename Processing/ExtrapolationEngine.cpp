@@ -0,0 +1,169 @@
+#include "ExtrapolationEngine.hpp"
+
+#include <limits>
+#include <stdexcept>
+#include <string>
+
+#if defined(__x86_64__)
+#include <immintrin.h>
+#endif
+
+namespace {
+
+constexpr double NS_TO_SECONDS = 1.0e-9;
+
+struct KernelColumns {
+    const int64_t* time;
+    const double* px;
+    const double* py;
+    const double* pz;
+    const double* vx;
+    const double* vy;
+    const double* vz;
+    double* ox;
+    double* oy;
+    double* oz;
+};
+
+void extrapolateScalar(const KernelColumns& c, std::size_t begin, std::size_t end, int64_t target) noexcept {
+    for (std::size_t i = begin; i < end; ++i) {
+        const double dt = static_cast<double>(target - c.time[i]) * NS_TO_SECONDS;
+        c.ox[i] = c.px[i] + (c.vx[i] * dt);
+        c.oy[i] = c.py[i] + (c.vy[i] * dt);
+        c.oz[i] = c.pz[i] + (c.vz[i] * dt);
+    }
+}
+
+#if defined(__x86_64__)
+/// Returns the number of rows done; the caller finishes the tail
+__attribute__((target("avx2,fma"))) std::size_t extrapolateAvx2(const KernelColumns& c, std::size_t count,
+                                                                 int64_t target) noexcept {
+    const __m256i targetLanes = _mm256_set1_epi64x(target);
+    // 1.5 * 2^52: an int64 added to its bit pattern lands in the mantissa (exact for |x| < 2^51)
+    const __m256d magic = _mm256_set1_pd(6755399441055744.0);
+    const __m256d scale = _mm256_set1_pd(NS_TO_SECONDS);
+    std::size_t i = 0U;
+    for (; (i + 4U) <= count; i += 4U) {
+        const __m256i offset =
+            _mm256_sub_epi64(targetLanes, _mm256_loadu_si256(reinterpret_cast<const __m256i*>(&c.time[i])));
+        const __m256d offsetNs =
+            _mm256_sub_pd(_mm256_castsi256_pd(_mm256_add_epi64(offset, _mm256_castpd_si256(magic))), magic);
+        const __m256d dt = _mm256_mul_pd(offsetNs, scale);
+        _mm256_storeu_pd(&c.ox[i], _mm256_fmadd_pd(_mm256_loadu_pd(&c.vx[i]), dt, _mm256_loadu_pd(&c.px[i])));
+        _mm256_storeu_pd(&c.oy[i], _mm256_fmadd_pd(_mm256_loadu_pd(&c.vy[i]), dt, _mm256_loadu_pd(&c.py[i])));
+        _mm256_storeu_pd(&c.oz[i], _mm256_fmadd_pd(_mm256_loadu_pd(&c.vz[i]), dt, _mm256_loadu_pd(&c.pz[i])));
+    }
+    return i;
+}
+
+__attribute__((target("avx512f,avx512dq"))) std::size_t extrapolateAvx512(const KernelColumns& c, std::size_t count,
+                                                                          int64_t target) noexcept {
+    const __m512i targetLanes = _mm512_set1_epi64(target);
+    const __m512d scale = _mm512_set1_pd(NS_TO_SECONDS);
+    std::size_t i = 0U;
+    for (; (i + 8U) <= count; i += 8U) {
+        const __m512i offset = _mm512_sub_epi64(targetLanes, _mm512_loadu_si512(&c.time[i]));
+        const __m512d dt = _mm512_mul_pd(_mm512_cvtepi64_pd(offset), scale);
+        _mm512_storeu_pd(&c.ox[i], _mm512_fmadd_pd(_mm512_loadu_pd(&c.vx[i]), dt, _mm512_loadu_pd(&c.px[i])));
+        _mm512_storeu_pd(&c.oy[i], _mm512_fmadd_pd(_mm512_loadu_pd(&c.vy[i]), dt, _mm512_loadu_pd(&c.py[i])));
+        _mm512_storeu_pd(&c.oz[i], _mm512_fmadd_pd(_mm512_loadu_pd(&c.vz[i]), dt, _mm512_loadu_pd(&c.pz[i])));
+    }
+    return i;
+}
+#endif
+
+}  // namespace
+
+const char* simdLevelName(SimdLevel level) noexcept {
+    switch (level) {
+        case SimdLevel::Avx2:
+            return "avx2";
+        case SimdLevel::Avx512:
+            return "avx512";
+        case SimdLevel::Scalar:
+        default:
+            return "scalar";
+    }
+}
+
+ExtrapolationEngine::ExtrapolationEngine() noexcept : level_(detectSimdLevel()) {}
+
+ExtrapolationEngine::ExtrapolationEngine(SimdLevel level) : level_(level) {
+    if (!isSupported(level)) {
+        throw std::invalid_argument(std::string("CPU does not support the ") + simdLevelName(level) +
+                                    " extrapolation kernel");
+    }
+}
+
+void ExtrapolationEngine::extrapolate(const TrackColumns& tracks, int64_t targetTimeNs, PositionColumns& out) const {
+    const std::size_t count = tracks.size();
+    out.resize(count);
+    const KernelColumns columns{tracks.updateTime.data(), tracks.xPosition.data(), tracks.yPosition.data(),
+                                tracks.zPosition.data(),  tracks.xVelocity.data(), tracks.yVelocity.data(),
+                                tracks.zVelocity.data(),  out.x.data(),            out.y.data(),
+                                out.z.data()};
+    std::size_t done = 0U;
+#if defined(__x86_64__)
+    if (level_ == SimdLevel::Avx512) {
+        done = extrapolateAvx512(columns, count, targetTimeNs);
+    } else if (level_ == SimdLevel::Avx2) {
+        done = extrapolateAvx2(columns, count, targetTimeNs);
+    }
+#endif
+    extrapolateScalar(columns, done, count, targetTimeNs);
+}
+
+bool ExtrapolationEngine::toMessage(const TrackColumns& tracks, const PositionColumns& positions, std::size_t row,
+                                    int64_t targetTimeNs, ExtrapTrackData& out) noexcept {
+    return fillMessage(tracks.trackId[row], {positions.x[row], positions.y[row], positions.z[row]},
+                       {tracks.xVelocity[row], tracks.yVelocity[row], tracks.zVelocity[row]}, tracks.updateTime[row],
+                       targetTimeNs, out);
+}
+
+bool ExtrapolationEngine::fillMessage(int64_t trackId, const std::array<double, 3>& position,
+                                      const std::array<double, 3>& velocity, int64_t originalUpdateTime,
+                                      int64_t targetTimeNs, ExtrapTrackData& out) noexcept {
+    if ((trackId < 0) || (trackId > static_cast<int64_t>(std::numeric_limits<uint32_t>::max()))) {
+        return false;
+    }
+    try {
+        out.setTrackId(static_cast<uint32_t>(trackId));
+        out.setXVelocityECEF(static_cast<float>(velocity[0]));
+        out.setYVelocityECEF(velocity[1]);
+        out.setZVelocityECEF(velocity[2]);
+        out.setXPositionECEF(position[0]);
+        out.setYPositionECEF(position[1]);
+        out.setZPositionECEF(position[2]);
+        out.setOriginalUpdateTime(originalUpdateTime);
+        out.setUpdateTime(targetTimeNs);
+    } catch (const std::exception&) {
+        return false;
+    }
+    return true;
+}
+
+SimdLevel ExtrapolationEngine::detectSimdLevel() noexcept {
+    if (isSupported(SimdLevel::Avx512)) {
+        return SimdLevel::Avx512;
+    }
+    if (isSupported(SimdLevel::Avx2)) {
+        return SimdLevel::Avx2;
+    }
+    return SimdLevel::Scalar;
+}
+
+bool ExtrapolationEngine::isSupported(SimdLevel level) noexcept {
+#if defined(__x86_64__)
+    switch (level) {
+        case SimdLevel::Avx512:
+            return (__builtin_cpu_supports("avx512f") != 0) && (__builtin_cpu_supports("avx512dq") != 0);
+        case SimdLevel::Avx2:
+            return (__builtin_cpu_supports("avx2") != 0) && (__builtin_cpu_supports("fma") != 0);
+        case SimdLevel::Scalar:
+        default:
+            return true;
+    }
+#else
+    return level == SimdLevel::Scalar;
+#endif
+}
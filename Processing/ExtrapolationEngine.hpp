@@ -0,0 +1,65 @@
+#pragma once
+
+// MISRA C++ 2023 compliant includes
+#include <array>
+#include <cstddef>
+#include <cstdint>
+
+#include "ExtrapTrackData.hpp"
+#include "TrackColumns.hpp"
+
+/// Instruction set of an extrapolation kernel
+enum class SimdLevel : uint8_t {
+    Scalar,
+    Avx2,  ///< 4 tracks per instruction, AVX2 + FMA
+    Avx512 ///< 8 tracks per instruction, AVX-512F + DQ
+};
+
+const char* simdLevelName(SimdLevel level) noexcept;
+
+/**
+ * @brief Constant-velocity extrapolation of ProcessedTrackData states to a
+ * common target time, producing ExtrapTrackData.
+ *     p(t) = p(updateTime) + v * (t - updateTime)
+ * The kernel streams over TrackColumns, so one call moves every track of a
+ * batch. The widest kernel the CPU supports is picked at construction;
+ * all kernels agree to within FMA rounding.
+ * Time offsets must stay within +-2^51 ns (about 26 days), the range the
+ * AVX2 kernel converts int64 to double exactly.
+ * Stateless apart from the kernel choice; one engine can serve any thread.
+ */
+class ExtrapolationEngine final {
+public:
+    /// Uses the widest supported kernel
+    explicit ExtrapolationEngine() noexcept;
+
+    /// Forces a kernel; throws std::invalid_argument when the CPU lacks it
+    explicit ExtrapolationEngine(SimdLevel level);
+
+    [[nodiscard]] SimdLevel getSimdLevel() const noexcept {
+        return level_;
+    }
+
+    /// Positions of every row of tracks at targetTimeNs; out is resized to tracks.size()
+    void extrapolate(const TrackColumns& tracks, int64_t targetTimeNs, PositionColumns& out) const;
+
+    /**
+     * @brief Fills out with row extrapolated to targetTimeNs.
+     * originalUpdateTime is the time of the processed state, updateTime the
+     * target time; firstHopSentTime is left to the publisher. Returns false
+     * when the trackId does not fit uint32 or a value leaves the schema range.
+     */
+    static bool toMessage(const TrackColumns& tracks, const PositionColumns& positions, std::size_t row,
+                          int64_t targetTimeNs, ExtrapTrackData& out) noexcept;
+
+    /// Same as toMessage() for a state held outside columns
+    static bool fillMessage(int64_t trackId, const std::array<double, 3>& position,
+                            const std::array<double, 3>& velocity, int64_t originalUpdateTime, int64_t targetTimeNs,
+                            ExtrapTrackData& out) noexcept;
+
+    [[nodiscard]] static SimdLevel detectSimdLevel() noexcept;
+    [[nodiscard]] static bool isSupported(SimdLevel level) noexcept;
+
+private:
+    SimdLevel level_;
+};
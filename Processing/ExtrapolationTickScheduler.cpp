@@ -0,0 +1,181 @@
+#include "ExtrapolationTickScheduler.hpp"
+
+#include <stdexcept>
+
+#include "TscClock.hpp"
+
+namespace {
+
+int64_t steadyNs() noexcept {
+    return std::chrono::duration_cast<std::chrono::nanoseconds>(
+               std::chrono::steady_clock::now().time_since_epoch())
+        .count();
+}
+
+}  // namespace
+
+ExtrapolationTickScheduler::ExtrapolationTickScheduler(TrackPublisher& publisher, const TickSchedulerOptions& options,
+                                                       const ExtrapolationEngine& engine)
+    : publisher_(publisher),
+      options_(options),
+      engine_(engine),
+      periodNs_(std::chrono::duration_cast<std::chrono::nanoseconds>(options.period).count()),
+      staleAfterNs_(std::chrono::duration_cast<std::chrono::nanoseconds>(options.staleAfter).count()),
+      index_(options.maxTracks) {
+    if ((periodNs_ <= 0) || (options.maxTracks == 0U)) {
+        throw std::invalid_argument("Tick period and track capacity must be positive");
+    }
+    tracks_.reserve(options.maxTracks);
+    positions_.resize(options.maxTracks);
+    messages_.resize(options.maxTracks);
+}
+
+bool ExtrapolationTickScheduler::update(const ProcessedTrackData& track) {
+    const uint64_t key = static_cast<uint64_t>(track.getTrackId());
+    const uint32_t row = index_.find(key);
+    if (row == TrackSlotIndex::NOT_FOUND) {
+        if (tracks_.size() >= options_.maxTracks) {
+            rejected_.add();
+            return false;
+        }
+        index_.insert(key, static_cast<uint32_t>(tracks_.append(track)));
+        return true;
+    }
+    if (track.getUpdateTime() < tracks_.updateTime[row]) {
+        return false;
+    }
+    tracks_.set(row, track);
+    return true;
+}
+
+bool ExtrapolationTickScheduler::poll() {
+    return poll(TscClock::realtimeNs());
+}
+
+bool ExtrapolationTickScheduler::poll(int64_t nowNs) {
+    if (nextTickNs_ == 0) {
+        nextTickNs_ = ((nowNs / periodNs_) + 1) * periodNs_;
+        return false;
+    }
+    if (nowNs < nextTickNs_) {
+        return false;
+    }
+    // Ticks already in the past are skipped: the picture is always drawn at the latest due tick
+    const int64_t late = (nowNs - nextTickNs_) / periodNs_;
+    missedTicks_.add(static_cast<uint64_t>(late));
+    const int64_t tickTimeNs = nextTickNs_ + (late * periodNs_);
+    nextTickNs_ = tickTimeNs + periodNs_;
+
+    const int64_t start = steadyNs();
+    (void)tick(tickTimeNs);
+    if ((nowNs + (steadyNs() - start)) > nextTickNs_) {
+        overruns_.add();
+    }
+    return true;
+}
+
+std::size_t ExtrapolationTickScheduler::tick(int64_t tickTimeNs) {
+    expire(tickTimeNs);
+    const int64_t start = steadyNs();
+    engine_.extrapolate(tracks_, tickTimeNs, positions_);
+    const int64_t extrapolated = steadyNs();
+
+    std::size_t count = 0U;
+    for (std::size_t row = 0U; row < tracks_.size(); ++row) {
+        if (!ExtrapolationEngine::toMessage(tracks_, positions_, row, tickTimeNs, messages_[count])) {
+            conversionFailures_.add();
+        } else if ((deadReckoning_ == nullptr) || deadReckoning_->shouldPublish(messages_[count])) {
+            ++count;
+        }
+    }
+    const int64_t sentTimeNs = TscClock::realtimeNs();
+    for (std::size_t i = 0U; i < count; ++i) {
+        messages_[i].setFirstHopSentTime(sentTimeNs);
+    }
+    const int64_t converted = steadyNs();
+
+    if ((count > 0U) && publisher_.publishBatch(messages_.data(), count, options_.maxDatagramBytes)) {
+        published_.add(count);
+        // Only a sent tick moves the receivers' references; after a failure every track is offered again
+        for (std::size_t i = 0U; (i < count) && (deadReckoning_ != nullptr); ++i) {
+            deadReckoning_->commit(messages_[i]);
+        }
+    }
+    const int64_t finished = steadyNs();
+
+    lastTimings_ = TickTimings{extrapolated - start, converted - extrapolated, finished - converted};
+    if (static_cast<uint64_t>(finished - start) > maxTickNs_.load()) {
+        maxTickNs_.set(static_cast<uint64_t>(finished - start));
+    }
+    ticks_.add();
+    return count;
+}
+
+void ExtrapolationTickScheduler::expire(int64_t tickTimeNs) {
+    // Backwards, so the row swapped into a hole has already been checked
+    for (std::size_t row = tracks_.size(); row > 0U; --row) {
+        if ((tickTimeNs - tracks_.updateTime[row - 1U]) > staleAfterNs_) {
+            if (deadReckoning_ != nullptr) {
+                (void)deadReckoning_->forget(static_cast<uint64_t>(tracks_.trackId[row - 1U]));
+            }
+            removeRow(row - 1U);
+            expired_.add();
+        }
+    }
+}
+
+void ExtrapolationTickScheduler::removeRow(std::size_t row) {
+    const std::size_t last = tracks_.size() - 1U;
+    (void)index_.erase(static_cast<uint64_t>(tracks_.trackId[row]));
+    if (row != last) {
+        tracks_.copyRow(last, row);
+        (void)index_.erase(static_cast<uint64_t>(tracks_.trackId[row]));
+        index_.insert(static_cast<uint64_t>(tracks_.trackId[row]), static_cast<uint32_t>(row));
+    }
+    tracks_.resize(last);
+}
+
+uint64_t ExtrapolationTickScheduler::getTickCount() const noexcept {
+    return ticks_.load();
+}
+
+uint64_t ExtrapolationTickScheduler::getMissedTickCount() const noexcept {
+    return missedTicks_.load();
+}
+
+uint64_t ExtrapolationTickScheduler::getOverrunCount() const noexcept {
+    return overruns_.load();
+}
+
+uint64_t ExtrapolationTickScheduler::getPublishedCount() const noexcept {
+    return published_.load();
+}
+
+uint64_t ExtrapolationTickScheduler::getRejectedCount() const noexcept {
+    return rejected_.load();
+}
+
+uint64_t ExtrapolationTickScheduler::getExpiredCount() const noexcept {
+    return expired_.load();
+}
+
+uint64_t ExtrapolationTickScheduler::getConversionFailureCount() const noexcept {
+    return conversionFailures_.load();
+}
+
+int64_t ExtrapolationTickScheduler::getMaxTickNs() const noexcept {
+    return static_cast<int64_t>(maxTickNs_.load());
+}
+
+void ExtrapolationTickScheduler::registerMetrics(TransportMetrics& metrics, const std::string& prefix) const {
+    metrics.addCollector([this, prefix](std::vector<MetricSample>& samples) {
+        samples.push_back({prefix + ".ticks", ticks_.load()});
+        samples.push_back({prefix + ".missed", missedTicks_.load()});
+        samples.push_back({prefix + ".overruns", overruns_.load()});
+        samples.push_back({prefix + ".published", published_.load()});
+        samples.push_back({prefix + ".rejected", rejected_.load()});
+        samples.push_back({prefix + ".expired", expired_.load()});
+        samples.push_back({prefix + ".conversion_failures", conversionFailures_.load()});
+        samples.push_back({prefix + ".max_tick_ns", maxTickNs_.load()});
+    });
+}
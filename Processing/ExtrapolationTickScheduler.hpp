@@ -0,0 +1,130 @@
+#pragma once
+
+// MISRA C++ 2023 compliant includes
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+#include "DeadReckoningFilter.hpp"
+#include "ExtrapTrackData.hpp"
+#include "ExtrapolationEngine.hpp"
+#include "ProcessedTrackData.hpp"
+#include "RelaxedCounter.hpp"
+#include "TrackColumns.hpp"
+#include "TrackPublisher.hpp"
+#include "TrackSlotIndex.hpp"
+#include "TransportMetrics.hpp"
+
+struct TickSchedulerOptions final {
+    /// Tick period (20 ms = 50 Hz); ticks fall on multiples of it
+    std::chrono::microseconds period{20000};
+    /// Tracks without an update for this long are dropped from the picture
+    std::chrono::milliseconds staleAfter{5000};
+    /// Capacity of the live track table, allocated up front
+    std::size_t maxTracks{100000U};
+    /// Datagram budget handed to TrackPublisher::publishBatch()
+    std::size_t maxDatagramBytes{1400U};
+};
+
+/// Time spent in the phases of one tick
+struct TickTimings final {
+    int64_t extrapolateNs{0};
+    int64_t convertNs{0};
+    int64_t publishNs{0};
+
+    [[nodiscard]] int64_t totalNs() const noexcept {
+        return extrapolateNs + convertNs + publishNs;
+    }
+};
+
+/**
+ * @brief Publishes a coherent picture of all live tracks at a fixed rate.
+ * update() keeps the newest ProcessedTrackData per track in TrackColumns.
+ * Every tick extrapolates all of them to the tick time with the
+ * ExtrapolationEngine and sends the result as one publishBatch() of
+ * ExtrapTrackData. Every record of a tick then has the same updateTime.
+ * Ticks that are due while an earlier tick is still running are skipped
+ * and counted as missed; a tick that ends after the next tick time is
+ * counted as an overrun. With a DeadReckoningFilter attached, a tick only
+ * carries the tracks the filter does not suppress; the filter's references
+ * are committed once the tick was sent and forgotten when a track expires. Times are
+ * CLOCK_REALTIME ns, the clock of updateTime and firstHopSentTime.
+ * Not thread-safe: feed update() and drive poll() from one thread.
+ */
+class ExtrapolationTickScheduler final {
+public:
+    /// Throws std::invalid_argument for a zero period or track capacity
+    explicit ExtrapolationTickScheduler(TrackPublisher& publisher, const TickSchedulerOptions& options = {},
+                                        const ExtrapolationEngine& engine = ExtrapolationEngine{});
+
+    /// Stores the newest state of a track; false when the table is full or the state is older
+    bool update(const ProcessedTrackData& track);
+
+    /// Leaves predictable tracks out of the ticks (nullptr publishes every track); filter must outlive the scheduler
+    void setDeadReckoning(DeadReckoningFilter* filter) noexcept {
+        deadReckoning_ = filter;
+    }
+
+    /// Runs the tick when it is due; returns true when a tick ran
+    bool poll();
+    bool poll(int64_t nowNs);
+
+    /// Extrapolates and publishes every live track at tickTimeNs; returns the number of records sent
+    std::size_t tick(int64_t tickTimeNs);
+
+    /// Time of the next tick, CLOCK_REALTIME ns (0 before the first poll)
+    [[nodiscard]] int64_t nextTickNs() const noexcept {
+        return nextTickNs_;
+    }
+
+    [[nodiscard]] std::size_t getLiveTrackCount() const noexcept {
+        return tracks_.size();
+    }
+
+    [[nodiscard]] const TickTimings& getLastTickTimings() const noexcept {
+        return lastTimings_;
+    }
+
+    [[nodiscard]] uint64_t getTickCount() const noexcept;
+    [[nodiscard]] uint64_t getMissedTickCount() const noexcept;
+    [[nodiscard]] uint64_t getOverrunCount() const noexcept;
+    [[nodiscard]] uint64_t getPublishedCount() const noexcept;
+    /// Tracks that could not be added because maxTracks were live
+    [[nodiscard]] uint64_t getRejectedCount() const noexcept;
+    [[nodiscard]] uint64_t getExpiredCount() const noexcept;
+    /// Rows whose id or extrapolated state does not fit ExtrapTrackData
+    [[nodiscard]] uint64_t getConversionFailureCount() const noexcept;
+    [[nodiscard]] int64_t getMaxTickNs() const noexcept;
+
+    /// Exposes tick, overrun, track and duration counters under prefix
+    void registerMetrics(TransportMetrics& metrics, const std::string& prefix = "extrapolation_ticks") const;
+
+private:
+    void expire(int64_t tickTimeNs);
+    void removeRow(std::size_t row);
+
+    TrackPublisher& publisher_;
+    const TickSchedulerOptions options_;
+    const ExtrapolationEngine engine_;
+    const int64_t periodNs_;
+    const int64_t staleAfterNs_;
+
+    TrackColumns tracks_;
+    PositionColumns positions_;
+    TrackSlotIndex index_;
+    std::vector<ExtrapTrackData> messages_;
+    DeadReckoningFilter* deadReckoning_{nullptr};
+    int64_t nextTickNs_{0};
+    TickTimings lastTimings_{};
+
+    RelaxedCounter ticks_;
+    RelaxedCounter missedTicks_;
+    RelaxedCounter overruns_;
+    RelaxedCounter published_;
+    RelaxedCounter rejected_;
+    RelaxedCounter expired_;
+    RelaxedCounter conversionFailures_;
+    RelaxedCounter maxTickNs_;
+};
@@ -0,0 +1,159 @@
+#include "FinalCalcStage.hpp"
+
+#include <exception>
+#include <limits>
+#include <stdexcept>
+
+FinalCalcStage::FinalCalcStage(TrackPublisher& publisher, const TscClock* clock, const FinalCalcStageOptions& options)
+    : publisher_(publisher), clock_(clock), options_(options), batch_(options.batchSize) {
+    if (options.batchSize == 0U) {
+        throw std::invalid_argument("Final calculation batch size must be positive");
+    }
+    if (options.compensateDelay) {
+        compensator_ = std::make_unique<DelayCompensator>(options.compensation);
+    }
+}
+
+void FinalCalcStage::attach(TrackMessageDispatcher& dispatcher) {
+    dispatcher.subscribe<DelayCalcTrackData>([this, &dispatcher](const DelayCalcTrackData& message) {
+        const int64_t kernelNs = dispatcher.getReceiveTimestamps().softwareNs;
+        if (options_.preferKernelTimestamps && (kernelNs != 0)) {
+            kernelStamped_.add();
+            (void)process(message, kernelNs);
+        } else {
+            (void)process(message, nowNs());
+        }
+    });
+}
+
+int64_t FinalCalcStage::saturatingAdd(int64_t a, int64_t b, bool& saturated) noexcept {
+    int64_t sum = 0;
+    if (__builtin_add_overflow(a, b, &sum)) {
+        saturated = true;
+        return (b > 0) ? std::numeric_limits<int64_t>::max() : std::numeric_limits<int64_t>::min();
+    }
+    return sum;
+}
+
+bool FinalCalcStage::process(const DelayCalcTrackData& message, int64_t receiveNs) {
+    processed_.add();
+    const int64_t firstHop = message.getFirstHopDelayTime();
+    if (firstHop < 0) {
+        negativeFirstHop_.add();
+    }
+    bool saturated = false;
+    int64_t secondHop = 0;
+    if (__builtin_sub_overflow(receiveNs, message.getSecondHopSentTime(), &secondHop)) {
+        saturated = true;
+        secondHop = (receiveNs < 0) ? std::numeric_limits<int64_t>::min() : std::numeric_limits<int64_t>::max();
+    }
+    if (secondHop < 0) {
+        negativeSecondHop_.add();
+    }
+    const int64_t total = saturatingAdd(firstHop, secondHop, saturated);
+    if (saturated) {
+        saturated_.add();
+    }
+    FinalCalcTrackData& out = batch_[pending_];
+    try {
+        out.setTrackId(message.getTrackId());
+        out.setXVelocityECEF(message.getXVelocityECEF());
+        out.setYVelocityECEF(message.getYVelocityECEF());
+        out.setZVelocityECEF(message.getZVelocityECEF());
+        out.setXPositionECEF(message.getXPositionECEF());
+        out.setYPositionECEF(message.getYPositionECEF());
+        out.setZPositionECEF(message.getZPositionECEF());
+        out.setOriginalUpdateTime(message.getOriginalUpdateTime());
+        out.setUpdateTime(message.getUpdateTime());
+        out.setFirstHopSentTime(message.getFirstHopSentTime());
+        out.setFirstHopDelayTime(firstHop);
+        out.setSecondHopSentTime(message.getSecondHopSentTime());
+        out.setSecondHopDelayTime(secondHop);
+        out.setTotalDelayTime(total);
+    } catch (const std::exception&) {
+        rangeFailures_.add();
+        return false;
+    }
+    ++pending_;
+    if (pending_ == batch_.size()) {
+        (void)flush();
+    }
+    return true;
+}
+
+std::size_t FinalCalcStage::process(const DelayCalcTrackData* messages, std::size_t count, int64_t receiveNs) {
+    std::size_t accepted = 0U;
+    for (std::size_t i = 0U; i < count; ++i) {
+        accepted += process(messages[i], receiveNs) ? 1U : 0U;
+    }
+    return accepted;
+}
+
+bool FinalCalcStage::flush() {
+    if (pending_ == 0U) {
+        return true;
+    }
+    if (compensator_ != nullptr) {
+        (void)compensator_->compensate(batch_.data(), pending_);
+    }
+    const int64_t sentNs = nowNs();
+    for (std::size_t i = 0U; i < pending_; ++i) {
+        batch_[i].setThirdHopSentTime(sentNs);
+    }
+    const bool sent = publisher_.publishBatch(batch_.data(), pending_, options_.maxDatagramBytes);
+    if (sent) {
+        published_.add(pending_);
+    } else {
+        sendFailures_.add();
+    }
+    pending_ = 0U;
+    return sent;
+}
+
+uint64_t FinalCalcStage::getProcessedCount() const noexcept {
+    return processed_.load();
+}
+
+uint64_t FinalCalcStage::getPublishedCount() const noexcept {
+    return published_.load();
+}
+
+uint64_t FinalCalcStage::getRangeFailureCount() const noexcept {
+    return rangeFailures_.load();
+}
+
+uint64_t FinalCalcStage::getNegativeFirstHopCount() const noexcept {
+    return negativeFirstHop_.load();
+}
+
+uint64_t FinalCalcStage::getNegativeSecondHopCount() const noexcept {
+    return negativeSecondHop_.load();
+}
+
+uint64_t FinalCalcStage::getSaturatedCount() const noexcept {
+    return saturated_.load();
+}
+
+uint64_t FinalCalcStage::getKernelStampedCount() const noexcept {
+    return kernelStamped_.load();
+}
+
+uint64_t FinalCalcStage::getSendFailureCount() const noexcept {
+    return sendFailures_.load();
+}
+
+void FinalCalcStage::registerMetrics(TransportMetrics& metrics, const std::string& prefix) const {
+    metrics.addCollector([this, prefix](std::vector<MetricSample>& samples) {
+        samples.push_back({prefix + ".processed", processed_.load()});
+        samples.push_back({prefix + ".published", published_.load()});
+        samples.push_back({prefix + ".range_failures", rangeFailures_.load()});
+        samples.push_back({prefix + ".negative_first_hop", negativeFirstHop_.load()});
+        samples.push_back({prefix + ".negative_second_hop", negativeSecondHop_.load()});
+        samples.push_back({prefix + ".saturated", saturated_.load()});
+        samples.push_back({prefix + ".kernel_stamped", kernelStamped_.load()});
+        samples.push_back({prefix + ".send_failures", sendFailures_.load()});
+    });
+    if (compensator_ != nullptr) {
+        compensator_->registerMetrics(metrics, prefix + ".compensation");
+    }
+}
@@ -0,0 +1,119 @@
+#pragma once
+
+// MISRA C++ 2023 compliant includes
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "DelayCalcTrackData.hpp"
+#include "DelayCompensator.hpp"
+#include "FinalCalcTrackData.hpp"
+#include "RelaxedCounter.hpp"
+#include "TrackMessageDispatcher.hpp"
+#include "TrackPublisher.hpp"
+#include "TransportMetrics.hpp"
+#include "TscClock.hpp"
+
+struct FinalCalcStageOptions final {
+    /// Records collected before a batch is published (flush() sends a partial one)
+    std::size_t batchSize{256U};
+    /// Datagram budget handed to TrackPublisher::publishBatch()
+    std::size_t maxDatagramBytes{1400U};
+    /// Use the kernel software receive timestamp when the datagram carries one
+    bool preferKernelTimestamps{true};
+    /// Move each batch forward by its totalDelayTime with a DelayCompensator before publishing
+    bool compensateDelay{false};
+    DelayCompensationOptions compensation{};
+};
+
+/**
+ * @brief Second processing hop: DelayCalcTrackData in, FinalCalcTrackData out.
+ * Fills in the delays the earlier hops could not know:
+ *     secondHopDelayTime = receive time - secondHopSentTime
+ *     totalDelayTime     = firstHopDelayTime + secondHopDelayTime
+ * and thirdHopSentTime is the time the batch is handed to the publisher.
+ * The receive time is the kernel software timestamp when the receiving
+ * endpoint enables timestamping, otherwise the TscClock.
+ * totalDelayTime saturates at the int64 limits instead of wrapping.
+ * A negative hop delay means the two hosts' clocks disagree. Such records
+ * are published unchanged and counted per hop, so clock skew shows up in
+ * the metrics rather than in the data.
+ * The uint16 trackId widens to int64 without loss.
+ * Records collect in a preallocated batch. With compensateDelay the whole
+ * batch is extrapolated by its delays in one DelayCompensator call before
+ * publishBatch().
+ * Not thread-safe: drive it from the receiving thread, ideally a pinned
+ * core (ThreadTuning), and call flush() after every engine poll.
+ */
+class FinalCalcStage final {
+public:
+    /// clock may be nullptr; it must outlive the stage. Throws std::invalid_argument for a zero batch size
+    explicit FinalCalcStage(TrackPublisher& publisher, const TscClock* clock = nullptr,
+                            const FinalCalcStageOptions& options = {});
+
+    /// Feeds every DelayCalcTrackData that dispatcher decodes into the stage, with its kernel timestamps
+    void attach(TrackMessageDispatcher& dispatcher);
+
+    /// Converts one record received at receiveNs (CLOCK_REALTIME); false when it was rejected
+    bool process(const DelayCalcTrackData& message, int64_t receiveNs);
+
+    /// Converts count records sharing one receive time; returns the number accepted
+    std::size_t process(const DelayCalcTrackData* messages, std::size_t count, int64_t receiveNs);
+
+    /// Publishes the pending records; true when nothing was pending or the batch was sent
+    bool flush();
+
+    /// Receive time used when the datagram has no kernel timestamp
+    [[nodiscard]] int64_t nowNs() const noexcept {
+        return (clock_ != nullptr) ? clock_->nowNs() : TscClock::realtimeNs();
+    }
+
+    [[nodiscard]] std::size_t getPendingCount() const noexcept {
+        return pending_;
+    }
+
+    /// The compensator used with compensateDelay, nullptr otherwise
+    [[nodiscard]] const DelayCompensator* getCompensator() const noexcept {
+        return compensator_.get();
+    }
+
+    [[nodiscard]] uint64_t getProcessedCount() const noexcept;
+    [[nodiscard]] uint64_t getPublishedCount() const noexcept;
+    /// Records with a value outside the FinalCalcTrackData schema range
+    [[nodiscard]] uint64_t getRangeFailureCount() const noexcept;
+    /// Records whose firstHopDelayTime arrived negative
+    [[nodiscard]] uint64_t getNegativeFirstHopCount() const noexcept;
+    /// Records received before their secondHopSentTime by our clock
+    [[nodiscard]] uint64_t getNegativeSecondHopCount() const noexcept;
+    /// Records whose totalDelayTime was clamped to the int64 range
+    [[nodiscard]] uint64_t getSaturatedCount() const noexcept;
+    /// Records stamped with a kernel timestamp rather than the clock
+    [[nodiscard]] uint64_t getKernelStampedCount() const noexcept;
+    /// Batches the publisher failed to send
+    [[nodiscard]] uint64_t getSendFailureCount() const noexcept;
+
+    /// Exposes the counters under prefix
+    void registerMetrics(TransportMetrics& metrics, const std::string& prefix = "final_calc") const;
+
+    /// a + b clamped to the int64 range; sets saturated when it clamps
+    [[nodiscard]] static int64_t saturatingAdd(int64_t a, int64_t b, bool& saturated) noexcept;
+
+private:
+    TrackPublisher& publisher_;
+    const TscClock* const clock_;
+    const FinalCalcStageOptions options_;
+    std::unique_ptr<DelayCompensator> compensator_;
+    std::vector<FinalCalcTrackData> batch_;
+    std::size_t pending_{0U};
+
+    RelaxedCounter processed_;
+    RelaxedCounter published_;
+    RelaxedCounter rangeFailures_;
+    RelaxedCounter negativeFirstHop_;
+    RelaxedCounter negativeSecondHop_;
+    RelaxedCounter saturated_;
+    RelaxedCounter kernelStamped_;
+    RelaxedCounter sendFailures_;
+};
@@ -0,0 +1,162 @@
+#include "HistoryExtrapolator.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <stdexcept>
+
+#include "ExtrapolationEngine.hpp"
+
+namespace {
+
+constexpr double NS_TO_SECONDS = 1.0e-9;
+
+void predictConstantVelocity(const TrackSample& newest, double dt, std::array<double, 3>& position,
+                             std::array<double, 3>& velocity) noexcept {
+    for (std::size_t axis = 0U; axis < 3U; ++axis) {
+        position[axis] = newest.position[axis] + (newest.velocity[axis] * dt);
+        velocity[axis] = newest.velocity[axis];
+    }
+}
+
+}  // namespace
+
+const char* extrapolationModelName(ExtrapolationModel model) noexcept {
+    switch (model) {
+        case ExtrapolationModel::ConstantVelocity:
+            return "constant_velocity";
+        case ExtrapolationModel::ConstantAcceleration:
+            return "constant_acceleration";
+        case ExtrapolationModel::Polynomial:
+        default:
+            return "polynomial";
+    }
+}
+
+HistoryExtrapolator::HistoryExtrapolator(const ExtrapolatorOptions& options) : options_(options) {
+    if (options.model == ExtrapolationModel::Polynomial) {
+        if ((options.polynomialDegree == 0U) || (options.polynomialDegree > MAX_DEGREE)) {
+            throw std::invalid_argument("Polynomial degree must be 1.." + std::to_string(MAX_DEGREE));
+        }
+        if ((options.fitSamples <= options.polynomialDegree) || (options.fitSamples > TrackHistoryRing::CAPACITY)) {
+            throw std::invalid_argument("Polynomial fit needs degree + 1.." +
+                                        std::to_string(TrackHistoryRing::CAPACITY) + " samples");
+        }
+    }
+}
+
+bool HistoryExtrapolator::predict(const TrackHistoryRing& history, int64_t targetTimeNs,
+                                  std::array<double, 3>& position, std::array<double, 3>& velocity) const noexcept {
+    if (history.size() == 0U) {
+        return false;
+    }
+    const TrackSample& newest = history.newest();
+    const double dt = static_cast<double>(targetTimeNs - newest.time) * NS_TO_SECONDS;
+    switch (options_.model) {
+        case ExtrapolationModel::Polynomial:
+            if (history.size() >= 2U) {
+                return fitPolynomial(history, targetTimeNs, position, velocity);
+            }
+            break;
+        case ExtrapolationModel::ConstantAcceleration:
+            if (history.size() >= 2U) {
+                const TrackSample& previous = history.at(1U);
+                const double interval = static_cast<double>(newest.time - previous.time) * NS_TO_SECONDS;
+                for (std::size_t axis = 0U; axis < 3U; ++axis) {
+                    const double acceleration = (newest.velocity[axis] - previous.velocity[axis]) / interval;
+                    position[axis] = newest.position[axis] + (newest.velocity[axis] * dt) + (0.5 * acceleration * dt * dt);
+                    velocity[axis] = newest.velocity[axis] + (acceleration * dt);
+                }
+                return true;
+            }
+            break;
+        case ExtrapolationModel::ConstantVelocity:
+        default:
+            break;
+    }
+    predictConstantVelocity(newest, dt, position, velocity);
+    return true;
+}
+
+bool HistoryExtrapolator::fitPolynomial(const TrackHistoryRing& history, int64_t targetTimeNs,
+                                        std::array<double, 3>& position,
+                                        std::array<double, 3>& velocity) const noexcept {
+    const std::size_t samples = std::min(options_.fitSamples, history.size());
+    const std::size_t terms = std::min(options_.polynomialDegree, samples - 1U) + 1U;
+    const TrackSample& newest = history.newest();
+    // Time in units of the fit window, 0 at the newest state
+    const double span = static_cast<double>(newest.time - history.at(samples - 1U).time) * NS_TO_SECONDS;
+
+    // Normal equations A c = b for the three axes at once
+    std::array<std::array<double, MAX_DEGREE + 1U>, MAX_DEGREE + 1U> a{};
+    std::array<std::array<double, 3>, MAX_DEGREE + 1U> b{};
+    for (std::size_t k = 0U; k < samples; ++k) {
+        const TrackSample& sample = history.at(k);
+        const double u = (static_cast<double>(sample.time - newest.time) * NS_TO_SECONDS) / span;
+        std::array<double, (2U * MAX_DEGREE) + 1U> powers{};
+        powers[0] = 1.0;
+        for (std::size_t p = 1U; p < ((2U * terms) - 1U); ++p) {
+            powers[p] = powers[p - 1U] * u;
+        }
+        for (std::size_t row = 0U; row < terms; ++row) {
+            for (std::size_t column = 0U; column < terms; ++column) {
+                a[row][column] += powers[row + column];
+            }
+            for (std::size_t axis = 0U; axis < 3U; ++axis) {
+                b[row][axis] += powers[row] * sample.position[axis];
+            }
+        }
+    }
+
+    // Gaussian elimination with partial pivoting
+    for (std::size_t pivot = 0U; pivot < terms; ++pivot) {
+        std::size_t best = pivot;
+        for (std::size_t row = pivot + 1U; row < terms; ++row) {
+            if (std::fabs(a[row][pivot]) > std::fabs(a[best][pivot])) {
+                best = row;
+            }
+        }
+        if (std::fabs(a[best][pivot]) < 1.0e-12) {
+            predictConstantVelocity(newest, static_cast<double>(targetTimeNs - newest.time) * NS_TO_SECONDS,
+                                    position, velocity);
+            return true;
+        }
+        std::swap(a[pivot], a[best]);
+        std::swap(b[pivot], b[best]);
+        for (std::size_t row = 0U; row < terms; ++row) {
+            if (row != pivot) {
+                const double factor = a[row][pivot] / a[pivot][pivot];
+                for (std::size_t column = pivot; column < terms; ++column) {
+                    a[row][column] -= factor * a[pivot][column];
+                }
+                for (std::size_t axis = 0U; axis < 3U; ++axis) {
+                    b[row][axis] -= factor * b[pivot][axis];
+                }
+            }
+        }
+    }
+
+    const double u = (static_cast<double>(targetTimeNs - newest.time) * NS_TO_SECONDS) / span;
+    for (std::size_t axis = 0U; axis < 3U; ++axis) {
+        // Horner evaluation of the polynomial and its derivative
+        double value = 0.0;
+        double slope = 0.0;
+        for (std::size_t term = terms; term > 0U; --term) {
+            const double coefficient = b[term - 1U][axis] / a[term - 1U][term - 1U];
+            slope = (slope * u) + value;
+            value = (value * u) + coefficient;
+        }
+        position[axis] = value;
+        velocity[axis] = slope / span;
+    }
+    return true;
+}
+
+bool HistoryExtrapolator::extrapolate(int64_t trackId, const TrackHistoryRing& history, int64_t targetTimeNs,
+                                      ExtrapTrackData& out) const noexcept {
+    std::array<double, 3> position{};
+    std::array<double, 3> velocity{};
+    if (!predict(history, targetTimeNs, position, velocity)) {
+        return false;
+    }
+    return ExtrapolationEngine::fillMessage(trackId, position, velocity, history.newest().time, targetTimeNs, out);
+}
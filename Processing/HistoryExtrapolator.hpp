@@ -0,0 +1,65 @@
+#pragma once
+
+// MISRA C++ 2023 compliant includes
+#include <array>
+#include <cstddef>
+#include <cstdint>
+
+#include "ExtrapTrackData.hpp"
+#include "TrackHistory.hpp"
+
+/// Motion model used to predict a track from its history
+enum class ExtrapolationModel : uint8_t {
+    ConstantVelocity,     ///< newest position and velocity only
+    ConstantAcceleration, ///< acceleration from the two newest velocities
+    Polynomial            ///< least-squares fit of the newest positions
+};
+
+const char* extrapolationModelName(ExtrapolationModel model) noexcept;
+
+struct ExtrapolatorOptions final {
+    ExtrapolationModel model{ExtrapolationModel::ConstantAcceleration};
+    /// Polynomial: degree of the fit, 1..MAX_DEGREE
+    std::size_t polynomialDegree{2U};
+    /// Polynomial: newest states used for the fit, degree + 1..TrackHistoryRing::CAPACITY
+    std::size_t fitSamples{6U};
+};
+
+/**
+ * @brief Predicts the state of a track at a target time from its history ring.
+ * Models that need more states than the ring holds fall back to the next
+ * simpler one (polynomial degree is lowered, constant acceleration falls
+ * back to constant velocity). Polynomial fits run in time scaled to the
+ * fit window so the normal equations stay well conditioned; the velocity
+ * is the derivative of the fitted polynomial.
+ * Stateless apart from the options; one extrapolator can serve any thread.
+ */
+class HistoryExtrapolator final {
+public:
+    static constexpr std::size_t MAX_DEGREE = 3U;
+
+    /// Throws std::invalid_argument for a degree or sample count the ring cannot support
+    explicit HistoryExtrapolator(const ExtrapolatorOptions& options);
+
+    [[nodiscard]] const ExtrapolatorOptions& getOptions() const noexcept {
+        return options_;
+    }
+
+    /// Position and velocity at targetTimeNs; false when the history is empty
+    bool predict(const TrackHistoryRing& history, int64_t targetTimeNs, std::array<double, 3>& position,
+                 std::array<double, 3>& velocity) const noexcept;
+
+    /**
+     * @brief Fills out with the prediction for trackId at targetTimeNs.
+     * originalUpdateTime is the time of the newest state; see
+     * ExtrapolationEngine::toMessage() for the other fields.
+     */
+    bool extrapolate(int64_t trackId, const TrackHistoryRing& history, int64_t targetTimeNs,
+                     ExtrapTrackData& out) const noexcept;
+
+private:
+    bool fitPolynomial(const TrackHistoryRing& history, int64_t targetTimeNs, std::array<double, 3>& position,
+                       std::array<double, 3>& velocity) const noexcept;
+
+    ExtrapolatorOptions options_;
+};
@@ -0,0 +1,75 @@
+#include "LatencyHistogram.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <stdexcept>
+
+LatencyHistogram::LatencyHistogram(int64_t maxValueNs, unsigned precisionBits)
+    : precisionBits_(precisionBits),
+      subBuckets_(1ULL << std::min(precisionBits, MAX_PRECISION_BITS)),
+      maxValue_(static_cast<uint64_t>(std::max<int64_t>(maxValueNs, 1))) {
+    if ((maxValueNs <= 0) || (precisionBits < MIN_PRECISION_BITS) || (precisionBits > MAX_PRECISION_BITS)) {
+        throw std::invalid_argument("Histogram range must be positive and precision 2..16 bits");
+    }
+    counts_.assign(indexOf(maxValue_) + 1U, 0U);
+}
+
+void LatencyHistogram::merge(const LatencyHistogram& other) {
+    if ((other.precisionBits_ != precisionBits_) || (other.counts_.size() != counts_.size())) {
+        throw std::invalid_argument("Only histograms with the same range and precision can be merged");
+    }
+    for (std::size_t i = 0U; i < counts_.size(); ++i) {
+        counts_[i] += other.counts_[i];
+    }
+    total_ += other.total_;
+    clamped_ += other.clamped_;
+}
+
+void LatencyHistogram::bucketRange(std::size_t index, uint64_t& lower, uint64_t& width) const noexcept {
+    if (index < subBuckets_) {
+        lower = index;
+        width = 1U;
+        return;
+    }
+    const uint64_t half = subBuckets_ / 2U;
+    const uint64_t shift = (index / half) - 1U;
+    lower = (index - (shift * half)) << shift;
+    width = 1ULL << shift;
+}
+
+int64_t LatencyHistogram::valueAtQuantile(double q) const noexcept {
+    int64_t value = 0;
+    valuesAtQuantiles(&q, 1U, &value);
+    return value;
+}
+
+void LatencyHistogram::valuesAtQuantiles(const double* quantiles, std::size_t count, int64_t* values) const noexcept {
+    // The sample at q has rank ceil(q * total), 1-based
+    const auto rankOf = [this](double q) {
+        const double clamped = std::min(1.0, std::max(0.0, q));
+        return std::max<uint64_t>(1U, static_cast<uint64_t>(std::ceil(clamped * static_cast<double>(total_))));
+    };
+    std::size_t next = 0U;
+    uint64_t rank = (count > 0U) ? rankOf(quantiles[0]) : 0U;
+    uint64_t seen = 0U;
+    for (std::size_t i = 0U; (i < counts_.size()) && (next < count) && (total_ > 0U); ++i) {
+        seen += counts_[i];
+        while ((next < count) && (seen >= rank)) {
+            uint64_t lower = 0U;
+            uint64_t width = 0U;
+            bucketRange(i, lower, width);
+            values[next] = static_cast<int64_t>(std::min(lower + (width / 2U), maxValue_));
+            ++next;
+            rank = (next < count) ? rankOf(quantiles[next]) : 0U;
+        }
+    }
+    for (; next < count; ++next) {
+        values[next] = 0;
+    }
+}
+
+void LatencyHistogram::reset() noexcept {
+    std::fill(counts_.begin(), counts_.end(), 0U);
+    total_ = 0U;
+    clamped_ = 0U;
+}
@@ -0,0 +1,88 @@
+#pragma once
+
+// MISRA C++ 2023 compliant includes
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+/**
+ * @brief Mergeable log-linear histogram of latencies (HDR histogram layout).
+ * Values below 2^precisionBits ns have a bucket each. Above that, every
+ * power of two is split into 2^(precisionBits - 1) equal buckets. The
+ * bucket width is therefore a fixed fraction of the value, and a quantile
+ * is off by at most 2^-precisionBits of itself (half a bucket, as the
+ * midpoint is reported): 6 bits keep p99 within 1.6%.
+ * record() is a count-leading-zeros, a shift and an increment, with no
+ * allocation. Histograms with the same layout merge by adding counts, so
+ * per-track sketches can be summed into a fleet-wide one, and sketches of
+ * different threads or processes can be combined.
+ * Values above maxValueNs are counted in the last bucket; negative values
+ * (clock skew) are counted as 0. Both are reported by getClampedCount().
+ * Not thread-safe.
+ */
+class LatencyHistogram final {
+public:
+    static constexpr unsigned MIN_PRECISION_BITS = 2U;
+    static constexpr unsigned MAX_PRECISION_BITS = 16U;
+
+    /// Throws std::invalid_argument for a non-positive maxValueNs or precisionBits outside 2..16
+    explicit LatencyHistogram(int64_t maxValueNs = 10000000000LL, unsigned precisionBits = 6U);
+
+    void record(int64_t valueNs) noexcept {
+        uint64_t value = static_cast<uint64_t>(valueNs);
+        if (valueNs < 0) {
+            value = 0U;
+            ++clamped_;
+        } else if (value > maxValue_) {
+            value = maxValue_;
+            ++clamped_;
+        }
+        ++counts_[indexOf(value)];
+        ++total_;
+    }
+
+    /// Adds the counts of other; throws std::invalid_argument when the layouts differ
+    void merge(const LatencyHistogram& other);
+
+    /// Value at quantile q in 0..1 (midpoint of its bucket), 0 when empty
+    [[nodiscard]] int64_t valueAtQuantile(double q) const noexcept;
+
+    /// valueAtQuantile() of count ascending quantiles in one pass over the buckets
+    void valuesAtQuantiles(const double* quantiles, std::size_t count, int64_t* values) const noexcept;
+
+    [[nodiscard]] uint64_t getCount() const noexcept {
+        return total_;
+    }
+
+    /// Samples recorded as 0 or maxValueNs because they were outside the range
+    [[nodiscard]] uint64_t getClampedCount() const noexcept {
+        return clamped_;
+    }
+
+    [[nodiscard]] std::size_t getBucketCount() const noexcept {
+        return counts_.size();
+    }
+
+    void reset() noexcept;
+
+private:
+    [[nodiscard]] std::size_t indexOf(uint64_t value) const noexcept {
+        if (value < subBuckets_) {
+            return static_cast<std::size_t>(value);
+        }
+        const unsigned msb = 63U - static_cast<unsigned>(__builtin_clzll(value));
+        const unsigned shift = msb - (precisionBits_ - 1U);
+        return static_cast<std::size_t>((static_cast<uint64_t>(shift) * (subBuckets_ / 2U)) + (value >> shift));
+    }
+
+    /// Smallest value of bucket index and its width
+    void bucketRange(std::size_t index, uint64_t& lower, uint64_t& width) const noexcept;
+
+    const unsigned precisionBits_;
+    const uint64_t subBuckets_;
+    const uint64_t maxValue_;
+    /// 64-bit like total_: a hot bucket of a cumulative or merged histogram passes 2^32
+    std::vector<uint64_t> counts_;
+    uint64_t total_{0U};
+    uint64_t clamped_{0U};
+};
@@ -0,0 +1,152 @@
+#include "SlidingDelayWindow.hpp"
+
+#include <stdexcept>
+
+SlidingDelayWindow::SlidingDelayWindow(int64_t windowNs, std::size_t buckets)
+    : bucketNs_((buckets > 0U) ? (windowNs / static_cast<int64_t>(buckets)) : 0),
+      buckets_(buckets),
+      bucketNumbers_(buckets, 0),
+      maxima_(buckets),
+      minima_(buckets) {
+    if ((buckets == 0U) || (bucketNs_ <= 0)) {
+        throw std::invalid_argument("Sliding window needs positive buckets no shorter than 1 ns");
+    }
+}
+
+int64_t SlidingDelayWindow::bucketOf(int64_t eventNs) const noexcept {
+    // Floor division, so negative event times fall into the right bucket too
+    const int64_t quotient = eventNs / bucketNs_;
+    return ((eventNs % bucketNs_) < 0) ? (quotient - 1) : quotient;
+}
+
+std::size_t SlidingDelayWindow::slotOf(int64_t bucket) const noexcept {
+    const int64_t count = static_cast<int64_t>(buckets_.size());
+    return static_cast<std::size_t>(((bucket % count) + count) % count);
+}
+
+bool SlidingDelayWindow::isLive(int64_t bucket) const noexcept {
+    return started_ && (bucket <= newest_) && (bucket > (newest_ - static_cast<int64_t>(buckets_.size())));
+}
+
+bool SlidingDelayWindow::add(int64_t eventNs, double value) noexcept {
+    const int64_t bucket = bucketOf(eventNs);
+    if (!started_) {
+        started_ = true;
+        newest_ = bucket;
+    } else if (bucket > newest_) {
+        advanceTo(bucket);
+    } else if (!isLive(bucket)) {
+        return false;
+    }
+    const std::size_t slot = slotOf(bucket);
+    if (bucketNumbers_[slot] != bucket) {
+        buckets_[slot].reset();
+        bucketNumbers_[slot] = bucket;
+    }
+    buckets_[slot].add(value);
+    if (bucket < newest_) {
+        rebuildExtrema();
+    }
+    return true;
+}
+
+void SlidingDelayWindow::advance(int64_t nowNs) noexcept {
+    const int64_t bucket = bucketOf(nowNs);
+    if (started_ && (bucket > newest_)) {
+        advanceTo(bucket);
+    }
+}
+
+void SlidingDelayWindow::advanceTo(int64_t bucket) noexcept {
+    // The open bucket closes: from now on its extrema live in the deques
+    const std::size_t slot = slotOf(newest_);
+    if (bucketNumbers_[slot] == newest_) {
+        pushExtrema(newest_, buckets_[slot]);
+    }
+    newest_ = bucket;
+    expireExtrema();
+}
+
+void SlidingDelayWindow::pushExtrema(int64_t bucket, const DelayAccumulator& accumulator) noexcept {
+    if (accumulator.count == 0U) {
+        return;
+    }
+    while (!maxima_.empty() && (maxima_.back().value <= accumulator.max)) {
+        maxima_.popBack();
+    }
+    maxima_.pushBack(Extremum{bucket, accumulator.max});
+    while (!minima_.empty() && (minima_.back().value >= accumulator.min)) {
+        minima_.popBack();
+    }
+    minima_.pushBack(Extremum{bucket, accumulator.min});
+}
+
+void SlidingDelayWindow::expireExtrema() noexcept {
+    while (!maxima_.empty() && !isLive(maxima_.front().bucket)) {
+        maxima_.popFront();
+    }
+    while (!minima_.empty() && !isLive(minima_.front().bucket)) {
+        minima_.popFront();
+    }
+}
+
+void SlidingDelayWindow::rebuildExtrema() noexcept {
+    maxima_.clear();
+    minima_.clear();
+    const int64_t oldest = newest_ - static_cast<int64_t>(buckets_.size()) + 1;
+    for (int64_t bucket = oldest; bucket < newest_; ++bucket) {
+        const std::size_t slot = slotOf(bucket);
+        if (bucketNumbers_[slot] == bucket) {
+            pushExtrema(bucket, buckets_[slot]);
+        }
+    }
+}
+
+DelayAccumulator SlidingDelayWindow::snapshot() const noexcept {
+    DelayAccumulator merged;
+    for (std::size_t slot = 0U; slot < buckets_.size(); ++slot) {
+        if (isLive(bucketNumbers_[slot])) {
+            merged.mergeMoments(buckets_[slot]);
+        }
+    }
+    merged.min = min();
+    merged.max = max();
+    return merged;
+}
+
+double SlidingDelayWindow::min() const noexcept {
+    double value = minima_.empty() ? DelayAccumulator{}.min : minima_.front().value;
+    const std::size_t slot = slotOf(newest_);
+    if (started_ && (bucketNumbers_[slot] == newest_) && (buckets_[slot].min < value)) {
+        value = buckets_[slot].min;
+    }
+    return value;
+}
+
+double SlidingDelayWindow::max() const noexcept {
+    double value = maxima_.empty() ? DelayAccumulator{}.max : maxima_.front().value;
+    const std::size_t slot = slotOf(newest_);
+    if (started_ && (bucketNumbers_[slot] == newest_) && (buckets_[slot].max > value)) {
+        value = buckets_[slot].max;
+    }
+    return value;
+}
+
+bool SlidingDelayWindow::empty() const noexcept {
+    for (std::size_t slot = 0U; slot < buckets_.size(); ++slot) {
+        if (isLive(bucketNumbers_[slot]) && (buckets_[slot].count > 0U)) {
+            return false;
+        }
+    }
+    return true;
+}
+
+void SlidingDelayWindow::clear() noexcept {
+    for (DelayAccumulator& bucket : buckets_) {
+        bucket.reset();
+    }
+    started_ = false;
+    newest_ = 0;
+    maxima_.clear();
+    minima_.clear();
+}
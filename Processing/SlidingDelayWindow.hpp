@@ -0,0 +1,110 @@
+#pragma once
+
+// MISRA C++ 2023 compliant includes
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+#include "DelayAccumulator.hpp"
+
+/**
+ * @brief Delay statistics over the last window of event time.
+ * The window is split into a fixed number of buckets. Each bucket is a
+ * DelayAccumulator for its slice of event time, held in a ring. A sample
+ * updates one bucket, and moving the window forward only resets the
+ * buckets it leaves behind, so add() is O(1) and samples are never
+ * rescanned. The window is bucket-granular: it covers between
+ * (buckets - 1) and buckets bucket widths.
+ * min() and max() are O(1). They come from monotonic deques of the
+ * extrema of the closed buckets, plus the open bucket. snapshot() merges
+ * the live buckets for count, mean and variance in O(buckets) and takes
+ * the extrema from min() and max(); it is meant for publication, not for
+ * every sample.
+ * A sample older than the newest bucket but still inside the window is
+ * added to its bucket, and the deques are rebuilt in O(buckets). Samples
+ * older than the window are refused.
+ * All storage is allocated by the constructor. Not thread-safe.
+ */
+class SlidingDelayWindow final {
+public:
+    /// Throws std::invalid_argument unless windowNs and buckets are positive and windowNs >= buckets
+    SlidingDelayWindow(int64_t windowNs, std::size_t buckets);
+
+    /// Adds value observed at eventNs; false when eventNs is already outside the window
+    bool add(int64_t eventNs, double value) noexcept;
+
+    /// Moves the window forward to nowNs without a sample (it never moves back)
+    void advance(int64_t nowNs) noexcept;
+
+    /// Statistics of the samples in the window; min and max are those of min() and max()
+    [[nodiscard]] DelayAccumulator snapshot() const noexcept;
+
+    /// Smallest sample in the window (+infinity when empty)
+    [[nodiscard]] double min() const noexcept;
+    /// Largest sample in the window (-infinity when empty)
+    [[nodiscard]] double max() const noexcept;
+
+    [[nodiscard]] bool empty() const noexcept;
+
+    void clear() noexcept;
+
+private:
+    struct Extremum final {
+        int64_t bucket{0};
+        double value{0.0};
+    };
+
+    /// Fixed capacity deque of bucket extrema, ordered by bucket number
+    class ExtremaDeque final {
+    public:
+        explicit ExtremaDeque(std::size_t capacity) : items_(capacity) {}
+
+        [[nodiscard]] bool empty() const noexcept {
+            return size_ == 0U;
+        }
+        [[nodiscard]] const Extremum& front() const noexcept {
+            return items_[head_];
+        }
+        [[nodiscard]] const Extremum& back() const noexcept {
+            return items_[(head_ + size_ - 1U) % items_.size()];
+        }
+        void popFront() noexcept {
+            head_ = (head_ + 1U) % items_.size();
+            --size_;
+        }
+        void popBack() noexcept {
+            --size_;
+        }
+        void pushBack(const Extremum& item) noexcept {
+            items_[(head_ + size_) % items_.size()] = item;
+            ++size_;
+        }
+        void clear() noexcept {
+            head_ = 0U;
+            size_ = 0U;
+        }
+
+    private:
+        std::vector<Extremum> items_;
+        std::size_t head_{0U};
+        std::size_t size_{0U};
+    };
+
+    [[nodiscard]] int64_t bucketOf(int64_t eventNs) const noexcept;
+    [[nodiscard]] std::size_t slotOf(int64_t bucket) const noexcept;
+    [[nodiscard]] bool isLive(int64_t bucket) const noexcept;
+    void advanceTo(int64_t bucket) noexcept;
+    void pushExtrema(int64_t bucket, const DelayAccumulator& accumulator) noexcept;
+    void expireExtrema() noexcept;
+    void rebuildExtrema() noexcept;
+
+    const int64_t bucketNs_;
+    std::vector<DelayAccumulator> buckets_;
+    std::vector<int64_t> bucketNumbers_;
+    /// Bucket of the newest event time seen
+    int64_t newest_{0};
+    bool started_{false};
+    /// Closed buckets: maxima in decreasing and minima in increasing value order
+    ExtremaDeque maxima_;
+    ExtremaDeque minima_;
+};
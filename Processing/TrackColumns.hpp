@@ -0,0 +1,105 @@
+#pragma once
+
+// MISRA C++ 2023 compliant includes
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+#include "ProcessedTrackData.hpp"
+
+/**
+ * @brief Kinematic state of many tracks as structure-of-arrays columns.
+ * Row i of every column belongs to the same track. Vector kernels stream
+ * over the columns; the model classes are only touched when rows enter or
+ * leave. Columns keep their capacity on clear().
+ */
+struct TrackColumns final {
+    std::vector<int64_t> trackId;
+    std::vector<double> xPosition;
+    std::vector<double> yPosition;
+    std::vector<double> zPosition;
+    std::vector<double> xVelocity;
+    std::vector<double> yVelocity;
+    std::vector<double> zVelocity;
+    /// Time the state is valid at (ProcessedTrackData::updateTime, ns)
+    std::vector<int64_t> updateTime;
+
+    [[nodiscard]] std::size_t size() const noexcept {
+        return trackId.size();
+    }
+
+    void clear() noexcept {
+        resize(0U);
+    }
+
+    void reserve(std::size_t rows) {
+        trackId.reserve(rows);
+        xPosition.reserve(rows);
+        yPosition.reserve(rows);
+        zPosition.reserve(rows);
+        xVelocity.reserve(rows);
+        yVelocity.reserve(rows);
+        zVelocity.reserve(rows);
+        updateTime.reserve(rows);
+    }
+
+    void resize(std::size_t rows) {
+        trackId.resize(rows);
+        xPosition.resize(rows);
+        yPosition.resize(rows);
+        zPosition.resize(rows);
+        xVelocity.resize(rows);
+        yVelocity.resize(rows);
+        zVelocity.resize(rows);
+        updateTime.resize(rows);
+    }
+
+    /// Overwrites row with track
+    void set(std::size_t row, const ProcessedTrackData& track) noexcept {
+        trackId[row] = track.getTrackId();
+        xPosition[row] = track.getXPositionECEF();
+        yPosition[row] = track.getYPositionECEF();
+        zPosition[row] = track.getZPositionECEF();
+        xVelocity[row] = track.getXVelocityECEF();
+        yVelocity[row] = track.getYVelocityECEF();
+        zVelocity[row] = track.getZVelocityECEF();
+        updateTime[row] = track.getUpdateTime();
+    }
+
+    /// Copies row from over row to, e.g. to fill the hole of a removed row with the last one
+    void copyRow(std::size_t from, std::size_t to) noexcept {
+        trackId[to] = trackId[from];
+        xPosition[to] = xPosition[from];
+        yPosition[to] = yPosition[from];
+        zPosition[to] = zPosition[from];
+        xVelocity[to] = xVelocity[from];
+        yVelocity[to] = yVelocity[from];
+        zVelocity[to] = zVelocity[from];
+        updateTime[to] = updateTime[from];
+    }
+
+    /// Adds track as a new row and returns its index
+    std::size_t append(const ProcessedTrackData& track) {
+        const std::size_t row = size();
+        resize(row + 1U);
+        set(row, track);
+        return row;
+    }
+};
+
+/// Extrapolated ECEF positions, row-aligned with the TrackColumns they were computed from
+struct PositionColumns final {
+    std::vector<double> x;
+    std::vector<double> y;
+    std::vector<double> z;
+
+    [[nodiscard]] std::size_t size() const noexcept {
+        return x.size();
+    }
+
+    void resize(std::size_t rows) {
+        x.resize(rows);
+        y.resize(rows);
+        z.resize(rows);
+    }
+};
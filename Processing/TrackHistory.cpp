@@ -0,0 +1,60 @@
+#include "TrackHistory.hpp"
+
+TrackHistoryTable::TrackHistoryTable(std::size_t maxTracks) : rings_(maxTracks), index_(maxTracks) {
+    freeSlots_.reserve(maxTracks);
+    for (std::size_t slot = maxTracks; slot > 0U; --slot) {
+        freeSlots_.push_back(static_cast<uint32_t>(slot - 1U));
+    }
+}
+
+bool TrackHistoryTable::record(const ProcessedTrackData& track) {
+    const uint64_t key = static_cast<uint64_t>(track.getTrackId());
+    uint32_t slot = index_.find(key);
+    if (slot == TrackSlotIndex::NOT_FOUND) {
+        if (freeSlots_.empty()) {
+            rejected_.add();
+            return false;
+        }
+        slot = freeSlots_.back();
+        freeSlots_.pop_back();
+        rings_[slot].clear();
+        index_.insert(key, slot);
+    }
+    TrackSample sample;
+    sample.time = track.getUpdateTime();
+    sample.position = {track.getXPositionECEF(), track.getYPositionECEF(), track.getZPositionECEF()};
+    sample.velocity = {track.getXVelocityECEF(), track.getYVelocityECEF(), track.getZVelocityECEF()};
+    if (!rings_[slot].push(sample)) {
+        outOfOrder_.add();
+        return false;
+    }
+    return true;
+}
+
+const TrackHistoryRing* TrackHistoryTable::find(int64_t trackId) const noexcept {
+    const uint32_t slot = index_.find(static_cast<uint64_t>(trackId));
+    return (slot == TrackSlotIndex::NOT_FOUND) ? nullptr : &rings_[slot];
+}
+
+bool TrackHistoryTable::erase(int64_t trackId) noexcept {
+    const uint64_t key = static_cast<uint64_t>(trackId);
+    const uint32_t slot = index_.find(key);
+    if (slot == TrackSlotIndex::NOT_FOUND) {
+        return false;
+    }
+    (void)index_.erase(key);
+    freeSlots_.push_back(slot);
+    return true;
+}
+
+std::size_t TrackHistoryTable::size() const noexcept {
+    return rings_.size() - freeSlots_.size();
+}
+
+uint64_t TrackHistoryTable::getRejectedCount() const noexcept {
+    return rejected_.load();
+}
+
+uint64_t TrackHistoryTable::getOutOfOrderCount() const noexcept {
+    return outOfOrder_.load();
+}
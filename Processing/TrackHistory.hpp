@@ -0,0 +1,95 @@
+#pragma once
+
+// MISRA C++ 2023 compliant includes
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+#include "ProcessedTrackData.hpp"
+#include "RelaxedCounter.hpp"
+#include "TrackSlotIndex.hpp"
+
+/// One past kinematic state of a track
+struct TrackSample final {
+    int64_t time{0};
+    std::array<double, 3> position{};
+    std::array<double, 3> velocity{};
+};
+
+/**
+ * @brief Fixed-capacity ring of the most recent states of one track.
+ * When full, the oldest state is overwritten. States must arrive in time
+ * order; older or equal timestamps are rejected, so the ring stays sorted.
+ */
+class TrackHistoryRing final {
+public:
+    static constexpr std::size_t CAPACITY = 8U;
+
+    /// False when sample is not newer than the newest state
+    bool push(const TrackSample& sample) noexcept {
+        if ((count_ > 0U) && (sample.time <= newest().time)) {
+            return false;
+        }
+        head_ = (head_ + 1U) % CAPACITY;
+        samples_[head_] = sample;
+        if (count_ < CAPACITY) {
+            ++count_;
+        }
+        return true;
+    }
+
+    /// State age steps back, 0 = newest; age must be below size()
+    [[nodiscard]] const TrackSample& at(std::size_t age) const noexcept {
+        return samples_[(head_ + CAPACITY - age) % CAPACITY];
+    }
+
+    [[nodiscard]] const TrackSample& newest() const noexcept {
+        return samples_[head_];
+    }
+
+    [[nodiscard]] std::size_t size() const noexcept {
+        return count_;
+    }
+
+    void clear() noexcept {
+        count_ = 0U;
+    }
+
+private:
+    std::array<TrackSample, CAPACITY> samples_{};
+    std::size_t head_{CAPACITY - 1U};
+    std::size_t count_{0U};
+};
+
+/**
+ * @brief History rings of up to maxTracks tracks in one flat array.
+ * Rings are allocated once and found through a TrackSlotIndex, so
+ * recording a state never allocates. Erased tracks free their ring for
+ * the next new track. Not thread-safe.
+ */
+class TrackHistoryTable final {
+public:
+    explicit TrackHistoryTable(std::size_t maxTracks);
+
+    /// Appends the state of track; false when the table is full or the state is out of order
+    bool record(const ProcessedTrackData& track);
+
+    /// History of trackId, nullptr when unknown
+    [[nodiscard]] const TrackHistoryRing* find(int64_t trackId) const noexcept;
+
+    bool erase(int64_t trackId) noexcept;
+
+    [[nodiscard]] std::size_t size() const noexcept;
+    /// New tracks refused because every ring was taken
+    [[nodiscard]] uint64_t getRejectedCount() const noexcept;
+    /// States older than the newest one already recorded for their track
+    [[nodiscard]] uint64_t getOutOfOrderCount() const noexcept;
+
+private:
+    std::vector<TrackHistoryRing> rings_;
+    std::vector<uint32_t> freeSlots_;
+    TrackSlotIndex index_;
+    RelaxedCounter rejected_;
+    RelaxedCounter outOfOrder_;
+};
@@ -0,0 +1,388 @@
+#include "TrackStaticsAggregator.hpp"
+
+#include <stdexcept>
+
+#include "TscClock.hpp"
+
+namespace {
+
+/// Upper bound of every TrackStatics delay field
+constexpr double SCHEMA_MAX = 1.0e6;
+/// TrackStatics records converted per publishBatch() call
+constexpr std::size_t PUBLISH_CHUNK = 256U;
+/// Quantiles carried by TrackStaticsPercentiles
+constexpr double QUANTILES[4] = {0.5, 0.9, 0.99, 0.999};
+/// Full expiry sweeps per staleAfter; a stale track lingers at most staleAfter / EXPIRY_PASSES
+constexpr double EXPIRY_PASSES = 4.0;
+
+/// Slots to check per publication so the sweep covers maxTracks EXPIRY_PASSES times per staleAfter
+std::size_t expirySweepSlots(std::size_t maxTracks, int64_t intervalNs, int64_t staleAfterNs) noexcept {
+    if ((intervalNs <= 0) || (staleAfterNs <= 0)) {
+        return maxTracks;
+    }
+    const double slots = static_cast<double>(maxTracks) * EXPIRY_PASSES * static_cast<double>(intervalNs) /
+                         static_cast<double>(staleAfterNs);
+    return (slots >= static_cast<double>(maxTracks)) ? maxTracks : static_cast<std::size_t>(slots) + 1U;
+}
+
+}  // namespace
+
+TrackStaticsAggregator::TrackStaticsAggregator(TrackPublisher& publisher, const TrackStaticsOptions& options)
+    : publisher_(publisher),
+      options_(options),
+      intervalNs_(std::chrono::duration_cast<std::chrono::nanoseconds>(options.publishInterval).count()),
+      staleAfterNs_(std::chrono::duration_cast<std::chrono::nanoseconds>(options.staleAfter).count()),
+      unitNs_(static_cast<double>(options.unit.count())),
+      expirySweep_(expirySweepSlots(options.maxTracks, intervalNs_, staleAfterNs_)),
+      slots_(options.maxTracks),
+      live_(options.maxTracks, 0U),
+      index_(options.maxTracks),
+      batch_(PUBLISH_CHUNK) {
+    if ((intervalNs_ <= 0) || (options.unit.count() <= 0) || (options.maxTracks == 0U)) {
+        throw std::invalid_argument("Statistics interval, unit and track capacity must be positive");
+    }
+    freeSlots_.reserve(options.maxTracks);
+    for (std::size_t slot = options.maxTracks; slot > 0U; --slot) {
+        freeSlots_.push_back(static_cast<uint32_t>(slot - 1U));
+    }
+    dirtySlots_.reserve(options.maxTracks);
+    if (options.window.count() > 0) {
+        const int64_t windowNs = std::chrono::duration_cast<std::chrono::nanoseconds>(options.window).count();
+        windows_.reserve(options.maxTracks);
+        for (std::size_t slot = 0U; slot < options.maxTracks; ++slot) {
+            windows_.emplace_back(windowNs, options.windowBuckets);
+        }
+    }
+    if (options.percentiles) {
+        const int64_t rangeNs = std::chrono::duration_cast<std::chrono::nanoseconds>(options.histogramRange).count();
+        histograms_.reserve(options.maxTracks);
+        for (std::size_t slot = 0U; slot < options.maxTracks; ++slot) {
+            histograms_.emplace_back(rangeNs, options.histogramPrecisionBits);
+        }
+        percentileBatch_.resize(PUBLISH_CHUNK);
+    }
+}
+
+void TrackStaticsAggregator::attach(TrackMessageDispatcher& dispatcher) {
+    dispatcher.subscribe<FinalCalcTrackData>([this](const FinalCalcTrackData& message) {
+        (void)update(message);
+    });
+}
+
+bool TrackStaticsAggregator::update(const FinalCalcTrackData& message) {
+    const uint64_t key = static_cast<uint64_t>(message.getTrackId());
+    uint32_t slot = index_.find(key);
+    if (slot == TrackSlotIndex::NOT_FOUND) {
+        if (freeSlots_.empty()) {
+            rejected_.add();
+            return false;
+        }
+        slot = freeSlots_.back();
+        freeSlots_.pop_back();
+        slots_[slot] = TrackDelayStatistics{};
+        slots_[slot].trackId = message.getTrackId();
+        if (!windows_.empty()) {
+            windows_[slot].firstHop.clear();
+            windows_[slot].secondHop.clear();
+            windows_[slot].total.clear();
+        }
+        if (!histograms_.empty()) {
+            histograms_[slot].reset();
+        }
+        live_[slot] = 1U;
+        index_.insert(key, slot);
+    }
+    const double firstHop = static_cast<double>(message.getFirstHopDelayTime());
+    const double secondHop = static_cast<double>(message.getSecondHopDelayTime());
+    const double total = static_cast<double>(message.getTotalDelayTime());
+    TrackDelayStatistics& track = slots_[slot];
+    track.firstHop.add(firstHop);
+    track.secondHop.add(secondHop);
+    track.total.add(total);
+    if (!windows_.empty()) {
+        const int64_t sentNs = message.getThirdHopSentTime();
+        const int64_t eventNs = (sentNs != 0) ? sentNs : TscClock::realtimeNs();
+        TrackDelayWindows& windows = windows_[slot];
+        (void)windows.firstHop.add(eventNs, firstHop);
+        (void)windows.secondHop.add(eventNs, secondHop);
+        if (!windows.total.add(eventNs, total)) {
+            outOfWindow_.add();
+        }
+    }
+    if (!histograms_.empty()) {
+        TrackDelayHistograms& histograms = histograms_[slot];
+        histograms.firstHop.record(message.getFirstHopDelayTime());
+        histograms.secondHop.record(message.getSecondHopDelayTime());
+        histograms.total.record(message.getTotalDelayTime());
+    }
+    if (!track.dirty) {
+        track.dirty = true;
+        dirtySlots_.push_back(slot);
+    }
+    updates_.add();
+    return true;
+}
+
+bool TrackStaticsAggregator::poll() {
+    return poll(TscClock::realtimeNs());
+}
+
+bool TrackStaticsAggregator::poll(int64_t nowNs) {
+    if (nextPublishNs_ == 0) {
+        nextPublishNs_ = ((nowNs / intervalNs_) + 1) * intervalNs_;
+        return false;
+    }
+    if (nowNs < nextPublishNs_) {
+        return false;
+    }
+    nextPublishNs_ += (((nowNs - nextPublishNs_) / intervalNs_) + 1) * intervalNs_;
+    (void)publish(nowNs);
+    return true;
+}
+
+std::size_t TrackStaticsAggregator::publish(int64_t nowNs) {
+    const std::size_t sent = windows_.empty() ? publishCumulative(nowNs) : publishWindows(nowNs);
+    expire(nowNs);
+    return sent;
+}
+
+void TrackStaticsAggregator::expire(int64_t nowNs) {
+    for (std::size_t checked = 0U; checked < expirySweep_; ++checked) {
+        const std::size_t slot = expiryCursor_;
+        expiryCursor_ = ((slot + 1U) == slots_.size()) ? 0U : (slot + 1U);
+        if ((live_[slot] != 0U) && ((nowNs - slots_[slot].lastActiveNs) > staleAfterNs_)) {
+            (void)erase(slots_[slot].trackId);
+            expired_.add();
+        }
+    }
+}
+
+std::size_t TrackStaticsAggregator::publishCumulative(int64_t nowNs) {
+    std::size_t sent = 0U;
+    std::size_t count = 0U;
+    for (const uint32_t slot : dirtySlots_) {
+        TrackDelayStatistics& track = slots_[slot];
+        // A slot erased (and maybe reused) since it became dirty is listed twice or not dirty at all
+        if (!track.dirty) {
+            continue;
+        }
+        track.dirty = false;
+        track.lastActiveNs = nowNs;
+        enqueue(track, slot, nowNs, count, sent);
+    }
+    dirtySlots_.clear();
+    sent += send(count) ? count : 0U;
+    return sent;
+}
+
+std::size_t TrackStaticsAggregator::publishWindows(int64_t nowNs) {
+    for (const uint32_t slot : dirtySlots_) {
+        slots_[slot].dirty = false;
+        slots_[slot].lastActiveNs = nowNs;
+    }
+    dirtySlots_.clear();
+
+    std::size_t sent = 0U;
+    std::size_t count = 0U;
+    TrackDelayStatistics statistics;
+    for (std::size_t slot = 0U; slot < slots_.size(); ++slot) {
+        if (live_[slot] == 0U) {
+            continue;
+        }
+        TrackDelayWindows& windows = windows_[slot];
+        windows.firstHop.advance(nowNs);
+        windows.secondHop.advance(nowNs);
+        windows.total.advance(nowNs);
+        if (windows.total.empty()) {
+            continue;
+        }
+        statistics.trackId = slots_[slot].trackId;
+        // Moments merged over the buckets, extrema from the windows' O(1) deques
+        statistics.firstHop = windows.firstHop.snapshot();
+        statistics.secondHop = windows.secondHop.snapshot();
+        statistics.total = windows.total.snapshot();
+        enqueue(statistics, slot, nowNs, count, sent);
+    }
+    sent += send(count) ? count : 0U;
+    return sent;
+}
+
+void TrackStaticsAggregator::enqueue(const TrackDelayStatistics& statistics, std::size_t slot, int64_t nowNs,
+                                     std::size_t& count, std::size_t& sent) {
+    toMessage(statistics, nowNs, batch_[count]);
+    if (!histograms_.empty()) {
+        toMessage(statistics.trackId, histograms_[slot], nowNs, percentileBatch_[count]);
+        if (options_.resetPercentilesOnPublish) {
+            histograms_[slot].reset();
+        }
+    }
+    ++count;
+    if (count == batch_.size()) {
+        sent += send(count) ? count : 0U;
+        count = 0U;
+    }
+}
+
+bool TrackStaticsAggregator::send(std::size_t count) {
+    if (count == 0U) {
+        return true;
+    }
+    const bool sent = publisher_.publishBatch(batch_.data(), count, options_.maxDatagramBytes);
+    if (sent) {
+        published_.add(count);
+    } else {
+        sendFailures_.add();
+    }
+    // The percentiles follow the TrackStatics of the same tracks
+    if (!histograms_.empty()) {
+        if (publisher_.publishBatch(percentileBatch_.data(), count, options_.maxDatagramBytes)) {
+            percentilesPublished_.add(count);
+        } else {
+            sendFailures_.add();
+        }
+    }
+    return sent;
+}
+
+double TrackStaticsAggregator::toUnit(double delayNs) {
+    const double value = delayNs / unitNs_;
+    if (value < 0.0) {
+        clamped_.add();
+        return 0.0;
+    }
+    if (value > SCHEMA_MAX) {
+        clamped_.add();
+        return SCHEMA_MAX;
+    }
+    return value;
+}
+
+void TrackStaticsAggregator::toMessage(const TrackDelayStatistics& statistics, int64_t updateTimeNs,
+                                       TrackStatics& out) {
+    out.setTrackId(statistics.trackId);
+    out.setFirstHopDelayDataMean(toUnit(statistics.firstHop.mean));
+    out.setFirstHopDelayDataStd(toUnit(statistics.firstHop.stddev()));
+    out.setFirstHopDelayDataMin(toUnit(statistics.firstHop.min));
+    out.setFirstHopDelayDataMax(toUnit(statistics.firstHop.max));
+    out.setSecondHopDelayDataMean(toUnit(statistics.secondHop.mean));
+    out.setSecondHopDelayDataStd(toUnit(statistics.secondHop.stddev()));
+    out.setSecondHopDelayDataMin(toUnit(statistics.secondHop.min));
+    out.setSecondHopDelayDataMax(toUnit(statistics.secondHop.max));
+    out.setTotalHopDelayDataMean(toUnit(statistics.total.mean));
+    out.setTotalHopDelayDataStd(toUnit(statistics.total.stddev()));
+    out.setTotalHopDelayDataMin(toUnit(statistics.total.min));
+    out.setTotalHopDelayDataMax(toUnit(statistics.total.max));
+    out.setUpdateTime(updateTimeNs);
+}
+
+void TrackStaticsAggregator::toMessage(int64_t trackId, const TrackDelayHistograms& histograms, int64_t updateTimeNs,
+                                       TrackStaticsPercentiles& out) {
+    int64_t firstHop[4];
+    int64_t secondHop[4];
+    int64_t total[4];
+    histograms.firstHop.valuesAtQuantiles(QUANTILES, 4U, firstHop);
+    histograms.secondHop.valuesAtQuantiles(QUANTILES, 4U, secondHop);
+    histograms.total.valuesAtQuantiles(QUANTILES, 4U, total);
+    const uint64_t samples = histograms.total.getCount();
+    out.setTrackId(trackId);
+    out.setSampleCount((samples > 0xFFFFFFFFULL) ? 0xFFFFFFFFU : static_cast<uint32_t>(samples));
+    out.setFirstHopDelayDataP50(toUnit(static_cast<double>(firstHop[0])));
+    out.setFirstHopDelayDataP90(toUnit(static_cast<double>(firstHop[1])));
+    out.setFirstHopDelayDataP99(toUnit(static_cast<double>(firstHop[2])));
+    out.setFirstHopDelayDataP999(toUnit(static_cast<double>(firstHop[3])));
+    out.setSecondHopDelayDataP50(toUnit(static_cast<double>(secondHop[0])));
+    out.setSecondHopDelayDataP90(toUnit(static_cast<double>(secondHop[1])));
+    out.setSecondHopDelayDataP99(toUnit(static_cast<double>(secondHop[2])));
+    out.setSecondHopDelayDataP999(toUnit(static_cast<double>(secondHop[3])));
+    out.setTotalHopDelayDataP50(toUnit(static_cast<double>(total[0])));
+    out.setTotalHopDelayDataP90(toUnit(static_cast<double>(total[1])));
+    out.setTotalHopDelayDataP99(toUnit(static_cast<double>(total[2])));
+    out.setTotalHopDelayDataP999(toUnit(static_cast<double>(total[3])));
+    out.setUpdateTime(updateTimeNs);
+}
+
+const TrackDelayStatistics* TrackStaticsAggregator::find(int64_t trackId) const noexcept {
+    const uint32_t slot = index_.find(static_cast<uint64_t>(trackId));
+    return (slot == TrackSlotIndex::NOT_FOUND) ? nullptr : &slots_[slot];
+}
+
+const TrackDelayWindows* TrackStaticsAggregator::findWindows(int64_t trackId) const noexcept {
+    const uint32_t slot = index_.find(static_cast<uint64_t>(trackId));
+    return ((slot == TrackSlotIndex::NOT_FOUND) || windows_.empty()) ? nullptr : &windows_[slot];
+}
+
+const TrackDelayHistograms* TrackStaticsAggregator::findHistograms(int64_t trackId) const noexcept {
+    const uint32_t slot = index_.find(static_cast<uint64_t>(trackId));
+    return ((slot == TrackSlotIndex::NOT_FOUND) || histograms_.empty()) ? nullptr : &histograms_[slot];
+}
+
+bool TrackStaticsAggregator::mergeHistograms(TrackDelayHistograms& out) const {
+    if (histograms_.empty()) {
+        return false;
+    }
+    for (std::size_t slot = 0U; slot < histograms_.size(); ++slot) {
+        if (live_[slot] != 0U) {
+            out.merge(histograms_[slot]);
+        }
+    }
+    return true;
+}
+
+bool TrackStaticsAggregator::erase(int64_t trackId) noexcept {
+    const uint64_t key = static_cast<uint64_t>(trackId);
+    const uint32_t slot = index_.find(key);
+    if (slot == TrackSlotIndex::NOT_FOUND) {
+        return false;
+    }
+    (void)index_.erase(key);
+    slots_[slot].dirty = false;
+    live_[slot] = 0U;
+    freeSlots_.push_back(slot);
+    return true;
+}
+
+uint64_t TrackStaticsAggregator::getUpdateCount() const noexcept {
+    return updates_.load();
+}
+
+uint64_t TrackStaticsAggregator::getPublishedCount() const noexcept {
+    return published_.load();
+}
+
+uint64_t TrackStaticsAggregator::getPercentilesPublishedCount() const noexcept {
+    return percentilesPublished_.load();
+}
+
+uint64_t TrackStaticsAggregator::getRejectedCount() const noexcept {
+    return rejected_.load();
+}
+
+uint64_t TrackStaticsAggregator::getExpiredCount() const noexcept {
+    return expired_.load();
+}
+
+uint64_t TrackStaticsAggregator::getClampedCount() const noexcept {
+    return clamped_.load();
+}
+
+uint64_t TrackStaticsAggregator::getOutOfWindowCount() const noexcept {
+    return outOfWindow_.load();
+}
+
+uint64_t TrackStaticsAggregator::getSendFailureCount() const noexcept {
+    return sendFailures_.load();
+}
+
+void TrackStaticsAggregator::registerMetrics(TransportMetrics& metrics, const std::string& prefix) const {
+    metrics.addCollector([this, prefix](std::vector<MetricSample>& samples) {
+        samples.push_back({prefix + ".updates", updates_.load()});
+        samples.push_back({prefix + ".published", published_.load()});
+        samples.push_back({prefix + ".percentiles_published", percentilesPublished_.load()});
+        samples.push_back({prefix + ".rejected", rejected_.load()});
+        samples.push_back({prefix + ".expired", expired_.load()});
+        samples.push_back({prefix + ".clamped", clamped_.load()});
+        samples.push_back({prefix + ".out_of_window", outOfWindow_.load()});
+        samples.push_back({prefix + ".send_failures", sendFailures_.load()});
+        samples.push_back({prefix + ".tracks", static_cast<uint64_t>(size())});
+    });
+}
@@ -0,0 +1,218 @@
+#pragma once
+
+// MISRA C++ 2023 compliant includes
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+#include "DelayAccumulator.hpp"
+#include "FinalCalcTrackData.hpp"
+#include "LatencyHistogram.hpp"
+#include "RelaxedCounter.hpp"
+#include "SlidingDelayWindow.hpp"
+#include "TrackMessageDispatcher.hpp"
+#include "TrackPublisher.hpp"
+#include "TrackSlotIndex.hpp"
+#include "TrackStatics.hpp"
+#include "TrackStaticsPercentiles.hpp"
+#include "TransportMetrics.hpp"
+
+struct TrackStaticsOptions final {
+    /// Cadence of the TrackStatics publication; only tracks with new samples are sent
+    std::chrono::milliseconds publishInterval{1000};
+    /// Tracks without a sample for this long are forgotten, at most a quarter of it later
+    std::chrono::milliseconds staleAfter{60000};
+    /// Capacity of the track table, allocated up front
+    std::size_t maxTracks{100000U};
+    /// Event-time window of the published statistics (0 = cumulative over the life of the track)
+    std::chrono::milliseconds window{0};
+    /// Buckets per window; more buckets track the window edge more closely at a higher publication cost
+    std::size_t windowBuckets{10U};
+    /// Also keep a LatencyHistogram per track and hop and publish TrackStaticsPercentiles
+    bool percentiles{false};
+    /// Histogram precision: quantiles within 2^-bits of their value (6 = 1.6%)
+    unsigned histogramPrecisionBits{6U};
+    /// Largest delay the histograms resolve; longer delays count as this
+    std::chrono::milliseconds histogramRange{10000};
+    /// Start the histograms afresh after each publication, so percentiles cover one interval
+    bool resetPercentilesOnPublish{false};
+    /// Delay unit of the published statistics (1000 = microseconds, so the schema range 0..1e6 covers 1 s)
+    std::chrono::nanoseconds unit{1000};
+    /// Datagram budget handed to TrackPublisher::publishBatch()
+    std::size_t maxDatagramBytes{1400U};
+};
+
+/// Accumulated delays of one track
+struct TrackDelayStatistics final {
+    int64_t trackId{0};
+    /// Last publication that carried new samples of the track, CLOCK_REALTIME ns
+    int64_t lastActiveNs{0};
+    DelayAccumulator firstHop{};
+    DelayAccumulator secondHop{};
+    DelayAccumulator total{};
+    /// Has samples the last publication did not include
+    bool dirty{false};
+};
+
+/// Sliding-window delays of one track, kept when TrackStaticsOptions::window is set
+struct TrackDelayWindows final {
+    TrackDelayWindows(int64_t windowNs, std::size_t buckets)
+        : firstHop(windowNs, buckets), secondHop(windowNs, buckets), total(windowNs, buckets) {}
+
+    SlidingDelayWindow firstHop;
+    SlidingDelayWindow secondHop;
+    SlidingDelayWindow total;
+};
+
+/// Delay histograms of one track, kept when TrackStaticsOptions::percentiles is set
+struct TrackDelayHistograms final {
+    TrackDelayHistograms(int64_t rangeNs, unsigned precisionBits)
+        : firstHop(rangeNs, precisionBits), secondHop(rangeNs, precisionBits), total(rangeNs, precisionBits) {}
+
+    void merge(const TrackDelayHistograms& other) {
+        firstHop.merge(other.firstHop);
+        secondHop.merge(other.secondHop);
+        total.merge(other.total);
+    }
+
+    void reset() noexcept {
+        firstHop.reset();
+        secondHop.reset();
+        total.reset();
+    }
+
+    LatencyHistogram firstHop;
+    LatencyHistogram secondHop;
+    LatencyHistogram total;
+};
+
+/**
+ * @brief Turns the FinalCalcTrackData stream into per-track TrackStatics.
+ * update() adds the three hop delays of a record to Welford accumulators
+ * (DelayAccumulator) of its track. Tracks live in one flat array that is
+ * allocated once and found through a TrackSlotIndex, so an update is a
+ * hash probe and three accumulator updates without allocation.
+ * Every publishInterval, poll() converts the tracks that received samples
+ * since the last publication to TrackStatics and sends them with
+ * publishBatch(). The statistics are cumulative over the life of the
+ * track, unless options.window is set. Then every track also keeps a
+ * SlidingDelayWindow per hop, fed with the thirdHopSentTime of each record
+ * as its event time, and each publication sends the window statistics of
+ * every track whose window still holds samples. A window costs about
+ * 80 bytes per bucket and hop, allocated up front for maxTracks.
+ * With options.percentiles every track also keeps a LatencyHistogram per
+ * hop, and every published TrackStatics is followed by a
+ * TrackStaticsPercentiles with p50/p90/p99/p99.9 of the same track; the
+ * publisher must advertise both types. The histograms are cumulative (or
+ * cover one publication interval with resetPercentilesOnPublish) even in
+ * window mode. They cost about 7.5 KB per hop at the default precision.
+ * Delays are published in options.unit and clamped to the schema
+ * range 0..1e6; negative delays (clock skew) therefore show as 0 and are
+ * counted. Tracks without a sample for staleAfter are dropped by an
+ * incremental sweep: each publication checks only as many slots as it
+ * takes to cover the table four times per staleAfter.
+ * Not thread-safe: feed update() and drive poll() from one thread.
+ */
+class TrackStaticsAggregator final {
+public:
+    /// Throws std::invalid_argument for a zero interval, unit or track capacity, a window shorter than its
+    /// buckets, or a histogram layout LatencyHistogram refuses
+    explicit TrackStaticsAggregator(TrackPublisher& publisher, const TrackStaticsOptions& options = {});
+
+    /// Feeds every FinalCalcTrackData that dispatcher decodes into the aggregator
+    void attach(TrackMessageDispatcher& dispatcher);
+
+    /// Accumulates the delays of one record; false when the table is full
+    bool update(const FinalCalcTrackData& message);
+
+    /// Publishes when the interval has elapsed; returns true when a publication ran
+    bool poll();
+    bool poll(int64_t nowNs);
+
+    /// Publishes every track with new samples, stamped nowNs; returns the number of records sent
+    std::size_t publish(int64_t nowNs);
+
+    /// Statistics of trackId, nullptr when unknown
+    [[nodiscard]] const TrackDelayStatistics* find(int64_t trackId) const noexcept;
+
+    /// Sliding windows of trackId, nullptr when unknown or without options.window
+    [[nodiscard]] const TrackDelayWindows* findWindows(int64_t trackId) const noexcept;
+
+    /// Histograms of trackId, nullptr when unknown or without options.percentiles
+    [[nodiscard]] const TrackDelayHistograms* findHistograms(int64_t trackId) const noexcept;
+
+    /// Merges the histograms of every live track into out (same layout); false without options.percentiles
+    bool mergeHistograms(TrackDelayHistograms& out) const;
+
+    bool erase(int64_t trackId) noexcept;
+
+    /// Fills out from statistics; values clamped to the schema range are counted
+    void toMessage(const TrackDelayStatistics& statistics, int64_t updateTimeNs, TrackStatics& out);
+
+    /// Fills out with the p50/p90/p99/p99.9 of histograms; values clamped to the schema range are counted
+    void toMessage(int64_t trackId, const TrackDelayHistograms& histograms, int64_t updateTimeNs,
+                   TrackStaticsPercentiles& out);
+
+    [[nodiscard]] std::size_t size() const noexcept {
+        return slots_.size() - freeSlots_.size();
+    }
+
+    [[nodiscard]] uint64_t getUpdateCount() const noexcept;
+    [[nodiscard]] uint64_t getPublishedCount() const noexcept;
+    [[nodiscard]] uint64_t getPercentilesPublishedCount() const noexcept;
+    /// Records of new tracks refused because maxTracks were live
+    [[nodiscard]] uint64_t getRejectedCount() const noexcept;
+    [[nodiscard]] uint64_t getExpiredCount() const noexcept;
+    /// Published values clamped into 0..1e6
+    [[nodiscard]] uint64_t getClampedCount() const noexcept;
+    /// Records whose event time had already left the window
+    [[nodiscard]] uint64_t getOutOfWindowCount() const noexcept;
+    /// Batches the publisher failed to send
+    [[nodiscard]] uint64_t getSendFailureCount() const noexcept;
+
+    /// Exposes the counters under prefix
+    void registerMetrics(TransportMetrics& metrics, const std::string& prefix = "track_statics") const;
+
+private:
+    /// Converts one delay to the published unit, clamped to the schema range
+    double toUnit(double delayNs);
+    /// Queues statistics (and the histograms of slot) for publication, sending the batches when full
+    void enqueue(const TrackDelayStatistics& statistics, std::size_t slot, int64_t nowNs, std::size_t& count,
+                 std::size_t& sent);
+    bool send(std::size_t count);
+    /// Drops the stale tracks among the next expirySweep_ slots
+    void expire(int64_t nowNs);
+    std::size_t publishCumulative(int64_t nowNs);
+    std::size_t publishWindows(int64_t nowNs);
+
+    TrackPublisher& publisher_;
+    const TrackStaticsOptions options_;
+    const int64_t intervalNs_;
+    const int64_t staleAfterNs_;
+    const double unitNs_;
+    /// Slots the expiry sweep checks per publication
+    const std::size_t expirySweep_;
+
+    std::vector<TrackDelayStatistics> slots_;
+    std::vector<TrackDelayWindows> windows_;
+    std::vector<TrackDelayHistograms> histograms_;
+    std::vector<uint8_t> live_;
+    std::vector<uint32_t> freeSlots_;
+    std::vector<uint32_t> dirtySlots_;
+    TrackSlotIndex index_;
+    std::vector<TrackStatics> batch_;
+    std::vector<TrackStaticsPercentiles> percentileBatch_;
+    int64_t nextPublishNs_{0};
+    std::size_t expiryCursor_{0U};
+
+    RelaxedCounter updates_;
+    RelaxedCounter published_;
+    RelaxedCounter percentilesPublished_;
+    RelaxedCounter rejected_;
+    RelaxedCounter expired_;
+    RelaxedCounter clamped_;
+    RelaxedCounter outOfWindow_;
+    RelaxedCounter sendFailures_;
+};
@@ -0,0 +1,108 @@
+#include "BoundedRecordQueue.hpp"
+
+#include <cstring>
+#include <stdexcept>
+
+BoundedRecordQueue::BoundedRecordQueue(const HighWaterMark& limit) : limit_(limit), slots_(limit.records) {
+    if (limit_.records == 0U) {
+        throw std::invalid_argument("BoundedRecordQueue high-water mark must be positive");
+    }
+    if (limit_.policy == OverflowPolicy::ConflatePerTrack) {
+        index_ = std::make_unique<TrackSlotIndex>(limit_.records);
+    }
+}
+
+BoundedRecordQueue::PushResult BoundedRecordQueue::push(uint64_t trackId, const uint8_t* record,
+                                                        std::size_t size) noexcept {
+    if (size > MAX_RECORD_SIZE) {
+        droppedNewest_.add();
+        return PushResult::DroppedNewest;
+    }
+    const std::lock_guard<std::mutex> lock(mutex_);
+    if (index_) {
+        const uint32_t pending = index_->find(trackId);
+        if (pending != TrackSlotIndex::NOT_FOUND) {
+            write(pending, trackId, record, size);
+            conflated_.add();
+            return PushResult::Conflated;
+        }
+    }
+
+    PushResult result = PushResult::Queued;
+    if (count_ == slots_.size()) {
+        switch (limit_.policy) {
+            case OverflowPolicy::Block:
+                return PushResult::Full;
+            case OverflowPolicy::DropNewest:
+                droppedNewest_.add();
+                return PushResult::DroppedNewest;
+            case OverflowPolicy::DropOldest:
+            case OverflowPolicy::ConflatePerTrack:
+            default:
+                dropHead();
+                droppedOldest_.add();
+                result = PushResult::DroppedOldest;
+                break;
+        }
+    }
+    const uint32_t slot = static_cast<uint32_t>((head_ + count_) % slots_.size());
+    write(slot, trackId, record, size);
+    ++count_;
+    if (index_) {
+        index_->insert(trackId, slot);
+    }
+    return result;
+}
+
+bool BoundedRecordQueue::pop(Record& out) noexcept {
+    const std::lock_guard<std::mutex> lock(mutex_);
+    if (count_ == 0U) {
+        return false;
+    }
+    const Record& head = slots_[head_];
+    out.trackId = head.trackId;
+    out.size = head.size;
+    std::memcpy(out.bytes.data(), head.bytes.data(), head.size);
+    if (index_) {
+        (void)index_->erase(head.trackId);
+    }
+    head_ = (head_ + 1U) % slots_.size();
+    --count_;
+    return true;
+}
+
+void BoundedRecordQueue::dropHead() noexcept {
+    if (index_) {
+        (void)index_->erase(slots_[head_].trackId);
+    }
+    head_ = (head_ + 1U) % slots_.size();
+    --count_;
+}
+
+void BoundedRecordQueue::write(uint32_t slot, uint64_t trackId, const uint8_t* record, std::size_t size) noexcept {
+    Record& target = slots_[slot];
+    target.trackId = trackId;
+    target.size = static_cast<uint8_t>(size);
+    std::memcpy(target.bytes.data(), record, size);
+}
+
+std::size_t BoundedRecordQueue::size() const noexcept {
+    const std::lock_guard<std::mutex> lock(mutex_);
+    return count_;
+}
+
+const HighWaterMark& BoundedRecordQueue::getLimit() const noexcept {
+    return limit_;
+}
+
+uint64_t BoundedRecordQueue::getDroppedNewest() const noexcept {
+    return droppedNewest_.load();
+}
+
+uint64_t BoundedRecordQueue::getDroppedOldest() const noexcept {
+    return droppedOldest_.load();
+}
+
+uint64_t BoundedRecordQueue::getConflated() const noexcept {
+    return conflated_.load();
+}
@@ -0,0 +1,77 @@
+#pragma once
+
+// MISRA C++ 2023 compliant includes
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+#include "OverflowPolicy.hpp"
+#include "RelaxedCounter.hpp"
+#include "TrackSlotIndex.hpp"
+
+/**
+ * @brief Bounded FIFO of raw serialized records that applies an OverflowPolicy
+ * at its high-water mark and counts what it sheds, per policy.
+ * Slots and the trackId index are allocated up front; push/pop copy at most
+ * MAX_RECORD_SIZE bytes under a short mutex, because DropOldest and
+ * conflation let the producer remove entries the consumer would read next.
+ * ConflatePerTrack keeps the position of the first pending record of a track
+ * and overwrites its bytes, so a track never holds more than one slot.
+ * Intended for one producer and one consumer thread.
+ */
+class BoundedRecordQueue final {
+public:
+    static constexpr std::size_t MAX_RECORD_SIZE = 128U;
+
+    struct Record final {
+        uint64_t trackId{0U};
+        uint8_t size{0U};
+        std::array<uint8_t, MAX_RECORD_SIZE> bytes{};
+    };
+
+    enum class PushResult : uint8_t {
+        Queued,
+        Conflated,
+        DroppedNewest,
+        DroppedOldest,  ///< queued after discarding the oldest record
+        Full            ///< Block policy: nothing queued, retry later
+    };
+
+    explicit BoundedRecordQueue(const HighWaterMark& limit);
+
+    // Copy constructor
+    BoundedRecordQueue(const BoundedRecordQueue& other) = delete;
+
+    // Copy assignment operator
+    BoundedRecordQueue& operator=(const BoundedRecordQueue& other) = delete;
+
+    // Destructor
+    ~BoundedRecordQueue() = default;
+
+    PushResult push(uint64_t trackId, const uint8_t* record, std::size_t size) noexcept;
+    bool pop(Record& out) noexcept;
+
+    [[nodiscard]] std::size_t size() const noexcept;
+    [[nodiscard]] const HighWaterMark& getLimit() const noexcept;
+    [[nodiscard]] uint64_t getDroppedNewest() const noexcept;
+    [[nodiscard]] uint64_t getDroppedOldest() const noexcept;
+    [[nodiscard]] uint64_t getConflated() const noexcept;
+
+private:
+    void dropHead() noexcept;
+    void write(uint32_t slot, uint64_t trackId, const uint8_t* record, std::size_t size) noexcept;
+
+    HighWaterMark limit_;
+    std::vector<Record> slots_;
+    std::size_t head_{0U};
+    std::size_t count_{0U};
+    std::unique_ptr<TrackSlotIndex> index_;
+    mutable std::mutex mutex_;
+
+    RelaxedCounter droppedNewest_;
+    RelaxedCounter droppedOldest_;
+    RelaxedCounter conflated_;
+};
@@ -0,0 +1,100 @@
+#include "BusyPollEngine.hpp"
+
+#include <chrono>
+
+namespace {
+
+inline void cpuRelax() noexcept {
+#if defined(__x86_64__) || defined(__i386__)
+    __builtin_ia32_pause();
+#endif
+}
+
+}  // namespace
+
+BusyPollEngine::BusyPollEngine() : BusyPollEngine(Options{}) {}
+
+BusyPollEngine::BusyPollEngine(const Options& options) : options_(options), buffer_(MAX_DATAGRAM_SIZE) {}
+
+std::size_t BusyPollEngine::addReceiver(const EndpointConfig& config) {
+    EndpointConfig tuned = config;
+    if (tuned.busyPollMicros == 0) {
+        tuned.busyPollMicros = options_.busyPollMicros;
+    }
+    MulticastSocket socket = MulticastSocket::openReceiver(tuned);
+    socket.setNonBlocking(true);
+    sockets_.push_back(std::move(socket));
+    receivers_.push_back(sockets_.size() - 1U);
+    return sockets_.size() - 1U;
+}
+
+std::size_t BusyPollEngine::addSender(const EndpointConfig& config) {
+    sockets_.push_back(MulticastSocket::openSender(config));
+    return sockets_.size() - 1U;
+}
+
+bool BusyPollEngine::send(std::size_t endpoint, const uint8_t* data, std::size_t size) {
+    if (endpoint >= sockets_.size()) {
+        return false;
+    }
+    return sockets_[endpoint].send(data, size);
+}
+
+bool BusyPollEngine::sendv(std::size_t endpoint, const iovec* vectors, std::size_t count) {
+    if (endpoint >= sockets_.size()) {
+        return false;
+    }
+    return sockets_[endpoint].send(vectors, count);
+}
+
+void BusyPollEngine::flush() {
+    // Sends are written synchronously
+}
+
+bool BusyPollEngine::readTransmitTimestamp(std::size_t endpoint, TransmitTimestamp& timestamp) {
+    return (endpoint < sockets_.size()) && sockets_[endpoint].readTransmitTimestamp(timestamp);
+}
+
+std::size_t BusyPollEngine::sweep() {
+    std::size_t delivered = 0U;
+    for (const std::size_t endpoint : receivers_) {
+        MulticastSocket& socket = sockets_[endpoint];
+        ReceiveTimestamps timestamps;
+        const ssize_t received = socket.isTimestamping()
+                                     ? socket.receive(buffer_.data(), buffer_.size(), timestamps)
+                                     : socket.receive(buffer_.data(), buffer_.size());
+        if (received >= 0) {
+            deliver(endpoint, buffer_.data(), static_cast<std::size_t>(received), timestamps);
+            ++delivered;
+        }
+    }
+    return delivered;
+}
+
+std::size_t BusyPollEngine::poll(int timeoutMs) {
+    std::size_t delivered = sweep();
+    if ((delivered > 0U) || (timeoutMs == 0)) {
+        return delivered;
+    }
+
+    const auto deadline = std::chrono::steady_clock::now() + std::chrono::milliseconds(timeoutMs);
+    unsigned spins = 0U;
+    while (delivered == 0U) {
+        ++idleSpins_;
+        cpuRelax();
+        delivered = sweep();
+        // Reading the clock costs more than a sweep; only check it every 256 spins
+        if ((timeoutMs > 0) && ((++spins & 0xFFU) == 0U) && (std::chrono::steady_clock::now() >= deadline)) {
+            break;
+        }
+    }
+    return delivered;
+}
+
+const char* BusyPollEngine::name() const noexcept {
+    return "busy-poll";
+}
+
+uint64_t BusyPollEngine::getIdleSpinCount() const noexcept {
+    return idleSpins_;
+}
@@ -0,0 +1,53 @@
+#pragma once
+
+// MISRA C++ 2023 compliant includes
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+#include "IoEngine.hpp"
+#include "MulticastSocket.hpp"
+
+/**
+ * @brief Low-latency engine that never sleeps in the kernel.
+ * poll() spins non-blocking recv() over all receivers until something
+ * arrives or the timeout expires, so a datagram is picked up without a
+ * wakeup. Burns a full core: pin the polling thread (ThreadTuning) and keep
+ * other work off that CPU. Receivers can additionally enable SO_BUSY_POLL so
+ * the kernel polls the NIC queue inside recv().
+ */
+class BusyPollEngine final : public IoEngine {
+public:
+    struct Options final {
+        /// SO_BUSY_POLL budget applied to receivers that do not set their own (0 = off)
+        int busyPollMicros{0};
+    };
+
+    static constexpr std::size_t MAX_DATAGRAM_SIZE = 65536U;
+
+    explicit BusyPollEngine();
+    explicit BusyPollEngine(const Options& options);
+    ~BusyPollEngine() override = default;
+
+    std::size_t addReceiver(const EndpointConfig& config) override;
+    std::size_t addSender(const EndpointConfig& config) override;
+    bool send(std::size_t endpoint, const uint8_t* data, std::size_t size) override;
+    bool sendv(std::size_t endpoint, const iovec* vectors, std::size_t count) override;
+    void flush() override;
+    bool readTransmitTimestamp(std::size_t endpoint, TransmitTimestamp& timestamp) override;
+    std::size_t poll(int timeoutMs) override;
+
+    [[nodiscard]] const char* name() const noexcept override;
+
+    /// Empty sweeps over all receivers since construction
+    [[nodiscard]] uint64_t getIdleSpinCount() const noexcept;
+
+private:
+    std::size_t sweep();
+
+    Options options_;
+    std::vector<MulticastSocket> sockets_;
+    std::vector<std::size_t> receivers_;
+    std::vector<uint8_t> buffer_;
+    uint64_t idleSpins_{0U};
+};
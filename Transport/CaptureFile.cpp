@@ -0,0 +1,178 @@
+#include "CaptureFile.hpp"
+
+#include <cerrno>
+#include <cstring>
+#include <fcntl.h>
+#include <stdexcept>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <system_error>
+#include <unistd.h>
+
+namespace {
+
+[[noreturn]] void throwSystemError(const char* what) {
+    throw std::system_error(errno, std::generic_category(), what);
+}
+
+/// Closes fd (if open) without losing the errno of the failed call
+[[noreturn]] void closeAndThrow(int fd, const char* what) {
+    const int error = errno;
+    if (fd >= 0) {
+        (void)::close(fd);
+    }
+    throw std::system_error(error, std::generic_category(), what);
+}
+
+}  // namespace
+
+constexpr char CaptureFileFormat::MAGIC[8];
+
+CaptureWriter::CaptureWriter(const std::string& path, std::size_t initialCapacity) {
+    fd_ = ::open(path.c_str(), O_RDWR | O_CREAT | O_TRUNC | O_CLOEXEC, 0644);
+    if (fd_ < 0) {
+        throwSystemError("open(capture)");
+    }
+    capacity_ = (initialCapacity < 4096U) ? 4096U : initialCapacity;
+    if (ftruncate(fd_, static_cast<off_t>(capacity_)) != 0) {
+        closeAndThrow(fd_, "ftruncate(capture)");
+    }
+    void* mapping = mmap(nullptr, capacity_, PROT_READ | PROT_WRITE, MAP_SHARED, fd_, 0);
+    if (mapping == MAP_FAILED) {
+        closeAndThrow(fd_, "mmap(capture)");
+    }
+    base_ = static_cast<uint8_t*>(mapping);
+    std::memcpy(base_, CaptureFileFormat::MAGIC, sizeof(CaptureFileFormat::MAGIC));
+    const uint64_t dataEnd = end_;
+    std::memcpy(base_ + CaptureFileFormat::DATA_END_OFFSET, &dataEnd, sizeof(dataEnd));
+}
+
+CaptureWriter::~CaptureWriter() {
+    close();
+}
+
+void CaptureWriter::grow(std::size_t required) {
+    std::size_t capacity = capacity_;
+    while (capacity < required) {
+        capacity *= 2U;
+    }
+    if (ftruncate(fd_, static_cast<off_t>(capacity)) != 0) {
+        throwSystemError("ftruncate(capture)");
+    }
+    void* mapping = mremap(base_, capacity_, capacity, MREMAP_MAYMOVE);
+    if (mapping == MAP_FAILED) {
+        throwSystemError("mremap(capture)");
+    }
+    base_ = static_cast<uint8_t*>(mapping);
+    capacity_ = capacity;
+}
+
+void CaptureWriter::append(int64_t timestampNs, uint32_t groupAddress, uint16_t port, const uint8_t* payload,
+                           std::size_t length) {
+    if (base_ == nullptr) {
+        throw std::logic_error("CaptureWriter is closed");
+    }
+    const std::size_t recordSize = CaptureFileFormat::RECORD_HEADER_SIZE + CaptureFileFormat::paddedLength(length);
+    if ((end_ + recordSize) > capacity_) {
+        grow(end_ + recordSize);
+    }
+
+    uint8_t* const record = base_ + end_;
+    const uint32_t length32 = static_cast<uint32_t>(length);
+    const uint16_t reserved = 0U;
+    std::memcpy(record, &timestampNs, sizeof(timestampNs));
+    std::memcpy(record + 8, &length32, sizeof(length32));
+    std::memcpy(record + 12, &groupAddress, sizeof(groupAddress));
+    std::memcpy(record + 16, &port, sizeof(port));
+    std::memcpy(record + 18, &reserved, sizeof(reserved));
+    std::memcpy(record + CaptureFileFormat::RECORD_HEADER_SIZE, payload, length);
+
+    end_ += recordSize;
+    ++records_;
+    // Publish the record only after its bytes are in place
+    __atomic_store_n(reinterpret_cast<uint64_t*>(base_ + CaptureFileFormat::DATA_END_OFFSET),
+                     static_cast<uint64_t>(end_), __ATOMIC_RELEASE);
+}
+
+void CaptureWriter::close() noexcept {
+    if (base_ != nullptr) {
+        (void)munmap(base_, capacity_);
+        base_ = nullptr;
+    }
+    if (fd_ >= 0) {
+        (void)ftruncate(fd_, static_cast<off_t>(end_));
+        (void)::close(fd_);
+        fd_ = -1;
+    }
+}
+
+uint64_t CaptureWriter::getRecordCount() const noexcept {
+    return records_;
+}
+
+std::size_t CaptureWriter::getBytesWritten() const noexcept {
+    return end_;
+}
+
+CaptureReader::CaptureReader(const std::string& path) {
+    fd_ = ::open(path.c_str(), O_RDONLY | O_CLOEXEC);
+    if (fd_ < 0) {
+        throwSystemError("open(capture)");
+    }
+    struct stat info {};
+    if (fstat(fd_, &info) != 0) {
+        closeAndThrow(fd_, "fstat(capture)");
+    }
+    size_ = static_cast<std::size_t>(info.st_size);
+    if (size_ < CaptureFileFormat::FILE_HEADER_SIZE) {
+        (void)::close(fd_);
+        throw std::runtime_error("Capture file too small: " + path);
+    }
+    void* mapping = mmap(nullptr, size_, PROT_READ, MAP_SHARED, fd_, 0);
+    if (mapping == MAP_FAILED) {
+        closeAndThrow(fd_, "mmap(capture)");
+    }
+    (void)madvise(mapping, size_, MADV_SEQUENTIAL);
+    base_ = static_cast<const uint8_t*>(mapping);
+    if (std::memcmp(base_, CaptureFileFormat::MAGIC, sizeof(CaptureFileFormat::MAGIC)) != 0) {
+        (void)munmap(mapping, size_);
+        (void)::close(fd_);
+        throw std::runtime_error("Not a capture file: " + path);
+    }
+    uint64_t dataEnd = 0U;
+    std::memcpy(&dataEnd, base_ + CaptureFileFormat::DATA_END_OFFSET, sizeof(dataEnd));
+    dataEnd_ = (dataEnd < size_) ? static_cast<std::size_t>(dataEnd) : size_;
+}
+
+CaptureReader::~CaptureReader() {
+    if (base_ != nullptr) {
+        (void)munmap(const_cast<uint8_t*>(base_), size_);
+    }
+    if (fd_ >= 0) {
+        (void)::close(fd_);
+    }
+}
+
+bool CaptureReader::next(CaptureRecord& record) noexcept {
+    if ((offset_ + CaptureFileFormat::RECORD_HEADER_SIZE) > dataEnd_) {
+        return false;
+    }
+    const uint8_t* const header = base_ + offset_;
+    std::memcpy(&record.timestampNs, header, sizeof(record.timestampNs));
+    std::memcpy(&record.length, header + 8, sizeof(record.length));
+    std::memcpy(&record.groupAddress, header + 12, sizeof(record.groupAddress));
+    std::memcpy(&record.port, header + 16, sizeof(record.port));
+
+    const std::size_t recordSize =
+        CaptureFileFormat::RECORD_HEADER_SIZE + CaptureFileFormat::paddedLength(record.length);
+    if ((offset_ + recordSize) > dataEnd_) {
+        return false;
+    }
+    record.payload = header + CaptureFileFormat::RECORD_HEADER_SIZE;
+    offset_ += recordSize;
+    return true;
+}
+
+void CaptureReader::rewind() noexcept {
+    offset_ = CaptureFileFormat::FILE_HEADER_SIZE;
+}
@@ -0,0 +1,103 @@
+#pragma once
+
+// MISRA C++ 2023 compliant includes
+#include <cstddef>
+#include <cstdint>
+#include <string>
+
+/**
+ * @brief One captured datagram as stored in a capture file.
+ * The payload points into the mapped file and stays valid while the reader lives.
+ */
+struct CaptureRecord final {
+    /// CLOCK_REALTIME receive time (nanoseconds)
+    int64_t timestampNs{0};
+    /// IPv4 multicast group in network byte order
+    uint32_t groupAddress{0U};
+    uint16_t port{0U};
+    const uint8_t* payload{nullptr};
+    uint32_t length{0U};
+};
+
+/**
+ * @brief On-disk layout shared by CaptureWriter and CaptureReader.
+ * [file header: 64 bytes][record header: 24 bytes][payload padded to 8] ...
+ * The header's dataEnd is advanced after every append, so a reader never
+ * sees a partially written record even while the writer is running.
+ */
+struct CaptureFileFormat final {
+    static constexpr char MAGIC[8] = {'Z', 'D', 'C', 'A', 'P', 'T', 'R', '1'};
+    static constexpr std::size_t FILE_HEADER_SIZE = 64U;
+    static constexpr std::size_t RECORD_HEADER_SIZE = 24U;
+    static constexpr std::size_t DATA_END_OFFSET = 8U;
+
+    static constexpr std::size_t paddedLength(std::size_t length) noexcept {
+        return (length + 7U) & ~static_cast<std::size_t>(7U);
+    }
+};
+
+/**
+ * @brief Append-only, memory-mapped capture file writer.
+ * The file grows by doubling (ftruncate + mremap); close() trims it to the
+ * written size. Setup and growth failures throw std::system_error.
+ */
+class CaptureWriter final {
+public:
+    explicit CaptureWriter(const std::string& path, std::size_t initialCapacity = 64U * 1024U * 1024U);
+
+    // Copy constructor
+    CaptureWriter(const CaptureWriter& other) = delete;
+
+    // Copy assignment operator
+    CaptureWriter& operator=(const CaptureWriter& other) = delete;
+
+    // Destructor
+    ~CaptureWriter();
+
+    void append(int64_t timestampNs, uint32_t groupAddress, uint16_t port, const uint8_t* payload,
+                std::size_t length);
+
+    void close() noexcept;
+
+    [[nodiscard]] uint64_t getRecordCount() const noexcept;
+    [[nodiscard]] std::size_t getBytesWritten() const noexcept;
+
+private:
+    void grow(std::size_t required);
+
+    int fd_{-1};
+    uint8_t* base_{nullptr};
+    std::size_t capacity_{0U};
+    std::size_t end_{CaptureFileFormat::FILE_HEADER_SIZE};
+    uint64_t records_{0U};
+};
+
+/**
+ * @brief Read-only view over a capture file, iterated front to back.
+ */
+class CaptureReader final {
+public:
+    explicit CaptureReader(const std::string& path);
+
+    // Copy constructor
+    CaptureReader(const CaptureReader& other) = delete;
+
+    // Copy assignment operator
+    CaptureReader& operator=(const CaptureReader& other) = delete;
+
+    // Destructor
+    ~CaptureReader();
+
+    /// Reads the next record; returns false at the end of the data
+    bool next(CaptureRecord& record) noexcept;
+
+    /// Restarts iteration from the first record
+    void rewind() noexcept;
+
+private:
+    int fd_{-1};
+    const uint8_t* base_{nullptr};
+    std::size_t size_{0U};
+    std::size_t dataEnd_{0U};
+    std::size_t offset_{CaptureFileFormat::FILE_HEADER_SIZE};
+};
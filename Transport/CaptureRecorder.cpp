@@ -0,0 +1,36 @@
+#include "CaptureRecorder.hpp"
+
+#include <arpa/inet.h>
+#include <ctime>
+#include <stdexcept>
+#include <utility>
+
+CaptureRecorder::CaptureRecorder(CaptureWriter& writer) noexcept : writer_(writer) {}
+
+void CaptureRecorder::addEndpoint(std::size_t endpoint, const EndpointConfig& config) {
+    in_addr address{};
+    if (inet_pton(AF_INET, config.multicastAddress.c_str(), &address) != 1) {
+        throw std::invalid_argument("Invalid IPv4 address: " + config.multicastAddress);
+    }
+    if (endpoint >= groups_.size()) {
+        groups_.resize(endpoint + 1U);
+    }
+    groups_[endpoint] = Group{address.s_addr, config.port};
+}
+
+void CaptureRecorder::record(const ReceivedDatagram& datagram) {
+    timespec now{};
+    (void)clock_gettime(CLOCK_REALTIME, &now);
+    const int64_t timestampNs = (static_cast<int64_t>(now.tv_sec) * 1000000000LL) + now.tv_nsec;
+    const Group group = (datagram.endpoint < groups_.size()) ? groups_[datagram.endpoint] : Group{};
+    writer_.append(timestampNs, group.address, group.port, datagram.data, datagram.size);
+}
+
+DatagramHandler CaptureRecorder::wrap(DatagramHandler next) {
+    return [this, next = std::move(next)](const ReceivedDatagram& datagram) {
+        record(datagram);
+        if (next) {
+            next(datagram);
+        }
+    };
+}
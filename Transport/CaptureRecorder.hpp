@@ -0,0 +1,36 @@
+#pragma once
+
+// MISRA C++ 2023 compliant includes
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+#include "CaptureFile.hpp"
+#include "EndpointConfig.hpp"
+#include "IoEngine.hpp"
+
+/**
+ * @brief Records datagrams received by an IoEngine into a capture file.
+ * Endpoints must be registered so that each record carries its group and port.
+ */
+class CaptureRecorder final {
+public:
+    explicit CaptureRecorder(CaptureWriter& writer) noexcept;
+
+    /// Associates an engine endpoint index with its group address and port
+    void addEndpoint(std::size_t endpoint, const EndpointConfig& config);
+
+    void record(const ReceivedDatagram& datagram);
+
+    /// Handler that records every datagram and then forwards it to next
+    [[nodiscard]] DatagramHandler wrap(DatagramHandler next);
+
+private:
+    struct Group {
+        uint32_t address{0U};
+        uint16_t port{0U};
+    };
+
+    CaptureWriter& writer_;
+    std::vector<Group> groups_;
+};
@@ -0,0 +1,71 @@
+#include "CaptureReplayer.hpp"
+
+#include <arpa/inet.h>
+#include <chrono>
+#include <memory>
+#include <thread>
+#include <unordered_map>
+
+#include "EndpointConfig.hpp"
+
+namespace {
+
+/// Sleeps for the bulk of the wait and spins the last stretch for accuracy
+void waitUntil(std::chrono::steady_clock::time_point target) {
+    constexpr auto SPIN_WINDOW = std::chrono::microseconds(100);
+    auto now = std::chrono::steady_clock::now();
+    if ((target - now) > SPIN_WINDOW) {
+        std::this_thread::sleep_for(target - now - SPIN_WINDOW);
+    }
+    while (std::chrono::steady_clock::now() < target) {
+#if defined(__x86_64__) || defined(__i386__)
+        __builtin_ia32_pause();
+#endif
+    }
+}
+
+}  // namespace
+
+CaptureReplayer::CaptureReplayer(const Options& options) noexcept : options_(options) {}
+
+uint64_t CaptureReplayer::replay(CaptureReader& reader, const Sink& sink) const {
+    uint64_t replayed = 0U;
+    for (unsigned loop = 0U; loop < options_.loops; ++loop) {
+        reader.rewind();
+        CaptureRecord record;
+        if (!reader.next(record)) {
+            break;
+        }
+        const int64_t firstTimestamp = record.timestampNs;
+        const auto start = std::chrono::steady_clock::now();
+        do {
+            if (options_.speed > 0.0) {
+                const double offsetNs = static_cast<double>(record.timestampNs - firstTimestamp) / options_.speed;
+                waitUntil(start + std::chrono::nanoseconds(static_cast<int64_t>(offsetNs)));
+            }
+            sink(record);
+            ++replayed;
+        } while (reader.next(record));
+    }
+    return replayed;
+}
+
+CaptureReplayer::Sink CaptureReplayer::engineSink(IoEngine& engine, const std::string& interfaceAddress) {
+    auto endpoints = std::make_shared<std::unordered_map<uint64_t, std::size_t>>();
+    return [&engine, interfaceAddress, endpoints](const CaptureRecord& record) {
+        const uint64_t key = (static_cast<uint64_t>(record.groupAddress) << 16U) | record.port;
+        auto found = endpoints->find(key);
+        if (found == endpoints->end()) {
+            char address[INET_ADDRSTRLEN] = {};
+            in_addr group{};
+            group.s_addr = record.groupAddress;
+            (void)inet_ntop(AF_INET, &group, address, sizeof(address));
+            EndpointConfig config;
+            config.multicastAddress = address;
+            config.port = record.port;
+            config.interfaceAddress = interfaceAddress;
+            found = endpoints->emplace(key, engine.addSender(config)).first;
+        }
+        (void)engine.send(found->second, record.payload, record.length);
+    };
+}
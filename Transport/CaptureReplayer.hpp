@@ -0,0 +1,38 @@
+#pragma once
+
+// MISRA C++ 2023 compliant includes
+#include <cstdint>
+#include <functional>
+#include <string>
+
+#include "CaptureFile.hpp"
+#include "IoEngine.hpp"
+
+/**
+ * @brief Replays a capture file into a sink at a chosen speed.
+ * speed 1.0 reproduces the recorded inter-arrival times, N > 1 compresses
+ * them N times and 0 replays as fast as possible (one core saturated).
+ */
+class CaptureReplayer final {
+public:
+    struct Options final {
+        /// Replay speed factor; 0 = as fast as possible
+        double speed{1.0};
+        /// Number of passes over the file
+        unsigned loops{1U};
+    };
+
+    using Sink = std::function<void(const CaptureRecord&)>;
+
+    explicit CaptureReplayer(const Options& options) noexcept;
+
+    /// Returns the number of records handed to the sink
+    uint64_t replay(CaptureReader& reader, const Sink& sink) const;
+
+    /// Sink that re-publishes each record on its original group/port through engine
+    /// (sender endpoints are opened on first use)
+    [[nodiscard]] static Sink engineSink(IoEngine& engine, const std::string& interfaceAddress = "0.0.0.0");
+
+private:
+    Options options_;
+};
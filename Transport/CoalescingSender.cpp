@@ -0,0 +1,156 @@
+#include "CoalescingSender.hpp"
+
+#include <limits>
+
+#include "MessageEnvelope.hpp"
+#include "RadioDishFrame.hpp"
+
+CoalescingSender::CoalescingSender(IoEngine& engine) : CoalescingSender(engine, Options{}) {}
+
+CoalescingSender::CoalescingSender(IoEngine& engine, const Options& options)
+    : engine_(engine),
+      options_(options),
+      maxDelayNs_(std::chrono::duration_cast<std::chrono::nanoseconds>(options.maxDelay).count()) {}
+
+void CoalescingSender::open(std::size_t index, std::size_t endpoint, const char* group) {
+    Batch& batch = batches_[index];
+    RadioDishFrame::beginFrame(group, batch.buffer);
+    batch.headerSize = batch.buffer.size() + MessageEnvelope::SIZE;
+    batch.buffer.resize(batch.headerSize);
+    batch.buffer.reserve(options_.maxDatagramBytes);
+    batch.endpoint = endpoint;
+    batch.group = group;
+    // Start as a slow stream so the first records are not held back
+    batch.gapEwmaNs = static_cast<double>(maxDelayNs_) * 2.0;
+    batch.advertised = true;
+}
+
+uint8_t* CoalescingSender::reserve(std::size_t index, std::size_t size, int64_t now, bool& sent) {
+    Batch& batch = batches_[index];
+    if (!batch.advertised) {
+        return nullptr;
+    }
+    if (batch.lastArrivalNs != 0) {
+        const double gap = static_cast<double>(now - batch.lastArrivalNs);
+        batch.gapEwmaNs += options_.rateSmoothing * (gap - batch.gapEwmaNs);
+    }
+    batch.lastArrivalNs = now;
+
+    if ((batch.records > 0U) && ((batch.buffer.size() + size) > options_.maxDatagramBytes)) {
+        sent = flush(batch, FlushReason::Budget);
+    }
+    if (batch.records == 0U) {
+        batch.firstRecordNs = now;
+    }
+    const std::size_t offset = batch.buffer.size();
+    batch.buffer.resize(offset + size);
+    return &batch.buffer[offset];
+}
+
+bool CoalescingSender::commit(std::size_t index, std::size_t size) {
+    Batch& batch = batches_[index];
+    ++batch.records;
+    records_.add();
+
+    if (((batch.buffer.size() + size) > options_.maxDatagramBytes) ||
+        (batch.records == std::numeric_limits<uint16_t>::max())) {
+        // The next record of this size would not fit: the batch is full
+        return flush(batch, FlushReason::Budget);
+    }
+    const double expected = static_cast<double>(maxDelayNs_) / ((batch.gapEwmaNs > 1.0) ? batch.gapEwmaNs : 1.0);
+    if ((maxDelayNs_ == 0) || (options_.adaptive && (expected < options_.minExpectedBatch))) {
+        return flush(batch, FlushReason::Immediate);
+    }
+    return true;
+}
+
+bool CoalescingSender::flush(Batch& batch, FlushReason reason) {
+    MessageEnvelope envelope;
+    envelope.recordCount = batch.records;
+    envelope.sequence = batch.nextSequence;
+    envelope.flags = options_.checksums ? MessageEnvelope::FLAG_CHECKSUM : 0U;
+    envelope.encode(&batch.buffer[batch.headerSize - MessageEnvelope::SIZE]);
+    ++batch.nextSequence;
+
+    const bool sent = engine_.send(batch.endpoint, batch.buffer.data(), batch.buffer.size());
+    if (sent) {
+        datagrams_.add();
+    } else {
+        sendFailures_.add();
+    }
+    flushes_[static_cast<std::size_t>(reason)].add();
+    const std::size_t bodyOffset = batch.headerSize - MessageEnvelope::SIZE;
+    if (batch.fec && batch.fec->add(envelope.sequence, &batch.buffer[bodyOffset], batch.buffer.size() - bodyOffset)) {
+        for (const std::vector<uint8_t>& parity : batch.fec->getParityBodies()) {
+            RadioDishFrame::encode(batch.group, parity.data(), parity.size(), batch.parityScratch);
+            if (!engine_.send(batch.endpoint, batch.parityScratch.data(), batch.parityScratch.size())) {
+                sendFailures_.add();
+            }
+        }
+    }
+    batch.records = 0U;
+    batch.buffer.resize(batch.headerSize);
+    return sent;
+}
+
+std::size_t CoalescingSender::poll() {
+    return poll(nowNs());
+}
+
+std::size_t CoalescingSender::poll(int64_t now) {
+    std::size_t sent = 0U;
+    for (Batch& batch : batches_) {
+        if ((batch.records > 0U) && ((now - batch.firstRecordNs) >= maxDelayNs_)) {
+            sent += flush(batch, FlushReason::Deadline) ? 1U : 0U;
+        }
+    }
+    return sent;
+}
+
+void CoalescingSender::flushAll() {
+    for (Batch& batch : batches_) {
+        if (batch.records > 0U) {
+            (void)flush(batch, FlushReason::Explicit);
+        }
+    }
+}
+
+int64_t CoalescingSender::nextDeadlineNs() const noexcept {
+    int64_t deadline = std::numeric_limits<int64_t>::max();
+    for (const Batch& batch : batches_) {
+        if ((batch.records > 0U) && ((batch.firstRecordNs + maxDelayNs_) < deadline)) {
+            deadline = batch.firstRecordNs + maxDelayNs_;
+        }
+    }
+    return deadline;
+}
+
+uint64_t CoalescingSender::getDatagramCount() const noexcept {
+    return datagrams_.load();
+}
+
+uint64_t CoalescingSender::getRecordCount() const noexcept {
+    return records_.load();
+}
+
+uint64_t CoalescingSender::getFlushCount(FlushReason reason) const noexcept {
+    return flushes_[static_cast<std::size_t>(reason)].load();
+}
+
+void CoalescingSender::registerMetrics(TransportMetrics& metrics, const std::string& prefix) const {
+    metrics.addCollector([this, prefix](std::vector<MetricSample>& samples) {
+        samples.push_back({prefix + ".datagrams", datagrams_.load()});
+        samples.push_back({prefix + ".records", records_.load()});
+        samples.push_back({prefix + ".send_failures", sendFailures_.load()});
+        samples.push_back({prefix + ".flush.budget", getFlushCount(FlushReason::Budget)});
+        samples.push_back({prefix + ".flush.deadline", getFlushCount(FlushReason::Deadline)});
+        samples.push_back({prefix + ".flush.immediate", getFlushCount(FlushReason::Immediate)});
+        samples.push_back({prefix + ".flush.explicit", getFlushCount(FlushReason::Explicit)});
+    });
+}
+
+int64_t CoalescingSender::nowNs() noexcept {
+    return std::chrono::duration_cast<std::chrono::nanoseconds>(
+               std::chrono::steady_clock::now().time_since_epoch())
+        .count();
+}
@@ -0,0 +1,147 @@
+#pragma once
+
+// MISRA C++ 2023 compliant includes
+#include <array>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "EndpointConfig.hpp"
+#include "ForwardErrorCorrection.hpp"
+#include "IoEngine.hpp"
+#include "RelaxedCounter.hpp"
+#include "TrackMessageTraits.hpp"
+#include "TransportMetrics.hpp"
+
+/**
+ * @brief Publisher that packs several records of one type into a single
+ * datagram (envelope recordCount > 1).
+ * A batch is sent when the next record would exceed maxDatagramBytes, or
+ * when its first record has waited maxDelay; poll() enforces the delay.
+ * In adaptive mode every type tracks its arrival rate (EWMA of the gaps).
+ * When fewer than minExpectedBatch records are expected within maxDelay,
+ * records go out immediately, because waiting would add latency without
+ * saving any datagrams. Under bursts the byte budget takes over.
+ * With FEC enabled, every window of dataPackets batches is followed by its
+ * parity datagrams.
+ * Not thread-safe: drive publish() and poll() from the sending thread.
+ */
+class CoalescingSender final {
+public:
+    struct Options final {
+        /// Upper bound of one datagram including frame header and envelope (fits a 1500 byte MTU)
+        std::size_t maxDatagramBytes{1400U};
+        /// Longest time a record may wait for companions
+        std::chrono::microseconds maxDelay{200};
+        /// Send immediately when the observed rate cannot fill a batch within maxDelay
+        bool adaptive{true};
+        /// Expected records per maxDelay below which adaptive mode stops waiting
+        double minExpectedBatch{2.0};
+        /// EWMA weight of the newest inter-arrival gap
+        double rateSmoothing{0.05};
+        /// Append a CRC32C trailer to every record (envelope FLAG_CHECKSUM)
+        bool checksums{false};
+    };
+
+    /// Why a batch left the sender
+    enum class FlushReason : uint8_t {
+        Budget,
+        Deadline,
+        Immediate,
+        Explicit
+    };
+
+    explicit CoalescingSender(IoEngine& engine);
+    explicit CoalescingSender(IoEngine& engine, const Options& options);
+
+    template <typename T>
+    void advertise(const EndpointConfig& config) {
+        open(TrackMessageTraits<T>::INDEX, engine_.addSender(config), TrackMessageTraits<T>::GROUP);
+    }
+
+    template <typename T>
+    void advertise(const std::string& interfaceAddress = "0.0.0.0") {
+        advertise<T>(makeEndpointConfig<T>(interfaceAddress));
+    }
+
+    /// Protects the batches of type T with parity; throws std::invalid_argument for bad options
+    template <typename T>
+    void enableFec(const FecOptions& options) {
+        batches_[TrackMessageTraits<T>::INDEX].fec = std::make_unique<FecEncoder>(options);
+    }
+
+    /// Adds one record to its type's batch; returns false when the type is not advertised or a send failed
+    template <typename T>
+    bool publish(const T& message) {
+        const std::size_t size = message.getSerializedSize() + (options_.checksums ? T::CHECKSUM_SIZE : 0U);
+        bool sent = true;
+        uint8_t* const slot = reserve(TrackMessageTraits<T>::INDEX, size, nowNs(), sent);
+        if (slot == nullptr) {
+            return false;
+        }
+        // Serialized in place: the record is never copied between model and datagram
+        (void)(options_.checksums ? message.serializeWithChecksumInto(slot) : message.serializeInto(slot));
+        return commit(TrackMessageTraits<T>::INDEX, size) && sent;
+    }
+
+    /// Sends every batch whose first record has waited maxDelay; returns the number of datagrams sent
+    std::size_t poll();
+    std::size_t poll(int64_t nowNs);
+
+    /// Sends every pending batch
+    void flushAll();
+
+    /// Earliest pending deadline (steady clock ns), INT64_MAX when nothing is pending
+    [[nodiscard]] int64_t nextDeadlineNs() const noexcept;
+
+    /// Smoothed inter-arrival gap of a type in ns
+    template <typename T>
+    [[nodiscard]] double getArrivalGapNs() const noexcept {
+        return batches_[TrackMessageTraits<T>::INDEX].gapEwmaNs;
+    }
+
+    [[nodiscard]] uint64_t getDatagramCount() const noexcept;
+    [[nodiscard]] uint64_t getRecordCount() const noexcept;
+    [[nodiscard]] uint64_t getFlushCount(FlushReason reason) const noexcept;
+
+    /// Exposes datagram, record, failure and per-reason flush counters under prefix
+    void registerMetrics(TransportMetrics& metrics, const std::string& prefix = "coalescing") const;
+
+    static int64_t nowNs() noexcept;
+
+private:
+    struct Batch {
+        bool advertised{false};
+        std::size_t endpoint{0U};
+        std::vector<uint8_t> buffer;
+        std::size_t headerSize{0U};
+        uint16_t records{0U};
+        uint64_t nextSequence{0U};
+        int64_t firstRecordNs{0};
+        int64_t lastArrivalNs{0};
+        double gapEwmaNs{0.0};
+        std::string group;
+        std::unique_ptr<FecEncoder> fec;
+        std::vector<uint8_t> parityScratch;
+    };
+
+    void open(std::size_t index, std::size_t endpoint, const char* group);
+    /// Makes room for a size byte record (flushing a full batch first); nullptr when not advertised
+    uint8_t* reserve(std::size_t index, std::size_t size, int64_t now, bool& sent);
+    /// Accounts the record written by reserve() and flushes when the batch is due
+    bool commit(std::size_t index, std::size_t size);
+    bool flush(Batch& batch, FlushReason reason);
+
+    IoEngine& engine_;
+    Options options_;
+    int64_t maxDelayNs_{0};
+    std::array<Batch, TRACK_MESSAGE_TYPE_COUNT> batches_{};
+
+    RelaxedCounter datagrams_;
+    RelaxedCounter records_;
+    RelaxedCounter sendFailures_;
+    std::array<RelaxedCounter, 4> flushes_;
+};
@@ -0,0 +1,140 @@
+#pragma once
+
+// MISRA C++ 2023 compliant includes
+#include <cstddef>
+#include <cstdint>
+#include <mutex>
+#include <stdexcept>
+#include <vector>
+
+#include "RelaxedCounter.hpp"
+#include "TrackSlotIndex.hpp"
+
+/**
+ * @brief Latest-value queue keyed by trackId for consumers slower than the feed.
+ * Each track holds at most one pending message: a newer update of a pending
+ * track overwrites it in place and keeps its position, so the consumer reads
+ * tracks in the order they first became dirty but always sees their freshest
+ * state. Storage is sized once for maxTracks live tracks; push and pop are
+ * O(1) and copy T without allocating, so memory is bounded by the number of
+ * tracks rather than the message rate. One producer and one consumer thread.
+ */
+template <typename T>
+class ConflatingQueue final {
+public:
+    enum class PushResult : uint8_t {
+        Queued,     ///< track was not pending, appended at the back
+        Conflated,  ///< pending update of the track overwritten in place
+        Rejected    ///< maxTracks tracks already pending
+    };
+
+    explicit ConflatingQueue(std::size_t maxTracks)
+        : entries_(maxTracks), order_(maxTracks), index_(maxTracks) {
+        if (maxTracks == 0U) {
+            throw std::invalid_argument("ConflatingQueue needs room for at least one track");
+        }
+        freeSlots_.reserve(maxTracks);
+        for (std::size_t slot = maxTracks; slot > 0U; --slot) {
+            freeSlots_.push_back(static_cast<uint32_t>(slot - 1U));
+        }
+    }
+
+    // Copy constructor
+    ConflatingQueue(const ConflatingQueue& other) = delete;
+
+    // Copy assignment operator
+    ConflatingQueue& operator=(const ConflatingQueue& other) = delete;
+
+    // Destructor
+    ~ConflatingQueue() = default;
+
+    PushResult push(const T& message) {
+        const uint64_t trackId = static_cast<uint64_t>(message.getTrackId());
+        const std::lock_guard<std::mutex> lock(mutex_);
+        const uint32_t pending = index_.find(trackId);
+        if (pending != TrackSlotIndex::NOT_FOUND) {
+            entries_[pending].value = message;
+            conflated_.add();
+            return PushResult::Conflated;
+        }
+        if (freeSlots_.empty()) {
+            rejected_.add();
+            return PushResult::Rejected;
+        }
+        const uint32_t slot = freeSlots_.back();
+        freeSlots_.pop_back();
+        entries_[slot].trackId = trackId;
+        entries_[slot].value = message;
+        order_[(head_ + count_) % order_.size()] = slot;
+        ++count_;
+        index_.insert(trackId, slot);
+        queued_.add();
+        return PushResult::Queued;
+    }
+
+    /// Copies out the oldest dirty track's latest state; false when nothing is pending
+    bool pop(T& out) {
+        const std::lock_guard<std::mutex> lock(mutex_);
+        if (count_ == 0U) {
+            return false;
+        }
+        const uint32_t slot = order_[head_];
+        head_ = (head_ + 1U) % order_.size();
+        --count_;
+        out = entries_[slot].value;
+        (void)index_.erase(entries_[slot].trackId);
+        freeSlots_.push_back(slot);
+        return true;
+    }
+
+    /// Pops up to maxMessages entries, handing each to visitor outside the lock
+    template <typename Visitor>
+    std::size_t drain(Visitor&& visitor, std::size_t maxMessages) {
+        std::size_t drained = 0U;
+        while ((drained < maxMessages) && pop(scratch_)) {
+            visitor(static_cast<const T&>(scratch_));
+            ++drained;
+        }
+        return drained;
+    }
+
+    [[nodiscard]] std::size_t size() const {
+        const std::lock_guard<std::mutex> lock(mutex_);
+        return count_;
+    }
+
+    [[nodiscard]] std::size_t capacity() const noexcept {
+        return entries_.size();
+    }
+
+    [[nodiscard]] uint64_t getQueuedCount() const noexcept {
+        return queued_.load();
+    }
+
+    [[nodiscard]] uint64_t getConflatedCount() const noexcept {
+        return conflated_.load();
+    }
+
+    [[nodiscard]] uint64_t getRejectedCount() const noexcept {
+        return rejected_.load();
+    }
+
+private:
+    struct Entry {
+        uint64_t trackId{0U};
+        T value{};
+    };
+
+    std::vector<Entry> entries_;
+    std::vector<uint32_t> order_;
+    std::vector<uint32_t> freeSlots_;
+    std::size_t head_{0U};
+    std::size_t count_{0U};
+    TrackSlotIndex index_;
+    mutable std::mutex mutex_;
+    T scratch_{};
+
+    RelaxedCounter queued_;
+    RelaxedCounter conflated_;
+    RelaxedCounter rejected_;
+};
@@ -0,0 +1,11 @@
+#include "EndpointConfig.hpp"
+
+#include "ServiceRegistry.hpp"
+
+EndpointConfig makeEndpointConfig(const ServiceDescriptor& service, const std::string& interfaceAddress) {
+    EndpointConfig config;
+    config.multicastAddress = service.multicastAddress;
+    config.port = static_cast<uint16_t>(service.port);
+    config.interfaceAddress = interfaceAddress;
+    return config;
+}
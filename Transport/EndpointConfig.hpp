@@ -0,0 +1,52 @@
+#pragma once
+
+// MISRA C++ 2023 compliant includes
+#include <cstdint>
+#include <string>
+
+#include "OverflowPolicy.hpp"
+#include "PacketTimestamps.hpp"
+
+struct ServiceDescriptor;
+
+/**
+ * @brief Connection parameters of one UDP RADIO/DISH multicast endpoint.
+ * Defaults mirror the x-service-metadata blocks of the message schemas.
+ */
+struct EndpointConfig final {
+    /// Multicast group address (e.g. "239.1.1.5")
+    std::string multicastAddress;
+    /// UDP port of the group
+    uint16_t port{0U};
+    /// Local interface used for JOIN and outgoing multicast ("0.0.0.0" = kernel default)
+    std::string interfaceAddress{"0.0.0.0"};
+    /// Kernel receive buffer size requested with SO_RCVBUF (bytes)
+    int receiveBufferBytes{4 * 1024 * 1024};
+    /// Multicast TTL for senders
+    int timeToLive{1};
+    /// Deliver our own multicast datagrams to local receivers
+    bool multicastLoopback{true};
+    /// SO_BUSY_POLL budget for receivers in microseconds (0 = off)
+    int busyPollMicros{0};
+    /// SO_TIMESTAMPING: receive timestamps on receivers, transmit timestamps on senders
+    TimestampingMode timestamping{TimestampingMode::None};
+    /// Limit and overflow policy of a receiver's records, applied by a TrackShardPool built from this config
+    HighWaterMark highWaterMark{};
+};
+
+/**
+ * @brief Builds the endpoint configuration of a generated model class from its
+ * MULTICAST_ADDRESS and PORT constants.
+ */
+template <typename T>
+[[nodiscard]] EndpointConfig makeEndpointConfig(const std::string& interfaceAddress = "0.0.0.0") {
+    EndpointConfig config;
+    config.multicastAddress = T::MULTICAST_ADDRESS;
+    config.port = static_cast<uint16_t>(T::PORT);
+    config.interfaceAddress = interfaceAddress;
+    return config;
+}
+
+/// Builds the endpoint configuration of a ServiceRegistry entry
+[[nodiscard]] EndpointConfig makeEndpointConfig(const ServiceDescriptor& service,
+                                                const std::string& interfaceAddress = "0.0.0.0");
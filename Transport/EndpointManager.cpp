@@ -0,0 +1,102 @@
+#include "EndpointManager.hpp"
+
+EndpointManager::EndpointManager(IoEngineKind kind, const std::string& interfaceAddress)
+    : EndpointManager(IoEngine::create(kind), interfaceAddress) {}
+
+EndpointManager::EndpointManager(std::unique_ptr<IoEngine> engine, const std::string& interfaceAddress)
+    : engine_(std::move(engine)), interfaceAddress_(interfaceAddress), publisher_(*engine_) {
+    engine_->setHandler([this](const ReceivedDatagram& datagram) {
+        (void)dispatcher_.dispatch(datagram.data, datagram.size, datagram.timestamps);
+    });
+}
+
+void EndpointManager::configure(const ServiceDescriptor& service, const EndpointConfig& config) {
+    configs_[service.index] = config;
+    configured_[service.index] = true;
+}
+
+EndpointConfig EndpointManager::configFor(const ServiceDescriptor& service) const {
+    return configured_[service.index] ? configs_[service.index] : makeEndpointConfig(service, interfaceAddress_);
+}
+
+const EndpointManager::OpenEndpoint* EndpointManager::find(const std::vector<OpenEndpoint>& endpoints,
+                                                           const EndpointConfig& config) noexcept {
+    for (const OpenEndpoint& open : endpoints) {
+        if ((open.port == config.port) && (open.address == config.multicastAddress)) {
+            return &open;
+        }
+    }
+    return nullptr;
+}
+
+std::size_t EndpointManager::openReceiver(const ServiceDescriptor& service) {
+    return openReceiver(configFor(service));
+}
+
+std::size_t EndpointManager::openReceiver(const EndpointConfig& config) {
+    const OpenEndpoint* existing = find(receivers_, config);
+    if (existing != nullptr) {
+        return existing->endpoint;
+    }
+    const std::size_t endpoint = engine_->addReceiver(config);
+    receivers_.push_back(OpenEndpoint{config.multicastAddress, config.port, endpoint});
+    return endpoint;
+}
+
+std::size_t EndpointManager::openSender(const ServiceDescriptor& service) {
+    return openSender(configFor(service));
+}
+
+std::size_t EndpointManager::openSender(const EndpointConfig& config) {
+    const OpenEndpoint* existing = find(senders_, config);
+    if (existing != nullptr) {
+        return existing->endpoint;
+    }
+    const std::size_t endpoint = engine_->addSender(config);
+    senders_.push_back(OpenEndpoint{config.multicastAddress, config.port, endpoint});
+    return endpoint;
+}
+
+std::size_t EndpointManager::poll(int timeoutMs) {
+    return engine_->poll(timeoutMs);
+}
+
+void EndpointManager::run(int pollTimeoutMs) {
+    engine_->run(pollTimeoutMs);
+}
+
+void EndpointManager::stop() noexcept {
+    engine_->stop();
+}
+
+void EndpointManager::flush() {
+    engine_->flush();
+}
+
+IoEngine& EndpointManager::getEngine() noexcept {
+    return *engine_;
+}
+
+TrackMessageDispatcher& EndpointManager::getDispatcher() noexcept {
+    return dispatcher_;
+}
+
+TrackPublisher& EndpointManager::getPublisher() noexcept {
+    return publisher_;
+}
+
+std::size_t EndpointManager::getReceiverCount() const noexcept {
+    return receivers_.size();
+}
+
+std::size_t EndpointManager::getSenderCount() const noexcept {
+    return senders_.size();
+}
+
+void EndpointManager::registerMetrics(TransportMetrics& metrics, const std::string& prefix) const {
+    metrics.addCollector([this, prefix](std::vector<MetricSample>& samples) {
+        samples.push_back({prefix + ".receivers", static_cast<uint64_t>(receivers_.size())});
+        samples.push_back({prefix + ".senders", static_cast<uint64_t>(senders_.size())});
+    });
+    dispatcher_.registerMetrics(metrics, prefix + ".dispatcher");
+}
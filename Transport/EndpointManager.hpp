@@ -0,0 +1,128 @@
+#pragma once
+
+// MISRA C++ 2023 compliant includes
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "EndpointConfig.hpp"
+#include "IoEngine.hpp"
+#include "ServiceRegistry.hpp"
+#include "TrackMessageDispatcher.hpp"
+#include "TrackMessageTraits.hpp"
+#include "TrackPublisher.hpp"
+#include "TrackSharding.hpp"
+#include "TransportMetrics.hpp"
+
+/**
+ * @brief Process-wide owner of the multicast endpoints in the ServiceRegistry.
+ * Each group address and port gets at most one receive and one send socket,
+ * however many handlers or message types use it. All of them are polled by
+ * a single IoEngine loop, and received datagrams go through one shared
+ * dispatcher. Sockets open lazily on the first subscribe()/publish() of a
+ * type. Same threading rules as IoEngine: drive it from one thread and call
+ * only stop() from others.
+ */
+class EndpointManager final {
+public:
+    explicit EndpointManager(IoEngineKind kind = IoEngineKind::Auto, const std::string& interfaceAddress = "0.0.0.0");
+    explicit EndpointManager(std::unique_ptr<IoEngine> engine, const std::string& interfaceAddress = "0.0.0.0");
+
+    // Copy constructor
+    EndpointManager(const EndpointManager& other) = delete;
+
+    // Copy assignment operator
+    EndpointManager& operator=(const EndpointManager& other) = delete;
+
+    // Destructor
+    ~EndpointManager() = default;
+
+    /// Overrides the registry settings of a service; takes effect when its socket opens
+    void configure(const ServiceDescriptor& service, const EndpointConfig& config);
+
+    template <typename T>
+    void configure(const EndpointConfig& config) {
+        configure(TrackMessageTraits<T>::DESCRIPTOR, config);
+    }
+
+    /// Adds a handler for type T, joining its group on first use
+    template <typename T>
+    void subscribe(std::function<void(const T&)> handler) {
+        (void)openReceiver(TrackMessageTraits<T>::DESCRIPTOR);
+        dispatcher_.subscribe<T>(std::move(handler));
+    }
+
+    /// Adds a handler for the given shards of a sharded type, joining only their endpoints
+    template <typename T>
+    void subscribeShards(const TrackShardScheme& scheme, const std::vector<uint32_t>& shards,
+                         const std::function<void(const T&)>& handler) {
+        for (const uint32_t shard : shards) {
+            (void)openReceiver(scheme.endpointOf(shard));
+            dispatcher_.subscribe<T>(handler, scheme.groupOf(shard));
+        }
+    }
+
+    /// Publishes type T sharded by scheme; call before the first publish<T>()
+    template <typename T>
+    void advertiseShards(const TrackShardScheme& scheme) {
+        std::vector<std::size_t> endpoints;
+        for (uint32_t shard = 0U; shard < scheme.getShardCount(); ++shard) {
+            endpoints.push_back(openSender(scheme.endpointOf(shard)));
+        }
+        publisher_.attachSharded<T>(scheme, endpoints);
+    }
+
+    /// Publishes one record of type T, opening its sender on first use
+    template <typename T>
+    bool publish(const T& message) {
+        if (!publisher_.isAdvertised<T>()) {
+            publisher_.attach<T>(openSender(TrackMessageTraits<T>::DESCRIPTOR));
+        }
+        return publisher_.publish(message);
+    }
+
+    /// Receive endpoint of a service; shared with every service on the same group and port
+    std::size_t openReceiver(const ServiceDescriptor& service);
+    std::size_t openReceiver(const EndpointConfig& config);
+    /// Send endpoint of a service; shared with every service on the same group and port
+    std::size_t openSender(const ServiceDescriptor& service);
+    std::size_t openSender(const EndpointConfig& config);
+
+    std::size_t poll(int timeoutMs);
+    void run(int pollTimeoutMs = 100);
+    void stop() noexcept;
+    void flush();
+
+    [[nodiscard]] IoEngine& getEngine() noexcept;
+    [[nodiscard]] TrackMessageDispatcher& getDispatcher() noexcept;
+    [[nodiscard]] TrackPublisher& getPublisher() noexcept;
+    [[nodiscard]] std::size_t getReceiverCount() const noexcept;
+    [[nodiscard]] std::size_t getSenderCount() const noexcept;
+
+    /// Exposes socket counts and the dispatcher counters under prefix
+    void registerMetrics(TransportMetrics& metrics, const std::string& prefix = "endpoints") const;
+
+private:
+    struct OpenEndpoint final {
+        std::string address;
+        int port{0};
+        std::size_t endpoint{0U};
+    };
+
+    [[nodiscard]] EndpointConfig configFor(const ServiceDescriptor& service) const;
+    static const OpenEndpoint* find(const std::vector<OpenEndpoint>& endpoints, const EndpointConfig& config) noexcept;
+
+    std::unique_ptr<IoEngine> engine_;
+    std::string interfaceAddress_;
+    std::array<EndpointConfig, SERVICE_COUNT> configs_{};
+    std::array<bool, SERVICE_COUNT> configured_{};
+    std::vector<OpenEndpoint> receivers_;
+    std::vector<OpenEndpoint> senders_;
+    TrackMessageDispatcher dispatcher_;
+    TrackPublisher publisher_;
+};
@@ -0,0 +1,92 @@
+#include "EpollEngine.hpp"
+
+#include <array>
+#include <cerrno>
+#include <sys/epoll.h>
+#include <system_error>
+#include <unistd.h>
+
+EpollEngine::EpollEngine() : buffer_(MAX_DATAGRAM_SIZE) {
+    epollFd_ = epoll_create1(EPOLL_CLOEXEC);
+    if (epollFd_ < 0) {
+        throw std::system_error(errno, std::generic_category(), "epoll_create1");
+    }
+}
+
+EpollEngine::~EpollEngine() {
+    if (epollFd_ >= 0) {
+        (void)::close(epollFd_);
+    }
+}
+
+std::size_t EpollEngine::addReceiver(const EndpointConfig& config) {
+    MulticastSocket socket = MulticastSocket::openReceiver(config);
+    socket.setNonBlocking(true);
+
+    const std::size_t endpoint = sockets_.size();
+    epoll_event event{};
+    event.events = EPOLLIN;
+    event.data.u64 = endpoint;
+    if (epoll_ctl(epollFd_, EPOLL_CTL_ADD, socket.fd(), &event) != 0) {
+        throw std::system_error(errno, std::generic_category(), "epoll_ctl");
+    }
+    sockets_.push_back(std::move(socket));
+    return endpoint;
+}
+
+std::size_t EpollEngine::addSender(const EndpointConfig& config) {
+    sockets_.push_back(MulticastSocket::openSender(config));
+    return sockets_.size() - 1U;
+}
+
+bool EpollEngine::send(std::size_t endpoint, const uint8_t* data, std::size_t size) {
+    if (endpoint >= sockets_.size()) {
+        return false;
+    }
+    return sockets_[endpoint].send(data, size);
+}
+
+bool EpollEngine::sendv(std::size_t endpoint, const iovec* vectors, std::size_t count) {
+    if (endpoint >= sockets_.size()) {
+        return false;
+    }
+    return sockets_[endpoint].send(vectors, count);
+}
+
+void EpollEngine::flush() {
+    // Sends are written synchronously
+}
+
+bool EpollEngine::readTransmitTimestamp(std::size_t endpoint, TransmitTimestamp& timestamp) {
+    return (endpoint < sockets_.size()) && sockets_[endpoint].readTransmitTimestamp(timestamp);
+}
+
+std::size_t EpollEngine::poll(int timeoutMs) {
+    std::array<epoll_event, 16> events{};
+    const int ready = epoll_wait(epollFd_, events.data(), static_cast<int>(events.size()), timeoutMs);
+    if (ready <= 0) {
+        return 0U;
+    }
+
+    std::size_t delivered = 0U;
+    for (int i = 0; i < ready; ++i) {
+        const std::size_t endpoint = static_cast<std::size_t>(events[static_cast<std::size_t>(i)].data.u64);
+        MulticastSocket& socket = sockets_[endpoint];
+        const bool timestamped = socket.isTimestamping();
+        ReceiveTimestamps timestamps;
+        for (int budget = DRAIN_BUDGET; budget > 0; --budget) {
+            const ssize_t received = timestamped ? socket.receive(buffer_.data(), buffer_.size(), timestamps)
+                                                 : socket.receive(buffer_.data(), buffer_.size());
+            if (received < 0) {
+                break;
+            }
+            deliver(endpoint, buffer_.data(), static_cast<std::size_t>(received), timestamps);
+            ++delivered;
+        }
+    }
+    return delivered;
+}
+
+const char* EpollEngine::name() const noexcept {
+    return "epoll";
+}
@@ -0,0 +1,39 @@
+#pragma once
+
+// MISRA C++ 2023 compliant includes
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+#include "IoEngine.hpp"
+#include "MulticastSocket.hpp"
+
+/**
+ * @brief Readiness based fallback engine: one epoll set over non-blocking
+ * sockets, draining each ready socket with recv() until EAGAIN.
+ */
+class EpollEngine final : public IoEngine {
+public:
+    static constexpr std::size_t MAX_DATAGRAM_SIZE = 65536U;
+
+    explicit EpollEngine();
+    ~EpollEngine() override;
+
+    std::size_t addReceiver(const EndpointConfig& config) override;
+    std::size_t addSender(const EndpointConfig& config) override;
+    bool send(std::size_t endpoint, const uint8_t* data, std::size_t size) override;
+    bool sendv(std::size_t endpoint, const iovec* vectors, std::size_t count) override;
+    void flush() override;
+    bool readTransmitTimestamp(std::size_t endpoint, TransmitTimestamp& timestamp) override;
+    std::size_t poll(int timeoutMs) override;
+
+    [[nodiscard]] const char* name() const noexcept override;
+
+private:
+    /// Upper bound of datagrams drained from one socket per wakeup, keeps groups fair
+    static constexpr int DRAIN_BUDGET = 64;
+
+    int epollFd_{-1};
+    std::vector<MulticastSocket> sockets_;
+    std::vector<uint8_t> buffer_;
+};
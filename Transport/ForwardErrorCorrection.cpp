@@ -0,0 +1,412 @@
+#include "ForwardErrorCorrection.hpp"
+
+#include <algorithm>
+#include <cstring>
+#include <stdexcept>
+
+#include "MessageEnvelope.hpp"
+
+namespace {
+
+/// GF(2^8) with the Reed-Solomon polynomial x^8 + x^4 + x^3 + x^2 + 1
+struct GaloisTables {
+    uint8_t exp[512];
+    uint8_t log[256];
+    uint8_t mul[256][256];
+};
+
+GaloisTables buildTables() noexcept {
+    GaloisTables tables{};
+    unsigned value = 1U;
+    for (unsigned i = 0U; i < 255U; ++i) {
+        tables.exp[i] = static_cast<uint8_t>(value);
+        tables.log[value] = static_cast<uint8_t>(i);
+        value <<= 1U;
+        if ((value & 0x100U) != 0U) {
+            value ^= 0x11DU;
+        }
+    }
+    for (unsigned i = 255U; i < 512U; ++i) {
+        tables.exp[i] = tables.exp[i - 255U];
+    }
+    for (unsigned a = 1U; a < 256U; ++a) {
+        for (unsigned b = 1U; b < 256U; ++b) {
+            tables.mul[a][b] = tables.exp[tables.log[a] + tables.log[b]];
+        }
+    }
+    return tables;
+}
+
+const GaloisTables& galois() noexcept {
+    static const GaloisTables tables = buildTables();
+    return tables;
+}
+
+uint8_t gfMul(uint8_t a, uint8_t b) noexcept {
+    return galois().mul[a][b];
+}
+
+uint8_t gfInverse(uint8_t a) noexcept {
+    return galois().exp[255U - galois().log[a]];
+}
+
+/// dst ^= c * src, byte-wise over GF(256)
+void mulAdd(uint8_t* dst, const uint8_t* src, std::size_t size, uint8_t c) noexcept {
+    if (c == 0U) {
+        return;
+    }
+    if (c == 1U) {
+        for (std::size_t i = 0U; i < size; ++i) {
+            dst[i] ^= src[i];
+        }
+        return;
+    }
+    const uint8_t* const row = galois().mul[c];
+    for (std::size_t i = 0U; i < size; ++i) {
+        dst[i] ^= row[src[i]];
+    }
+}
+
+/// Parity row j, data column i: all ones for Xor, Cauchy 1 / (j ^ (m + i)) for Reed-Solomon
+uint8_t coefficient(const FecHeader& header, std::size_t parityRow, std::size_t dataIndex) noexcept {
+    if (header.scheme == FecScheme::Xor) {
+        return 1U;
+    }
+    return gfInverse(static_cast<uint8_t>(parityRow ^ (header.parityCount + dataIndex)));
+}
+
+/// Adds c * (length-prefixed data symbol) to a parity symbol
+void addSymbol(uint8_t* symbol, const uint8_t* body, std::size_t size, uint8_t c) noexcept {
+    const uint16_t length = static_cast<uint16_t>(size);
+    uint8_t prefix[sizeof(length)];
+    std::memcpy(prefix, &length, sizeof(length));
+    mulAdd(symbol, prefix, sizeof(prefix), c);
+    mulAdd(symbol + sizeof(prefix), body, size, c);
+}
+
+/// Gauss-Jordan inversion of an n x n matrix in place; false when singular
+bool invert(std::vector<uint8_t>& matrix, std::size_t n) {
+    std::vector<uint8_t> inverse(n * n, 0U);
+    for (std::size_t i = 0U; i < n; ++i) {
+        inverse[(i * n) + i] = 1U;
+    }
+    for (std::size_t column = 0U; column < n; ++column) {
+        std::size_t pivot = column;
+        while ((pivot < n) && (matrix[(pivot * n) + column] == 0U)) {
+            ++pivot;
+        }
+        if (pivot == n) {
+            return false;
+        }
+        if (pivot != column) {
+            std::swap_ranges(&matrix[pivot * n], &matrix[pivot * n] + n, &matrix[column * n]);
+            std::swap_ranges(&inverse[pivot * n], &inverse[pivot * n] + n, &inverse[column * n]);
+        }
+        const uint8_t scale = gfInverse(matrix[(column * n) + column]);
+        for (std::size_t k = 0U; k < n; ++k) {
+            matrix[(column * n) + k] = gfMul(matrix[(column * n) + k], scale);
+            inverse[(column * n) + k] = gfMul(inverse[(column * n) + k], scale);
+        }
+        for (std::size_t row = 0U; row < n; ++row) {
+            const uint8_t factor = matrix[(row * n) + column];
+            if ((row != column) && (factor != 0U)) {
+                mulAdd(&matrix[row * n], &matrix[column * n], n, factor);
+                mulAdd(&inverse[row * n], &inverse[column * n], n, factor);
+            }
+        }
+    }
+    matrix.swap(inverse);
+    return true;
+}
+
+constexpr std::size_t PARITY_WINDOWS = 16U;
+constexpr std::size_t PARITY_OFFSET = MessageEnvelope::SIZE + FecHeader::SIZE;
+
+}  // namespace
+
+void FecHeader::encode(uint8_t* out) const noexcept {
+    const uint16_t reserved = 0U;
+    std::memcpy(out, &windowStart, sizeof(windowStart));
+    out[8] = static_cast<uint8_t>(scheme);
+    out[9] = dataCount;
+    out[10] = parityCount;
+    out[11] = parityIndex;
+    std::memcpy(out + 12, &symbolSize, sizeof(symbolSize));
+    std::memcpy(out + 14, &reserved, sizeof(reserved));
+}
+
+bool FecHeader::decode(const uint8_t* data, std::size_t size, FecHeader& header) noexcept {
+    if (size < SIZE) {
+        return false;
+    }
+    std::memcpy(&header.windowStart, data, sizeof(header.windowStart));
+    header.scheme = static_cast<FecScheme>(data[8]);
+    header.dataCount = data[9];
+    header.parityCount = data[10];
+    header.parityIndex = data[11];
+    std::memcpy(&header.symbolSize, data + 12, sizeof(header.symbolSize));
+    return ((header.scheme == FecScheme::Xor) || (header.scheme == FecScheme::ReedSolomon)) &&
+           (header.dataCount > 0U) && (header.parityIndex < header.parityCount) &&
+           ((header.scheme != FecScheme::Xor) || (header.parityCount == 1U)) && (header.symbolSize >= 2U) &&
+           ((static_cast<std::size_t>(header.dataCount) + header.parityCount) <= 255U);
+}
+
+FecEncoder::FecEncoder(const FecOptions& options) : options_(options) {
+    if (options_.scheme == FecScheme::None) {
+        throw std::invalid_argument("FecEncoder needs a parity scheme");
+    }
+    if (options_.scheme == FecScheme::Xor) {
+        options_.parityPackets = 1U;
+    }
+    if ((options_.dataPackets == 0U) || (options_.parityPackets == 0U) ||
+        ((static_cast<std::size_t>(options_.dataPackets) + options_.parityPackets) > 255U)) {
+        throw std::invalid_argument("FecEncoder window must satisfy 1 <= k, 1 <= m, k + m <= 255");
+    }
+    window_.resize(options_.dataPackets);
+    parities_.resize(options_.parityPackets);
+}
+
+bool FecEncoder::add(uint64_t sequence, const uint8_t* body, std::size_t size) {
+    const iovec vector{const_cast<uint8_t*>(body), size};
+    return add(sequence, &vector, 1U);
+}
+
+bool FecEncoder::add(uint64_t sequence, const iovec* vectors, std::size_t count) {
+    std::size_t size = 0U;
+    for (std::size_t i = 0U; i < count; ++i) {
+        size += vectors[i].iov_len;
+    }
+    if (size > (0xFFFFU - 2U)) {
+        return false;
+    }
+    if ((count_ > 0U) && (sequence != (windowStart_ + count_))) {
+        // Parity covers consecutive sequences only; an interrupted window is abandoned
+        count_ = 0U;
+    }
+    if (count_ == 0U) {
+        windowStart_ = sequence;
+    }
+    std::vector<uint8_t>& slot = window_[count_];
+    slot.clear();
+    for (std::size_t i = 0U; i < count; ++i) {
+        const uint8_t* const part = static_cast<const uint8_t*>(vectors[i].iov_base);
+        slot.insert(slot.end(), part, part + vectors[i].iov_len);
+    }
+    ++count_;
+    if (count_ < options_.dataPackets) {
+        return false;
+    }
+    closeWindow();
+    return true;
+}
+
+bool FecEncoder::flush() {
+    if (count_ == 0U) {
+        return false;
+    }
+    closeWindow();
+    return true;
+}
+
+void FecEncoder::closeWindow() {
+    std::size_t largest = 0U;
+    for (std::size_t i = 0U; i < count_; ++i) {
+        largest = std::max(largest, window_[i].size());
+    }
+
+    FecHeader header;
+    header.windowStart = windowStart_;
+    header.scheme = options_.scheme;
+    header.dataCount = static_cast<uint8_t>(count_);
+    header.parityCount = options_.parityPackets;
+    header.symbolSize = static_cast<uint16_t>(largest + 2U);
+
+    MessageEnvelope envelope;
+    envelope.recordCount = 0U;
+    envelope.sequence = windowStart_;
+    envelope.flags = MessageEnvelope::FLAG_PARITY;
+
+    for (std::size_t row = 0U; row < parities_.size(); ++row) {
+        std::vector<uint8_t>& parity = parities_[row];
+        parity.assign(PARITY_OFFSET + header.symbolSize, 0U);
+        header.parityIndex = static_cast<uint8_t>(row);
+        envelope.encode(parity.data());
+        header.encode(parity.data() + MessageEnvelope::SIZE);
+        for (std::size_t i = 0U; i < count_; ++i) {
+            addSymbol(parity.data() + PARITY_OFFSET, window_[i].data(), window_[i].size(),
+                      coefficient(header, row, i));
+        }
+    }
+    count_ = 0U;
+}
+
+const std::vector<std::vector<uint8_t>>& FecEncoder::getParityBodies() const noexcept {
+    return parities_;
+}
+
+const FecOptions& FecEncoder::getOptions() const noexcept {
+    return options_;
+}
+
+FecDecoder::FecDecoder(std::size_t historyPackets)
+    : history_(std::max<std::size_t>(historyPackets, 255U)), windows_(PARITY_WINDOWS) {}
+
+void FecDecoder::onData(uint64_t sequence, const uint8_t* body, std::size_t size) {
+    DataSlot& slot = history_[sequence % history_.size()];
+    slot.sequence = sequence;
+    slot.valid = true;
+    slot.body.assign(body, body + size);
+}
+
+const FecDecoder::DataSlot* FecDecoder::findData(uint64_t sequence) const noexcept {
+    const DataSlot& slot = history_[sequence % history_.size()];
+    return (slot.valid && (slot.sequence == sequence)) ? &slot : nullptr;
+}
+
+std::size_t FecDecoder::onParity(const uint8_t* body, std::size_t size, const RecoveredHandler& handler) {
+    FecHeader header;
+    if ((size < PARITY_OFFSET) ||
+        !FecHeader::decode(body + MessageEnvelope::SIZE, size - MessageEnvelope::SIZE, header) ||
+        ((size - PARITY_OFFSET) < header.symbolSize)) {
+        return 0U;
+    }
+    parity_.add();
+
+    ParityWindow* window = nullptr;
+    for (ParityWindow& candidate : windows_) {
+        if (candidate.active && (candidate.header.windowStart == header.windowStart)) {
+            window = &candidate;
+        }
+    }
+    if ((window != nullptr) && ((window->header.dataCount != header.dataCount) ||
+                                (window->header.parityCount != header.parityCount) ||
+                                (window->header.symbolSize != header.symbolSize) ||
+                                (window->header.scheme != header.scheme))) {
+        // Publisher restarted and reused the window start
+        window->active = false;
+        window = nullptr;
+    }
+    if (window == nullptr) {
+        window = &windows_[0];
+        for (ParityWindow& candidate : windows_) {
+            if (!candidate.active) {
+                window = &candidate;
+                break;
+            }
+            if (candidate.header.windowStart < window->header.windowStart) {
+                window = &candidate;
+            }
+        }
+        retire(*window);
+        window->header = header;
+        window->active = true;
+        window->repaired = false;
+        window->present.assign(header.parityCount, false);
+        window->symbols.resize(header.parityCount);
+    }
+    if (window->repaired) {
+        return 0U;
+    }
+    const uint8_t* const symbol = body + PARITY_OFFSET;
+    window->symbols[header.parityIndex].assign(symbol, symbol + header.symbolSize);
+    window->present[header.parityIndex] = true;
+    return tryRecover(*window, handler);
+}
+
+std::size_t FecDecoder::tryRecover(ParityWindow& window, const RecoveredHandler& handler) {
+    const FecHeader& header = window.header;
+    std::vector<std::size_t> missing;
+    for (std::size_t i = 0U; i < header.dataCount; ++i) {
+        if (findData(header.windowStart + i) == nullptr) {
+            missing.push_back(i);
+        }
+    }
+    if (missing.empty()) {
+        window.repaired = true;
+        return 0U;
+    }
+    std::vector<std::size_t> rows;
+    for (std::size_t row = 0U; (row < header.parityCount) && (rows.size() < missing.size()); ++row) {
+        if (window.present[row]) {
+            rows.push_back(row);
+        }
+    }
+    if (rows.size() < missing.size()) {
+        return 0U;
+    }
+
+    // Syndromes: parity minus the contribution of every data symbol that did arrive
+    const std::size_t lost = missing.size();
+    work_.resize(lost * 2U);
+    for (std::size_t r = 0U; r < lost; ++r) {
+        work_[r] = window.symbols[rows[r]];
+    }
+    for (std::size_t i = 0U; i < header.dataCount; ++i) {
+        const DataSlot* const data = findData(header.windowStart + i);
+        if (data == nullptr) {
+            continue;
+        }
+        if ((data->body.size() + 2U) > header.symbolSize) {
+            // The parity cannot cover this body, so the window's syndromes would be wrong
+            return 0U;
+        }
+        for (std::size_t r = 0U; r < lost; ++r) {
+            addSymbol(work_[r].data(), data->body.data(), data->body.size(), coefficient(header, rows[r], i));
+        }
+    }
+
+    std::vector<uint8_t> matrix(lost * lost);
+    for (std::size_t r = 0U; r < lost; ++r) {
+        for (std::size_t t = 0U; t < lost; ++t) {
+            matrix[(r * lost) + t] = coefficient(header, rows[r], missing[t]);
+        }
+    }
+    if (!invert(matrix, lost)) {
+        return 0U;
+    }
+
+    window.repaired = true;
+    std::size_t rebuilt = 0U;
+    for (std::size_t t = 0U; t < lost; ++t) {
+        std::vector<uint8_t>& symbol = work_[lost + t];
+        symbol.assign(header.symbolSize, 0U);
+        for (std::size_t r = 0U; r < lost; ++r) {
+            mulAdd(symbol.data(), work_[r].data(), header.symbolSize, matrix[(t * lost) + r]);
+        }
+        uint16_t length = 0U;
+        std::memcpy(&length, symbol.data(), sizeof(length));
+        if ((static_cast<std::size_t>(length) + 2U) > header.symbolSize) {
+            continue;
+        }
+        const uint64_t sequence = header.windowStart + missing[t];
+        onData(sequence, symbol.data() + 2U, length);
+        recovered_.add();
+        ++rebuilt;
+        handler(sequence, symbol.data() + 2U, length);
+    }
+    return rebuilt;
+}
+
+void FecDecoder::retire(ParityWindow& window) noexcept {
+    if (!window.active || window.repaired) {
+        return;
+    }
+    for (std::size_t i = 0U; i < window.header.dataCount; ++i) {
+        if (findData(window.header.windowStart + i) == nullptr) {
+            unrecoverable_.add();
+            return;
+        }
+    }
+}
+
+uint64_t FecDecoder::getParityCount() const noexcept {
+    return parity_.load();
+}
+
+uint64_t FecDecoder::getRecoveredCount() const noexcept {
+    return recovered_.load();
+}
+
+uint64_t FecDecoder::getUnrecoverableCount() const noexcept {
+    return unrecoverable_.load();
+}
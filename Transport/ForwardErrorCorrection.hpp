@@ -0,0 +1,137 @@
+#pragma once
+
+// MISRA C++ 2023 compliant includes
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <vector>
+
+#include <sys/uio.h>
+
+#include "RelaxedCounter.hpp"
+
+/// Parity code protecting a window of consecutive datagrams of one group
+enum class FecScheme : uint8_t {
+    None,
+    Xor,         ///< one parity per window, recovers one loss
+    ReedSolomon  ///< parityPackets parities over GF(256), recovers up to parityPackets losses
+};
+
+struct FecOptions final {
+    FecScheme scheme{FecScheme::None};
+    /// Data datagrams per window (k)
+    uint8_t dataPackets{8U};
+    /// Parity datagrams per window (m); Xor always uses one
+    uint8_t parityPackets{1U};
+};
+
+/**
+ * @brief Header of a parity datagram body, following a MessageEnvelope that
+ * has FLAG_PARITY set, recordCount 0 and sequence = windowStart.
+ * Wire layout (host byte order):
+ * [windowStart:8][scheme:1][dataCount:1][parityCount:1][parityIndex:1][symbolSize:2][reserved:2]
+ * followed by symbolSize parity bytes. Data symbol i is the body (envelope +
+ * records) of sequence windowStart + i, prefixed with its 2-byte length and
+ * zero-padded to symbolSize, so windows of unequal datagrams are protected too.
+ */
+struct FecHeader final {
+    static constexpr std::size_t SIZE = 16U;
+
+    uint64_t windowStart{0U};
+    FecScheme scheme{FecScheme::None};
+    uint8_t dataCount{0U};
+    uint8_t parityCount{0U};
+    uint8_t parityIndex{0U};
+    uint16_t symbolSize{0U};
+
+    void encode(uint8_t* out) const noexcept;
+    [[nodiscard]] static bool decode(const uint8_t* data, std::size_t size, FecHeader& header) noexcept;
+};
+
+/**
+ * @brief Sender side: collects the bodies of consecutive datagrams and emits
+ * parity bodies when a window of dataPackets is complete.
+ * Parity rows are all ones for Xor and a Cauchy matrix for ReedSolomon, so
+ * any m of k + m symbols of a window are enough to rebuild the k data ones.
+ * Buffers grow to the largest window once and are reused afterwards.
+ */
+class FecEncoder final {
+public:
+    /// Throws std::invalid_argument for scheme None or impossible k/m
+    explicit FecEncoder(const FecOptions& options);
+
+    /// Adds the body (envelope + records) of datagram sequence; true when parity bodies are ready
+    bool add(uint64_t sequence, const uint8_t* body, std::size_t size);
+
+    /// Same as add() for a body handed to the engine as a gather list
+    bool add(uint64_t sequence, const iovec* vectors, std::size_t count);
+
+    /// Emits parities for a partially filled window; false when the window is empty
+    bool flush();
+
+    /// Complete parity bodies (envelope + FecHeader + symbol) of the window closed last
+    [[nodiscard]] const std::vector<std::vector<uint8_t>>& getParityBodies() const noexcept;
+
+    [[nodiscard]] const FecOptions& getOptions() const noexcept;
+
+private:
+    void closeWindow();
+
+    FecOptions options_;
+    uint64_t windowStart_{0U};
+    std::size_t count_{0U};
+    std::vector<std::vector<uint8_t>> window_;
+    std::vector<std::vector<uint8_t>> parities_;
+};
+
+/**
+ * @brief Receiver side: keeps copies of recently received data bodies and
+ * rebuilds missing ones as soon as a window holds enough parity datagrams.
+ * Recovery runs when a parity body arrives; a window whose data is all
+ * present is dropped without work. Driven by the dispatching thread.
+ */
+class FecDecoder final {
+public:
+    using RecoveredHandler = std::function<void(uint64_t sequence, const uint8_t* body, std::size_t size)>;
+
+    /// historyPackets bounds how far back a window may start and still be repaired
+    explicit FecDecoder(std::size_t historyPackets = 1024U);
+
+    /// Records a data body so later parity can use it
+    void onData(uint64_t sequence, const uint8_t* body, std::size_t size);
+
+    /// Takes a parity body; calls handler for every data body it rebuilds and returns their number
+    std::size_t onParity(const uint8_t* body, std::size_t size, const RecoveredHandler& handler);
+
+    [[nodiscard]] uint64_t getParityCount() const noexcept;
+    [[nodiscard]] uint64_t getRecoveredCount() const noexcept;
+    /// Windows that still missed more data than their parity could cover when their slot was reused
+    [[nodiscard]] uint64_t getUnrecoverableCount() const noexcept;
+
+private:
+    struct DataSlot {
+        uint64_t sequence{0U};
+        bool valid{false};
+        std::vector<uint8_t> body;
+    };
+
+    struct ParityWindow {
+        FecHeader header;
+        bool active{false};
+        bool repaired{false};
+        std::vector<bool> present;
+        std::vector<std::vector<uint8_t>> symbols;
+    };
+
+    [[nodiscard]] const DataSlot* findData(uint64_t sequence) const noexcept;
+    std::size_t tryRecover(ParityWindow& window, const RecoveredHandler& handler);
+    void retire(ParityWindow& window) noexcept;
+
+    std::vector<DataSlot> history_;
+    std::vector<ParityWindow> windows_;
+    std::vector<std::vector<uint8_t>> work_;
+
+    RelaxedCounter parity_;
+    RelaxedCounter recovered_;
+    RelaxedCounter unrecoverable_;
+};
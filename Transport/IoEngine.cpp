@@ -0,0 +1,41 @@
+#include "IoEngine.hpp"
+
+#include <system_error>
+#include <utility>
+
+#include "BusyPollEngine.hpp"
+#include "EpollEngine.hpp"
+#include "IoUringEngine.hpp"
+
+void IoEngine::setHandler(DatagramHandler handler) {
+    handler_ = std::move(handler);
+}
+
+void IoEngine::run(int pollTimeoutMs) {
+    while (running_.load(std::memory_order_acquire)) {
+        (void)poll(pollTimeoutMs);
+    }
+}
+
+void IoEngine::stop() noexcept {
+    running_.store(false, std::memory_order_release);
+}
+
+std::unique_ptr<IoEngine> IoEngine::create(IoEngineKind kind) {
+    switch (kind) {
+        case IoEngineKind::IoUring:
+            return std::make_unique<IoUringEngine>();
+        case IoEngineKind::Epoll:
+            return std::make_unique<EpollEngine>();
+        case IoEngineKind::BusyPoll:
+            return std::make_unique<BusyPollEngine>();
+        case IoEngineKind::Auto:
+        default:
+            try {
+                return std::make_unique<IoUringEngine>();
+            } catch (const std::system_error&) {
+                // io_uring missing, disabled by sysctl or blocked by seccomp
+                return std::make_unique<EpollEngine>();
+            }
+    }
+}
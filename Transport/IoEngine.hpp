@@ -0,0 +1,102 @@
+#pragma once
+
+// MISRA C++ 2023 compliant includes
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <sys/uio.h>
+
+#include "EndpointConfig.hpp"
+#include "PacketTimestamps.hpp"
+
+/// Engine implementation selected by IoEngine::create()
+enum class IoEngineKind : uint8_t {
+    Auto,     ///< io_uring when the kernel allows it, epoll otherwise
+    IoUring,
+    Epoll,
+    BusyPoll  ///< spinning non-blocking recv, see BusyPollEngine
+};
+
+/**
+ * @brief One datagram handed to the engine's handler.
+ * The data pointer is only valid for the duration of the handler call.
+ */
+struct ReceivedDatagram final {
+    std::size_t endpoint{0U};
+    const uint8_t* data{nullptr};
+    std::size_t size{0U};
+    /// Kernel receive timestamps; zero unless the endpoint enabled timestamping
+    ReceiveTimestamps timestamps{};
+};
+
+using DatagramHandler = std::function<void(const ReceivedDatagram&)>;
+
+/**
+ * @brief Event loop owning a set of multicast endpoints.
+ * Receivers and senders share one index space; the index returned by
+ * addReceiver()/addSender() identifies the endpoint in ReceivedDatagram and send().
+ * All calls except stop() must come from the thread that runs the loop.
+ */
+class IoEngine {
+public:
+    // Copy constructor
+    IoEngine(const IoEngine& other) = delete;
+
+    // Copy assignment operator
+    IoEngine& operator=(const IoEngine& other) = delete;
+
+    // Destructor
+    virtual ~IoEngine() = default;
+
+    virtual std::size_t addReceiver(const EndpointConfig& config) = 0;
+    virtual std::size_t addSender(const EndpointConfig& config) = 0;
+
+    /// Queues one datagram on a sender endpoint; returns false when it could not be queued
+    virtual bool send(std::size_t endpoint, const uint8_t* data, std::size_t size) = 0;
+
+    /// Queues one datagram gathered from count buffers (header, records, trailers) without joining them first
+    virtual bool sendv(std::size_t endpoint, const iovec* vectors, std::size_t count) = 0;
+
+    /// Pushes queued sends to the kernel
+    virtual void flush() = 0;
+
+    /// Pops one kernel transmit timestamp of a timestamping sender; false when none is pending
+    virtual bool readTransmitTimestamp(std::size_t endpoint, TransmitTimestamp& timestamp) = 0;
+
+    /// Waits up to timeoutMs (-1 = forever, 0 = no wait) and dispatches; returns datagrams delivered
+    virtual std::size_t poll(int timeoutMs) = 0;
+
+    [[nodiscard]] virtual const char* name() const noexcept = 0;
+
+    /// Largest datagram send()/sendv() accept; the UDP/IPv4 payload limit unless the engine is smaller
+    [[nodiscard]] virtual std::size_t getMaxDatagramSize() const noexcept {
+        return MAX_UDP_PAYLOAD;
+    }
+
+    static constexpr std::size_t MAX_UDP_PAYLOAD = 65507U;
+
+    void setHandler(DatagramHandler handler);
+
+    /// Polls until stop() is called; stop() is one-shot, so one issued before run() starts still ends it
+    void run(int pollTimeoutMs = 100);
+    void stop() noexcept;
+
+    static std::unique_ptr<IoEngine> create(IoEngineKind kind = IoEngineKind::Auto);
+
+protected:
+    explicit IoEngine() noexcept = default;
+
+    void deliver(std::size_t endpoint, const uint8_t* data, std::size_t size,
+                 const ReceiveTimestamps& timestamps = ReceiveTimestamps{}) const {
+        if (handler_) {
+            handler_(ReceivedDatagram{endpoint, data, size, timestamps});
+        }
+    }
+
+private:
+    DatagramHandler handler_;
+    /// Set from construction so a stop() racing the start of run() is never overwritten
+    std::atomic<bool> running_{true};
+};
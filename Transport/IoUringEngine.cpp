@@ -0,0 +1,415 @@
+#include "IoUringEngine.hpp"
+
+#include <cerrno>
+#include <cstring>
+#include <linux/io_uring.h>
+#include <stdexcept>
+#include <sys/mman.h>
+#include <sys/socket.h>
+#include <sys/syscall.h>
+#include <system_error>
+#include <unistd.h>
+
+namespace {
+
+constexpr uint64_t OP_RECEIVE = 1U;
+constexpr uint64_t OP_SEND = 2U;
+constexpr uint16_t BUFFER_GROUP = 0U;
+
+constexpr uint64_t makeUserData(uint64_t op, uint64_t index) noexcept {
+    return (op << 32U) | index;
+}
+
+[[noreturn]] void throwSystemError(int error, const char* what) {
+    throw std::system_error(error, std::generic_category(), what);
+}
+
+void* mapRing(int fd, std::size_t size, off_t offset) {
+    void* ptr = mmap(nullptr, size, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE, fd, offset);
+    if (ptr == MAP_FAILED) {
+        throwSystemError(errno, "mmap(io_uring)");
+    }
+    return ptr;
+}
+
+template <typename T>
+T* ringField(void* base, uint32_t offset) noexcept {
+    return reinterpret_cast<T*>(static_cast<uint8_t*>(base) + offset);
+}
+
+msghdr makeTimestampMessage() noexcept {
+    msghdr message{};
+    message.msg_controllen = MulticastSocket::TIMESTAMP_CONTROL_SIZE;
+    return message;
+}
+
+/// Layout template of multishot RECVMSG buffers: no source address, room for one SCM_TIMESTAMPING
+const msghdr TIMESTAMP_MESSAGE = makeTimestampMessage();
+
+}  // namespace
+
+IoUringEngine::IoUringEngine() : IoUringEngine(Options{}) {}
+
+IoUringEngine::IoUringEngine(const Options& options) : options_(options) {
+    if ((options_.bufferCount == 0U) || ((options_.bufferCount & (options_.bufferCount - 1U)) != 0U) ||
+        (options_.bufferCount > 32768U)) {
+        throw std::invalid_argument("IoUringEngine bufferCount must be a power of two <= 32768");
+    }
+    try {
+        setupRing();
+        setupBufferRing();
+    } catch (...) {
+        release();
+        throw;
+    }
+
+    sendSlab_.resize(static_cast<std::size_t>(options_.sendSlots) * options_.bufferSize);
+    freeSendSlots_.reserve(options_.sendSlots);
+    for (uint32_t slot = options_.sendSlots; slot > 0U; --slot) {
+        freeSendSlots_.push_back(slot - 1U);
+    }
+}
+
+IoUringEngine::~IoUringEngine() {
+    release();
+}
+
+void IoUringEngine::release() noexcept {
+    // Closing the ring cancels the armed receives before the sockets go away
+    if (ringFd_ >= 0) {
+        (void)::close(ringFd_);
+        ringFd_ = -1;
+    }
+    if (bufferRing_ != nullptr) {
+        (void)munmap(bufferRing_, bufferRingSize_);
+        bufferRing_ = nullptr;
+    }
+    if (sqes_ != nullptr) {
+        (void)munmap(sqes_, sqesSize_);
+        sqes_ = nullptr;
+    }
+    if ((cqRing_ != nullptr) && (cqRing_ != sqRing_)) {
+        (void)munmap(cqRing_, cqRingSize_);
+    }
+    cqRing_ = nullptr;
+    if (sqRing_ != nullptr) {
+        (void)munmap(sqRing_, sqRingSize_);
+        sqRing_ = nullptr;
+    }
+}
+
+void IoUringEngine::setupRing() {
+    io_uring_params params{};
+    ringFd_ = static_cast<int>(syscall(__NR_io_uring_setup, options_.ringEntries, &params));
+    if (ringFd_ < 0) {
+        throwSystemError(errno, "io_uring_setup");
+    }
+    hasExtArg_ = (params.features & IORING_FEAT_EXT_ARG) != 0U;
+
+    sqRingSize_ = params.sq_off.array + (params.sq_entries * sizeof(unsigned));
+    cqRingSize_ = params.cq_off.cqes + (params.cq_entries * sizeof(io_uring_cqe));
+    if ((params.features & IORING_FEAT_SINGLE_MMAP) != 0U) {
+        sqRingSize_ = (cqRingSize_ > sqRingSize_) ? cqRingSize_ : sqRingSize_;
+        sqRing_ = mapRing(ringFd_, sqRingSize_, IORING_OFF_SQ_RING);
+        cqRing_ = sqRing_;
+    } else {
+        sqRing_ = mapRing(ringFd_, sqRingSize_, IORING_OFF_SQ_RING);
+        cqRing_ = mapRing(ringFd_, cqRingSize_, IORING_OFF_CQ_RING);
+    }
+    sqesSize_ = params.sq_entries * sizeof(io_uring_sqe);
+    sqes_ = static_cast<io_uring_sqe*>(mapRing(ringFd_, sqesSize_, IORING_OFF_SQES));
+
+    sqHead_ = ringField<unsigned>(sqRing_, params.sq_off.head);
+    sqTail_ = ringField<unsigned>(sqRing_, params.sq_off.tail);
+    sqArray_ = ringField<unsigned>(sqRing_, params.sq_off.array);
+    sqMask_ = *ringField<unsigned>(sqRing_, params.sq_off.ring_mask);
+    sqEntries_ = *ringField<unsigned>(sqRing_, params.sq_off.ring_entries);
+    sqLocalTail_ = *sqTail_;
+    sqSubmitted_ = sqLocalTail_;
+
+    cqHead_ = ringField<unsigned>(cqRing_, params.cq_off.head);
+    cqTail_ = ringField<unsigned>(cqRing_, params.cq_off.tail);
+    cqMask_ = *ringField<unsigned>(cqRing_, params.cq_off.ring_mask);
+    cqes_ = ringField<io_uring_cqe>(cqRing_, params.cq_off.cqes);
+}
+
+void IoUringEngine::setupBufferRing() {
+    bufferRingSize_ = options_.bufferCount * sizeof(io_uring_buf);
+    void* ring = mmap(nullptr, bufferRingSize_, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+    if (ring == MAP_FAILED) {
+        throwSystemError(errno, "mmap(buffer ring)");
+    }
+    bufferRing_ = static_cast<io_uring_buf_ring*>(ring);
+
+    io_uring_buf_reg registration{};
+    registration.ring_addr = reinterpret_cast<uint64_t>(bufferRing_);
+    registration.ring_entries = options_.bufferCount;
+    registration.bgid = BUFFER_GROUP;
+    if (syscall(__NR_io_uring_register, ringFd_, IORING_REGISTER_PBUF_RING, &registration, 1) != 0) {
+        throwSystemError(errno, "io_uring_register(PBUF_RING)");
+    }
+
+    receiveSlab_.resize(static_cast<std::size_t>(options_.bufferCount) * options_.bufferSize);
+    bufferTail_ = 0U;
+    for (unsigned id = 0U; id < options_.bufferCount; ++id) {
+        recycleBuffer(static_cast<uint16_t>(id));
+    }
+    __atomic_store_n(&bufferRing_->tail, bufferTail_, __ATOMIC_RELEASE);
+}
+
+void IoUringEngine::recycleBuffer(uint16_t bufferId) noexcept {
+    // Index the ring as a plain io_uring_buf array: in C++ the empty member inside
+    // __DECLARE_FLEX_ARRAY has size 1, which shifts io_uring_buf_ring::bufs off by 8 bytes
+    io_uring_buf* const entries = reinterpret_cast<io_uring_buf*>(bufferRing_);
+    io_uring_buf& entry = entries[bufferTail_ & (options_.bufferCount - 1U)];
+    entry.addr = reinterpret_cast<uint64_t>(&receiveSlab_[static_cast<std::size_t>(bufferId) * options_.bufferSize]);
+    entry.len = options_.bufferSize;
+    entry.bid = bufferId;
+    ++bufferTail_;
+}
+
+io_uring_sqe* IoUringEngine::acquireSqe() {
+    unsigned head = __atomic_load_n(sqHead_, __ATOMIC_ACQUIRE);
+    if ((sqLocalTail_ - head) >= sqEntries_) {
+        (void)enter(0U, 0);
+        head = __atomic_load_n(sqHead_, __ATOMIC_ACQUIRE);
+        if ((sqLocalTail_ - head) >= sqEntries_) {
+            return nullptr;
+        }
+    }
+    const unsigned index = sqLocalTail_ & sqMask_;
+    io_uring_sqe* sqe = &sqes_[index];
+    std::memset(sqe, 0, sizeof(*sqe));
+    sqArray_[index] = index;
+    ++sqLocalTail_;
+    return sqe;
+}
+
+int IoUringEngine::enter(unsigned waitCount, int timeoutMs) {
+    __atomic_store_n(sqTail_, sqLocalTail_, __ATOMIC_RELEASE);
+    const unsigned toSubmit = sqLocalTail_ - sqSubmitted_;
+    if ((toSubmit == 0U) && (waitCount == 0U)) {
+        return 0;
+    }
+
+    unsigned flags = (waitCount > 0U) ? IORING_ENTER_GETEVENTS : 0U;
+    long result = 0;
+    if ((waitCount > 0U) && (timeoutMs >= 0) && hasExtArg_) {
+        __kernel_timespec timeout{};
+        timeout.tv_sec = timeoutMs / 1000;
+        timeout.tv_nsec = static_cast<long long>(timeoutMs % 1000) * 1000000LL;
+        io_uring_getevents_arg arg{};
+        arg.ts = reinterpret_cast<uint64_t>(&timeout);
+        flags |= IORING_ENTER_EXT_ARG;
+        result = syscall(__NR_io_uring_enter, ringFd_, toSubmit, waitCount, flags, &arg, sizeof(arg));
+    } else {
+        result = syscall(__NR_io_uring_enter, ringFd_, toSubmit, waitCount, flags, nullptr, 0);
+    }
+    if (result > 0) {
+        sqSubmitted_ += static_cast<unsigned>(result);
+    }
+    return (result < 0) ? -errno : static_cast<int>(result);
+}
+
+void IoUringEngine::armReceive(std::size_t endpoint) {
+    io_uring_sqe* sqe = acquireSqe();
+    if (sqe == nullptr) {
+        throw std::runtime_error("io_uring submission queue full while arming receive");
+    }
+    // Without multishot (kernel < 6.0) timestamped receivers degrade to plain RECV and report no timestamps
+    if (timestamped_[endpoint] && multishot_[endpoint]) {
+        sqe->opcode = IORING_OP_RECVMSG;
+        sqe->addr = reinterpret_cast<uint64_t>(&TIMESTAMP_MESSAGE);
+        sqe->len = 1U;
+    } else {
+        sqe->opcode = IORING_OP_RECV;
+        // Report the full datagram length, so one cut at the buffer size can be told apart
+        sqe->msg_flags = MSG_TRUNC;
+    }
+    sqe->fd = sockets_[endpoint].fd();
+    sqe->flags = IOSQE_BUFFER_SELECT;
+    sqe->buf_group = BUFFER_GROUP;
+    sqe->ioprio = multishot_[endpoint] ? IORING_RECV_MULTISHOT : 0U;
+    sqe->user_data = makeUserData(OP_RECEIVE, endpoint);
+}
+
+std::size_t IoUringEngine::addReceiver(const EndpointConfig& config) {
+    MulticastSocket socket = MulticastSocket::openReceiver(config);
+    socket.setNonBlocking(true);
+    timestamped_.push_back(socket.isTimestamping());
+    sockets_.push_back(std::move(socket));
+    multishot_.push_back(true);
+
+    const std::size_t endpoint = sockets_.size() - 1U;
+    armReceive(endpoint);
+    (void)enter(0U, 0);
+    return endpoint;
+}
+
+std::size_t IoUringEngine::addSender(const EndpointConfig& config) {
+    sockets_.push_back(MulticastSocket::openSender(config));
+    multishot_.push_back(false);
+    timestamped_.push_back(false);
+    return sockets_.size() - 1U;
+}
+
+bool IoUringEngine::send(std::size_t endpoint, const uint8_t* data, std::size_t size) {
+    const iovec vector{const_cast<uint8_t*>(data), size};
+    return sendv(endpoint, &vector, 1U);
+}
+
+bool IoUringEngine::sendv(std::size_t endpoint, const iovec* vectors, std::size_t count) {
+    std::size_t size = 0U;
+    for (std::size_t i = 0U; i < count; ++i) {
+        size += vectors[i].iov_len;
+    }
+    if ((endpoint >= sockets_.size()) || (size > options_.bufferSize)) {
+        return false;
+    }
+    if (freeSendSlots_.empty()) {
+        // Every slot is in flight: wait for at least one send completion
+        (void)enter(1U, -1);
+        (void)reapCompletions();
+        if (freeSendSlots_.empty()) {
+            return false;
+        }
+    }
+    io_uring_sqe* sqe = acquireSqe();
+    if (sqe == nullptr) {
+        return false;
+    }
+
+    const uint32_t slot = freeSendSlots_.back();
+    freeSendSlots_.pop_back();
+    uint8_t* slotData = &sendSlab_[static_cast<std::size_t>(slot) * options_.bufferSize];
+    std::size_t offset = 0U;
+    for (std::size_t i = 0U; i < count; ++i) {
+        std::memcpy(slotData + offset, vectors[i].iov_base, vectors[i].iov_len);
+        offset += vectors[i].iov_len;
+    }
+
+    sqe->opcode = IORING_OP_SEND;
+    sqe->fd = sockets_[endpoint].fd();
+    sqe->addr = reinterpret_cast<uint64_t>(slotData);
+    sqe->len = static_cast<uint32_t>(size);
+    sqe->user_data = makeUserData(OP_SEND, slot);
+    return true;
+}
+
+void IoUringEngine::flush() {
+    (void)enter(0U, 0);
+    (void)reapCompletions();
+}
+
+bool IoUringEngine::readTransmitTimestamp(std::size_t endpoint, TransmitTimestamp& timestamp) {
+    // The error queue is read synchronously; it is not on the receive path
+    return (endpoint < sockets_.size()) && sockets_[endpoint].readTransmitTimestamp(timestamp);
+}
+
+bool IoUringEngine::deliverMessage(std::size_t endpoint, uint8_t* buffer, std::size_t size) {
+    if (!timestamped_[endpoint] || !multishot_[endpoint]) {
+        if (size > options_.bufferSize) {
+            truncated_.add();
+            return false;
+        }
+        deliver(endpoint, buffer, size);
+        return true;
+    }
+    // [io_uring_recvmsg_out][name: msg_namelen][control: msg_controllen][payload]
+    io_uring_recvmsg_out out{};
+    if (size < sizeof(out)) {
+        return false;
+    }
+    std::memcpy(&out, buffer, sizeof(out));
+    uint8_t* const control = buffer + sizeof(out) + TIMESTAMP_MESSAGE.msg_namelen;
+    uint8_t* const payload = control + TIMESTAMP_MESSAGE.msg_controllen;
+    const std::size_t payloadOffset = static_cast<std::size_t>(payload - buffer);
+    if ((payloadOffset > size) || (out.payloadlen > (size - payloadOffset))) {
+        return false;
+    }
+    if ((out.flags & MSG_TRUNC) != 0U) {
+        truncated_.add();
+        return false;
+    }
+
+    msghdr message{};
+    message.msg_control = control;
+    message.msg_controllen = out.controllen;
+    ReceiveTimestamps timestamps;
+    MulticastSocket::parseTimestamps(message, timestamps);
+    deliver(endpoint, payload, out.payloadlen, timestamps);
+    return true;
+}
+
+std::size_t IoUringEngine::poll(int timeoutMs) {
+    std::size_t delivered = reapCompletions();
+    if ((delivered == 0U) && (timeoutMs != 0)) {
+        (void)enter(1U, timeoutMs);
+        delivered = reapCompletions();
+    } else {
+        (void)enter(0U, 0);
+    }
+    return delivered;
+}
+
+std::size_t IoUringEngine::reapCompletions() {
+    std::size_t delivered = 0U;
+    // Handlers may publish, and sendv()/flush() reap again from inside them: each entry is
+    // copied and the head published before it is handled, so a nested reap starts past it
+    for (;;) {
+        const unsigned head = *cqHead_;
+        if (head == __atomic_load_n(cqTail_, __ATOMIC_ACQUIRE)) {
+            break;
+        }
+        const io_uring_cqe cqe = cqes_[head & cqMask_];
+        __atomic_store_n(cqHead_, head + 1U, __ATOMIC_RELEASE);
+        const uint64_t op = cqe.user_data >> 32U;
+        const std::size_t index = static_cast<std::size_t>(cqe.user_data & 0xFFFFFFFFU);
+
+        if (op == OP_RECEIVE) {
+            if ((cqe.flags & IORING_CQE_F_BUFFER) != 0U) {
+                const uint16_t bufferId = static_cast<uint16_t>(cqe.flags >> IORING_CQE_BUFFER_SHIFT);
+                if ((cqe.res >= 0) &&
+                    deliverMessage(index, &receiveSlab_[static_cast<std::size_t>(bufferId) * options_.bufferSize],
+                                   static_cast<std::size_t>(cqe.res))) {
+                    ++delivered;
+                }
+                recycleBuffer(bufferId);
+                __atomic_store_n(&bufferRing_->tail, bufferTail_, __ATOMIC_RELEASE);
+            }
+            bool rearm = (cqe.flags & IORING_CQE_F_MORE) == 0U;
+            if (cqe.res == -EINVAL) {
+                // Kernel without multishot recv (< 6.0): fall back to one-shot re-arming
+                rearm = multishot_[index];
+                multishot_[index] = false;
+            } else if ((cqe.res == -ECANCELED) || (cqe.res == -EBADF)) {
+                rearm = false;
+            }
+            if (rearm) {
+                armReceive(index);
+            }
+        } else if (op == OP_SEND) {
+            if (cqe.res < 0) {
+                sendFailures_.add();
+            }
+            freeSendSlots_.push_back(static_cast<uint32_t>(index));
+        }
+    }
+    return delivered;
+}
+
+const char* IoUringEngine::name() const noexcept {
+    return "io_uring";
+}
+
+std::size_t IoUringEngine::getMaxDatagramSize() const noexcept {
+    return options_.bufferSize;
+}
+
+uint64_t IoUringEngine::getSendFailureCount() const noexcept {
+    return sendFailures_.load();
+}
+
+uint64_t IoUringEngine::getTruncatedCount() const noexcept {
+    return truncated_.load();
+}
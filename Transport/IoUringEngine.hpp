@@ -0,0 +1,118 @@
+#pragma once
+
+// MISRA C++ 2023 compliant includes
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+#include "IoEngine.hpp"
+#include "MulticastSocket.hpp"
+#include "RelaxedCounter.hpp"
+
+struct io_uring_sqe;
+struct io_uring_cqe;
+struct io_uring_buf_ring;
+
+/**
+ * @brief io_uring engine using a provided buffer ring and multishot receive.
+ * Each receiver keeps one armed IORING_OP_RECV; the kernel picks a buffer
+ * from the shared ring per datagram, so steady-state receive needs no
+ * syscall per message. Receivers with timestamping use multishot
+ * IORING_OP_RECVMSG instead, which places the control data (SCM_TIMESTAMPING)
+ * in front of the payload and leaves bufferSize - 144 bytes for the datagram.
+ * Sends are copied into fixed slots of bufferSize bytes and submitted in
+ * batches on flush()/poll(), so larger datagrams are rejected; see
+ * getMaxDatagramSize(). A send the kernel fails after send() accepted it
+ * and a datagram cut at bufferSize are not delivered but counted, see
+ * getSendFailureCount() and getTruncatedCount().
+ * Talks to the kernel through raw syscalls, no liburing.
+ * The constructor throws std::system_error when io_uring or provided buffer
+ * rings (Linux 5.19+) are unavailable; IoEngine::create() then falls back to epoll.
+ */
+class IoUringEngine final : public IoEngine {
+public:
+    struct Options final {
+        /// Submission queue entries
+        unsigned ringEntries{256U};
+        /// Receive buffers in the provided ring (power of two)
+        unsigned bufferCount{1024U};
+        /// Size of each receive buffer (largest datagram accepted)
+        unsigned bufferSize{2048U};
+        /// In-flight send slots; each holds one datagram of bufferSize bytes
+        unsigned sendSlots{256U};
+    };
+
+    explicit IoUringEngine();
+    explicit IoUringEngine(const Options& options);
+    ~IoUringEngine() override;
+
+    std::size_t addReceiver(const EndpointConfig& config) override;
+    std::size_t addSender(const EndpointConfig& config) override;
+    bool send(std::size_t endpoint, const uint8_t* data, std::size_t size) override;
+    /// Copies the buffers into one send slot, so the caller's buffers may be reused at once
+    bool sendv(std::size_t endpoint, const iovec* vectors, std::size_t count) override;
+    void flush() override;
+    bool readTransmitTimestamp(std::size_t endpoint, TransmitTimestamp& timestamp) override;
+    std::size_t poll(int timeoutMs) override;
+
+    [[nodiscard]] const char* name() const noexcept override;
+
+    /// Options::bufferSize: the size of a send slot
+    [[nodiscard]] std::size_t getMaxDatagramSize() const noexcept override;
+
+    /// Sends whose completion reported an error; send() had already returned true for them
+    [[nodiscard]] uint64_t getSendFailureCount() const noexcept;
+    /// Datagrams dropped because they did not fit a receive buffer
+    [[nodiscard]] uint64_t getTruncatedCount() const noexcept;
+
+private:
+    void release() noexcept;
+    void setupRing();
+    void setupBufferRing();
+    io_uring_sqe* acquireSqe();
+    int enter(unsigned waitCount, int timeoutMs);
+    void armReceive(std::size_t endpoint);
+    /// Returns false when the datagram was dropped instead of handed to the handler
+    bool deliverMessage(std::size_t endpoint, uint8_t* buffer, std::size_t size);
+    std::size_t reapCompletions();
+    void recycleBuffer(uint16_t bufferId) noexcept;
+
+    Options options_;
+
+    int ringFd_{-1};
+    bool hasExtArg_{false};
+    void* sqRing_{nullptr};
+    std::size_t sqRingSize_{0U};
+    void* cqRing_{nullptr};
+    std::size_t cqRingSize_{0U};
+    io_uring_sqe* sqes_{nullptr};
+    std::size_t sqesSize_{0U};
+
+    unsigned* sqHead_{nullptr};
+    unsigned* sqTail_{nullptr};
+    unsigned* sqArray_{nullptr};
+    unsigned sqMask_{0U};
+    unsigned sqEntries_{0U};
+    unsigned sqLocalTail_{0U};
+    unsigned sqSubmitted_{0U};
+
+    unsigned* cqHead_{nullptr};
+    unsigned* cqTail_{nullptr};
+    unsigned cqMask_{0U};
+    io_uring_cqe* cqes_{nullptr};
+
+    io_uring_buf_ring* bufferRing_{nullptr};
+    std::size_t bufferRingSize_{0U};
+    uint16_t bufferTail_{0U};
+    std::vector<uint8_t> receiveSlab_;
+
+    std::vector<uint8_t> sendSlab_;
+    std::vector<uint32_t> freeSendSlots_;
+
+    std::vector<MulticastSocket> sockets_;
+    std::vector<bool> multishot_;
+    std::vector<bool> timestamped_;
+
+    RelaxedCounter sendFailures_;
+    RelaxedCounter truncated_;
+};
@@ -0,0 +1,29 @@
+#include "MessageEnvelope.hpp"
+
+#include <cstring>
+
+void MessageEnvelope::encode(uint8_t* out) const noexcept {
+    const uint16_t magic = MAGIC;
+    const uint16_t reserved = 0U;
+    std::memcpy(out, &magic, sizeof(magic));
+    out[2] = VERSION;
+    out[3] = flags;
+    std::memcpy(out + 4, &recordCount, sizeof(recordCount));
+    std::memcpy(out + 6, &reserved, sizeof(reserved));
+    std::memcpy(out + 8, &sequence, sizeof(sequence));
+}
+
+bool MessageEnvelope::decode(const uint8_t* data, std::size_t size, MessageEnvelope& envelope) noexcept {
+    if (size < SIZE) {
+        return false;
+    }
+    uint16_t magic = 0U;
+    std::memcpy(&magic, data, sizeof(magic));
+    if ((magic != MAGIC) || (data[2] != VERSION)) {
+        return false;
+    }
+    envelope.flags = data[3];
+    std::memcpy(&envelope.recordCount, data + 4, sizeof(envelope.recordCount));
+    std::memcpy(&envelope.sequence, data + 8, sizeof(envelope.sequence));
+    return true;
+}
@@ -0,0 +1,34 @@
+#pragma once
+
+// MISRA C++ 2023 compliant includes
+#include <cstddef>
+#include <cstdint>
+
+/**
+ * @brief Fixed 16-byte header at the start of every RADIO/DISH body.
+ * Wire layout (host byte order, like the generated model serialization):
+ * [magic:2][version:1][flags:1][recordCount:2][reserved:2][sequence:8]
+ * followed by recordCount serialized model records.
+ */
+struct MessageEnvelope final {
+    static constexpr uint16_t MAGIC = 0x5A44U;  // "DZ"
+    static constexpr uint8_t VERSION = 1U;
+    static constexpr std::size_t SIZE = 16U;
+    /// Body is FEC parity (FecHeader + symbol), not records; sequence is the window start
+    static constexpr uint8_t FLAG_PARITY = 0x01U;
+    /// Every record is followed by its 4-byte CRC32C (generated serializeWithChecksum())
+    static constexpr uint8_t FLAG_CHECKSUM = 0x02U;
+
+    /// Number of serialized records following the header
+    uint16_t recordCount{1U};
+    /// Per-group sequence number stamped by the publisher
+    uint64_t sequence{0U};
+    /// Reserved for feature bits (checksums, FEC, ...)
+    uint8_t flags{0U};
+
+    /// Writes SIZE bytes to out
+    void encode(uint8_t* out) const noexcept;
+
+    /// Reads the header; returns false for short buffers or unknown magic/version
+    [[nodiscard]] static bool decode(const uint8_t* data, std::size_t size, MessageEnvelope& envelope) noexcept;
+};
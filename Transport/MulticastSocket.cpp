@@ -0,0 +1,286 @@
+#include "MulticastSocket.hpp"
+
+#include <arpa/inet.h>
+#include <cerrno>
+#include <cstring>
+#include <fcntl.h>
+#include <linux/errqueue.h>
+#include <linux/net_tstamp.h>
+#include <linux/sockios.h>
+#include <net/if.h>
+#include <stdexcept>
+#include <netinet/in.h>
+#include <sys/ioctl.h>
+#include <sys/socket.h>
+#include <system_error>
+#include <unistd.h>
+
+namespace {
+
+[[noreturn]] void throwSystemError(const char* what) {
+    throw std::system_error(errno, std::generic_category(), what);
+}
+
+in_addr parseAddress(const std::string& address) {
+    in_addr result{};
+    if (inet_pton(AF_INET, address.c_str(), &result) != 1) {
+        throw std::invalid_argument("Invalid IPv4 address: " + address);
+    }
+    return result;
+}
+
+sockaddr_in makeGroupAddress(const EndpointConfig& config) {
+    sockaddr_in group{};
+    group.sin_family = AF_INET;
+    group.sin_port = htons(config.port);
+    group.sin_addr = parseAddress(config.multicastAddress);
+    return group;
+}
+
+int64_t toNanoseconds(const timespec& time) noexcept {
+    return static_cast<int64_t>(time.tv_sec) * 1000000000LL + static_cast<int64_t>(time.tv_nsec);
+}
+
+}  // namespace
+
+MulticastSocket MulticastSocket::openReceiver(const EndpointConfig& config) {
+    MulticastSocket socket(::socket(AF_INET, SOCK_DGRAM | SOCK_CLOEXEC, 0));
+    if (!socket.isOpen()) {
+        throwSystemError("socket");
+    }
+
+    const int enable = 1;
+    if (setsockopt(socket.fd_, SOL_SOCKET, SO_REUSEADDR, &enable, sizeof(enable)) != 0) {
+        throwSystemError("setsockopt(SO_REUSEADDR)");
+    }
+    if (config.receiveBufferBytes > 0) {
+        // Best effort: the kernel clamps the value to net.core.rmem_max
+        (void)setsockopt(socket.fd_, SOL_SOCKET, SO_RCVBUF,
+                         &config.receiveBufferBytes, sizeof(config.receiveBufferBytes));
+    }
+
+    if (config.busyPollMicros > 0) {
+        // Best effort: raising the value above net.core.busy_read needs CAP_NET_ADMIN
+        (void)setsockopt(socket.fd_, SOL_SOCKET, SO_BUSY_POLL,
+                         &config.busyPollMicros, sizeof(config.busyPollMicros));
+    }
+
+    // Binding to the group address filters out other groups sharing the port
+    const sockaddr_in group = makeGroupAddress(config);
+    if (bind(socket.fd_, reinterpret_cast<const sockaddr*>(&group), sizeof(group)) != 0) {
+        throwSystemError("bind");
+    }
+
+    if (config.timestamping != TimestampingMode::None) {
+        socket.enableTimestamping(config.timestamping, false);
+    }
+
+    ip_mreq membership{};
+    membership.imr_multiaddr = group.sin_addr;
+    membership.imr_interface = parseAddress(config.interfaceAddress);
+    if (setsockopt(socket.fd_, IPPROTO_IP, IP_ADD_MEMBERSHIP, &membership, sizeof(membership)) != 0) {
+        throwSystemError("setsockopt(IP_ADD_MEMBERSHIP)");
+    }
+    return socket;
+}
+
+MulticastSocket MulticastSocket::openSender(const EndpointConfig& config) {
+    MulticastSocket socket(::socket(AF_INET, SOCK_DGRAM | SOCK_CLOEXEC, 0));
+    if (!socket.isOpen()) {
+        throwSystemError("socket");
+    }
+
+    const in_addr interface = parseAddress(config.interfaceAddress);
+    if (interface.s_addr != htonl(INADDR_ANY)) {
+        if (setsockopt(socket.fd_, IPPROTO_IP, IP_MULTICAST_IF, &interface, sizeof(interface)) != 0) {
+            throwSystemError("setsockopt(IP_MULTICAST_IF)");
+        }
+    }
+
+    const unsigned char loop = config.multicastLoopback ? 1U : 0U;
+    if (setsockopt(socket.fd_, IPPROTO_IP, IP_MULTICAST_LOOP, &loop, sizeof(loop)) != 0) {
+        throwSystemError("setsockopt(IP_MULTICAST_LOOP)");
+    }
+    const unsigned char ttl = static_cast<unsigned char>(config.timeToLive);
+    if (setsockopt(socket.fd_, IPPROTO_IP, IP_MULTICAST_TTL, &ttl, sizeof(ttl)) != 0) {
+        throwSystemError("setsockopt(IP_MULTICAST_TTL)");
+    }
+
+    const sockaddr_in group = makeGroupAddress(config);
+    if (connect(socket.fd_, reinterpret_cast<const sockaddr*>(&group), sizeof(group)) != 0) {
+        throwSystemError("connect");
+    }
+
+    if (config.timestamping != TimestampingMode::None) {
+        socket.enableTimestamping(config.timestamping, true);
+    }
+    return socket;
+}
+
+MulticastSocket::MulticastSocket(int fd) noexcept : fd_(fd) {}
+
+MulticastSocket::MulticastSocket(MulticastSocket&& other) noexcept
+    : fd_(other.fd_), timestamping_(other.timestamping_) {
+    other.fd_ = -1;
+}
+
+MulticastSocket& MulticastSocket::operator=(MulticastSocket&& other) noexcept {
+    if (this != &other) {
+        close();
+        fd_ = other.fd_;
+        timestamping_ = other.timestamping_;
+        other.fd_ = -1;
+    }
+    return *this;
+}
+
+MulticastSocket::~MulticastSocket() {
+    close();
+}
+
+int MulticastSocket::fd() const noexcept {
+    return fd_;
+}
+
+bool MulticastSocket::isOpen() const noexcept {
+    return fd_ >= 0;
+}
+
+void MulticastSocket::setNonBlocking(bool enabled) {
+    const int flags = fcntl(fd_, F_GETFL, 0);
+    if (flags < 0) {
+        throwSystemError("fcntl(F_GETFL)");
+    }
+    const int updated = enabled ? (flags | O_NONBLOCK) : (flags & ~O_NONBLOCK);
+    if (fcntl(fd_, F_SETFL, updated) != 0) {
+        throwSystemError("fcntl(F_SETFL)");
+    }
+}
+
+ssize_t MulticastSocket::receive(uint8_t* buffer, std::size_t capacity) noexcept {
+    return ::recv(fd_, buffer, capacity, 0);
+}
+
+ssize_t MulticastSocket::receive(uint8_t* buffer, std::size_t capacity,
+                                 ReceiveTimestamps& timestamps) noexcept {
+    iovec payload{buffer, capacity};
+    alignas(cmsghdr) uint8_t control[TIMESTAMP_CONTROL_SIZE];
+    msghdr message{};
+    message.msg_iov = &payload;
+    message.msg_iovlen = 1U;
+    message.msg_control = control;
+    message.msg_controllen = sizeof(control);
+
+    const ssize_t received = ::recvmsg(fd_, &message, 0);
+    timestamps = ReceiveTimestamps{};
+    if (received >= 0) {
+        parseTimestamps(message, timestamps);
+    }
+    return received;
+}
+
+bool MulticastSocket::send(const uint8_t* data, std::size_t size) noexcept {
+    return ::send(fd_, data, size, 0) == static_cast<ssize_t>(size);
+}
+
+bool MulticastSocket::send(const iovec* vectors, std::size_t count) noexcept {
+    std::size_t size = 0U;
+    for (std::size_t i = 0U; i < count; ++i) {
+        size += vectors[i].iov_len;
+    }
+    msghdr message{};
+    message.msg_iov = const_cast<iovec*>(vectors);
+    message.msg_iovlen = count;
+    return ::sendmsg(fd_, &message, 0) == static_cast<ssize_t>(size);
+}
+
+void MulticastSocket::enableTimestamping(TimestampingMode mode, bool transmit) {
+    if (mode == TimestampingMode::None) {
+        return;
+    }
+    unsigned int flags = SOF_TIMESTAMPING_SOFTWARE;
+    if (transmit) {
+        // OPT_ID numbers the datagrams; OPT_TSONLY keeps the payload off the error queue
+        flags |= SOF_TIMESTAMPING_TX_SOFTWARE | SOF_TIMESTAMPING_OPT_ID | SOF_TIMESTAMPING_OPT_TSONLY;
+    } else {
+        flags |= SOF_TIMESTAMPING_RX_SOFTWARE;
+    }
+    if (mode == TimestampingMode::Hardware) {
+        // The NIC must also be switched on, see enableHardwareTimestamping()
+        flags |= SOF_TIMESTAMPING_RAW_HARDWARE;
+        flags |= transmit ? SOF_TIMESTAMPING_TX_HARDWARE : SOF_TIMESTAMPING_RX_HARDWARE;
+    }
+    if (setsockopt(fd_, SOL_SOCKET, SO_TIMESTAMPING, &flags, sizeof(flags)) != 0) {
+        throwSystemError("setsockopt(SO_TIMESTAMPING)");
+    }
+    timestamping_ = true;
+}
+
+bool MulticastSocket::isTimestamping() const noexcept {
+    return timestamping_;
+}
+
+bool MulticastSocket::readTransmitTimestamp(TransmitTimestamp& timestamp) noexcept {
+    alignas(cmsghdr) uint8_t control[TIMESTAMP_CONTROL_SIZE * 2U];
+    msghdr message{};
+    message.msg_control = control;
+    message.msg_controllen = sizeof(control);
+    if (::recvmsg(fd_, &message, MSG_ERRQUEUE | MSG_DONTWAIT) < 0) {
+        return false;
+    }
+
+    ReceiveTimestamps times;
+    parseTimestamps(message, times);
+    bool identified = false;
+    for (cmsghdr* header = CMSG_FIRSTHDR(&message); header != nullptr;
+         header = CMSG_NXTHDR(&message, header)) {
+        if (header->cmsg_level == SOL_IP && header->cmsg_type == IP_RECVERR) {
+            sock_extended_err error{};
+            std::memcpy(&error, CMSG_DATA(header), sizeof(error));
+            if (error.ee_errno == ENOMSG && error.ee_origin == SO_EE_ORIGIN_TIMESTAMPING) {
+                timestamp.id = error.ee_data;
+                identified = true;
+            }
+        }
+    }
+    timestamp.softwareNs = times.softwareNs;
+    timestamp.hardwareNs = times.hardwareNs;
+    return identified;
+}
+
+void MulticastSocket::parseTimestamps(const msghdr& message, ReceiveTimestamps& timestamps) noexcept {
+    for (cmsghdr* header = CMSG_FIRSTHDR(&message); header != nullptr;
+         header = CMSG_NXTHDR(const_cast<msghdr*>(&message), header)) {
+        if (header->cmsg_level == SOL_SOCKET && header->cmsg_type == SO_TIMESTAMPING) {
+            // ts[0] is the software stamp, ts[2] the raw hardware one; ts[1] is unused
+            timespec stamps[3];
+            std::memcpy(stamps, CMSG_DATA(header), sizeof(stamps));
+            timestamps.softwareNs = toNanoseconds(stamps[0]);
+            timestamps.hardwareNs = toNanoseconds(stamps[2]);
+        }
+    }
+}
+
+bool MulticastSocket::enableHardwareTimestamping(const std::string& interfaceName) noexcept {
+    const int fd = ::socket(AF_INET, SOCK_DGRAM | SOCK_CLOEXEC, 0);
+    if (fd < 0) {
+        return false;
+    }
+    hwtstamp_config settings{};
+    settings.tx_type = HWTSTAMP_TX_ON;
+    settings.rx_filter = HWTSTAMP_FILTER_ALL;
+
+    ifreq request{};
+    (void)std::strncpy(request.ifr_name, interfaceName.c_str(), IFNAMSIZ - 1);
+    request.ifr_data = reinterpret_cast<char*>(&settings);
+    const bool enabled = ioctl(fd, SIOCSHWTSTAMP, &request) == 0;
+    (void)::close(fd);
+    return enabled;
+}
+
+void MulticastSocket::close() noexcept {
+    if (fd_ >= 0) {
+        (void)::close(fd_);
+        fd_ = -1;
+    }
+}
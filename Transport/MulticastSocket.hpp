@@ -0,0 +1,82 @@
+#pragma once
+
+// MISRA C++ 2023 compliant includes
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <sys/types.h>
+#include <sys/uio.h>
+
+#include "EndpointConfig.hpp"
+#include "PacketTimestamps.hpp"
+
+struct msghdr;
+
+/**
+ * @brief RAII owner of a UDP multicast socket.
+ * Receivers bind to the group address and JOIN it; senders are connected to
+ * the group so that plain send()/IORING_OP_SEND can be used.
+ * Setup failures throw std::system_error.
+ */
+class MulticastSocket final {
+public:
+    static MulticastSocket openReceiver(const EndpointConfig& config);
+    static MulticastSocket openSender(const EndpointConfig& config);
+
+    explicit MulticastSocket() noexcept = default;
+
+    // Copy constructor
+    MulticastSocket(const MulticastSocket& other) = delete;
+
+    // Move constructor
+    MulticastSocket(MulticastSocket&& other) noexcept;
+
+    // Copy assignment operator
+    MulticastSocket& operator=(const MulticastSocket& other) = delete;
+
+    // Move assignment operator
+    MulticastSocket& operator=(MulticastSocket&& other) noexcept;
+
+    // Destructor
+    ~MulticastSocket();
+
+    [[nodiscard]] int fd() const noexcept;
+    [[nodiscard]] bool isOpen() const noexcept;
+
+    void setNonBlocking(bool enabled);
+
+    /// Receives one datagram; returns its size or -1 (errno set, EAGAIN when non-blocking and empty)
+    ssize_t receive(uint8_t* buffer, std::size_t capacity) noexcept;
+
+    /// Receives one datagram and its kernel timestamps (needs timestamping enabled)
+    ssize_t receive(uint8_t* buffer, std::size_t capacity, ReceiveTimestamps& timestamps) noexcept;
+
+    /// Sends one datagram to the connected group
+    bool send(const uint8_t* data, std::size_t size) noexcept;
+    /// One datagram gathered by sendmsg() from count buffers
+    bool send(const iovec* vectors, std::size_t count) noexcept;
+
+    /// Turns on SO_TIMESTAMPING (receive side for receivers, transmit side for senders)
+    void enableTimestamping(TimestampingMode mode, bool transmit);
+    [[nodiscard]] bool isTimestamping() const noexcept;
+
+    /// Pops one transmit timestamp from the error queue; false when none is pending
+    bool readTransmitTimestamp(TransmitTimestamp& timestamp) noexcept;
+
+    /// Extracts SCM_TIMESTAMPING from a received message's control data
+    static void parseTimestamps(const msghdr& message, ReceiveTimestamps& timestamps) noexcept;
+
+    /// Switches a NIC to hardware timestamping (SIOCSHWTSTAMP, needs CAP_NET_ADMIN)
+    static bool enableHardwareTimestamping(const std::string& interfaceName) noexcept;
+
+    /// Control buffer size needed for one SCM_TIMESTAMPING message
+    static constexpr std::size_t TIMESTAMP_CONTROL_SIZE = 128U;
+
+    void close() noexcept;
+
+private:
+    explicit MulticastSocket(int fd) noexcept;
+
+    int fd_{-1};
+    bool timestamping_{false};
+};
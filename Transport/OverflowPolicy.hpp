@@ -0,0 +1,38 @@
+#pragma once
+
+// MISRA C++ 2023 compliant includes
+#include <cstddef>
+#include <cstdint>
+
+/// What a bounded record queue does when it holds highWaterMark records
+enum class OverflowPolicy : uint8_t {
+    Block,            ///< producer waits (back-pressure); nothing is lost
+    DropNewest,       ///< the incoming record is discarded
+    DropOldest,       ///< the oldest queued record is discarded to make room
+    ConflatePerTrack  ///< a pending record of the same trackId is overwritten in place, else DropOldest
+};
+
+/**
+ * @brief Queue limit of one endpoint (ZMQ HWM equivalent), counted in records.
+ * The receive-side worker queues of TrackShardPool apply it, taken from the
+ * receiver's EndpointConfig or given directly; datagram sends are not queued
+ * in user space and are bounded by the engine instead.
+ */
+struct HighWaterMark final {
+    std::size_t records{4096U};
+    OverflowPolicy policy{OverflowPolicy::Block};
+};
+
+[[nodiscard]] inline const char* overflowPolicyName(OverflowPolicy policy) noexcept {
+    switch (policy) {
+        case OverflowPolicy::DropNewest:
+            return "drop_newest";
+        case OverflowPolicy::DropOldest:
+            return "drop_oldest";
+        case OverflowPolicy::ConflatePerTrack:
+            return "conflate_per_track";
+        case OverflowPolicy::Block:
+        default:
+            return "block";
+    }
+}
@@ -0,0 +1,32 @@
+#pragma once
+
+// MISRA C++ 2023 compliant includes
+#include <cstdint>
+
+/// SO_TIMESTAMPING sources requested on a socket
+enum class TimestampingMode : uint8_t {
+    None,
+    Software,  ///< kernel software timestamps (work on loopback)
+    Hardware   ///< NIC timestamps plus software ones as a fallback
+};
+
+/**
+ * @brief Kernel timestamps of one received datagram (0 = not available).
+ * softwareNs is CLOCK_REALTIME; hardwareNs is the NIC clock (PHC), which is
+ * only comparable to CLOCK_REALTIME when the PHC is disciplined (phc2sys).
+ */
+struct ReceiveTimestamps final {
+    int64_t softwareNs{0};
+    int64_t hardwareNs{0};
+};
+
+/**
+ * @brief Kernel timestamp of one transmitted datagram, read from the error queue.
+ * id counts datagrams sent on the socket from zero (SOF_TIMESTAMPING_OPT_ID);
+ * TrackPublisher::readTransmitTimestamp() translates it to the envelope sequence.
+ */
+struct TransmitTimestamp final {
+    uint32_t id{0U};
+    int64_t softwareNs{0};
+    int64_t hardwareNs{0};
+};
@@ -0,0 +1,38 @@
+#include "RadioDishFrame.hpp"
+
+#include <cstring>
+#include <stdexcept>
+
+void RadioDishFrame::encode(const std::string& group, const uint8_t* body, std::size_t bodySize,
+                            std::vector<uint8_t>& out) {
+    beginFrame(group, out);
+    out.insert(out.end(), body, body + bodySize);
+}
+
+void RadioDishFrame::beginFrame(const std::string& group, std::vector<uint8_t>& out) {
+    if (group.size() > MAX_GROUP_LENGTH) {
+        throw std::length_error("RADIO group name too long: " + group);
+    }
+    out.resize(1U + group.size());
+    out[0] = static_cast<uint8_t>(group.size());
+    std::memcpy(&out[1], group.data(), group.size());
+}
+
+bool RadioDishFrame::decode(const uint8_t* datagram, std::size_t size, RadioDishFrame& frame) noexcept {
+    if (size < 1U) {
+        return false;
+    }
+    const std::size_t length = datagram[0];
+    if (1U + length > size) {
+        return false;
+    }
+    frame.group = reinterpret_cast<const char*>(datagram + 1);
+    frame.groupLength = length;
+    frame.body = datagram + 1U + length;
+    frame.bodySize = size - 1U - length;
+    return true;
+}
+
+bool RadioDishFrame::isGroup(const std::string& name) const noexcept {
+    return (name.size() == groupLength) && (std::memcmp(name.data(), group, groupLength) == 0);
+}
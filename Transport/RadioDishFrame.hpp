@@ -0,0 +1,33 @@
+#pragma once
+
+// MISRA C++ 2023 compliant includes
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+/**
+ * @brief ZeroMQ RADIO/DISH UDP datagram framing.
+ * Wire layout (same as libzmq's udp engine): [group length:1][group][body].
+ */
+class RadioDishFrame final {
+public:
+    static constexpr std::size_t MAX_GROUP_LENGTH = 255U;
+
+    /// Appends a complete datagram for the given group and body to out (out is cleared first)
+    static void encode(const std::string& group, const uint8_t* body, std::size_t bodySize,
+                       std::vector<uint8_t>& out);
+
+    /// Clears out and writes only the group header; the caller appends the body
+    static void beginFrame(const std::string& group, std::vector<uint8_t>& out);
+
+    /// Splits a datagram into group and body views; returns false for malformed datagrams
+    [[nodiscard]] static bool decode(const uint8_t* datagram, std::size_t size, RadioDishFrame& frame) noexcept;
+
+    [[nodiscard]] bool isGroup(const std::string& group) const noexcept;
+
+    const char* group{nullptr};
+    std::size_t groupLength{0U};
+    const uint8_t* body{nullptr};
+    std::size_t bodySize{0U};
+};
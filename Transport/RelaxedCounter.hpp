@@ -0,0 +1,39 @@
+#pragma once
+
+// MISRA C++ 2023 compliant includes
+#include <atomic>
+#include <cstdint>
+
+/**
+ * @brief Monotonic counter written by exactly one thread and read by any.
+ * Uses a relaxed load/store pair instead of a locked read-modify-write, so
+ * an increment costs the same as a plain store on x86.
+ */
+class RelaxedCounter final {
+public:
+    explicit RelaxedCounter() noexcept = default;
+
+    // Copy constructor
+    RelaxedCounter(const RelaxedCounter& other) = delete;
+
+    // Copy assignment operator
+    RelaxedCounter& operator=(const RelaxedCounter& other) = delete;
+
+    // Destructor
+    ~RelaxedCounter() = default;
+
+    void add(uint64_t amount = 1U) noexcept {
+        value_.store(value_.load(std::memory_order_relaxed) + amount, std::memory_order_relaxed);
+    }
+
+    void set(uint64_t value) noexcept {
+        value_.store(value, std::memory_order_relaxed);
+    }
+
+    [[nodiscard]] uint64_t load() const noexcept {
+        return value_.load(std::memory_order_relaxed);
+    }
+
+private:
+    std::atomic<uint64_t> value_{0U};
+};
@@ -0,0 +1,91 @@
+#include "SequenceTracker.hpp"
+
+SequenceTracker::Result SequenceTracker::track(uint64_t sequence) noexcept {
+    if (!started_) {
+        // First envelope of this group
+        started_ = true;
+        last_ = sequence;
+        first_ = sequence;
+        seenMask_ = 1U;
+        counters_.received.add();
+        counters_.lastSequence.set(sequence);
+        return Result::InOrder;
+    }
+
+    if ((sequence < last_) && ((last_ - sequence) >= WINDOW)) {
+        return trackBehind(sequence);
+    }
+    behindCount_ = 0U;
+
+    if (sequence > last_) {
+        const uint64_t distance = sequence - last_;
+        seenMask_ = (distance >= WINDOW) ? 1U : ((seenMask_ << distance) | 1U);
+        last_ = sequence;
+        counters_.received.add();
+        counters_.lastSequence.set(sequence);
+        if (distance == 1U) {
+            return Result::InOrder;
+        }
+        counters_.gaps.add();
+        counters_.lost.add(distance - 1U);
+        return Result::Gap;
+    }
+
+    // Within the window here: anything further back was handled by trackBehind()
+    const uint64_t distance = last_ - sequence;
+    const uint64_t bit = uint64_t{1U} << distance;
+    if ((seenMask_ & bit) != 0U) {
+        counters_.duplicates.add();
+        return Result::Duplicate;
+    }
+    seenMask_ |= bit;
+    // Numbers below the first one seen since (re)start were never counted as lost
+    const uint64_t lost = counters_.lost.load();
+    if ((sequence >= first_) && (lost > 0U)) {
+        counters_.lost.set(lost - 1U);
+    }
+    counters_.received.add();
+    counters_.reordered.add();
+    return Result::Reordered;
+}
+
+SequenceTracker::Result SequenceTracker::trackBehind(uint64_t sequence) noexcept {
+    // Extend the run when the number follows its last one within the window, start a new run otherwise
+    if ((behindCount_ > 0U) && (sequence > behindLast_) && ((sequence - behindLast_) < WINDOW)) {
+        const uint64_t distance = sequence - behindLast_;
+        behindMask_ = (behindMask_ << distance) | 1U;
+        behindSkipped_ += distance - 1U;
+        behindLast_ = sequence;
+        ++behindCount_;
+    } else {
+        behindFirst_ = sequence;
+        behindLast_ = sequence;
+        behindMask_ = 1U;
+        behindSkipped_ = 0U;
+        behindCount_ = 1U;
+    }
+    counters_.received.add();
+
+    if ((sequence >= WINDOW) && (behindCount_ < RESTART_CONFIRMATIONS)) {
+        // Stale or replayed until confirmed: the window stays on the current stream
+        counters_.reordered.add();
+        return Result::Reordered;
+    }
+
+    // The publisher started over: continue from the run
+    last_ = behindLast_;
+    first_ = behindFirst_;
+    seenMask_ = behindMask_;
+    behindCount_ = 0U;
+    if (behindSkipped_ > 0U) {
+        counters_.gaps.add();
+        counters_.lost.add(behindSkipped_);
+    }
+    counters_.restarts.add();
+    counters_.lastSequence.set(sequence);
+    return Result::Restart;
+}
+
+const SequenceCounters& SequenceTracker::getCounters() const noexcept {
+    return counters_;
+}
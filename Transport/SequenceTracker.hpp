@@ -0,0 +1,80 @@
+#pragma once
+
+// MISRA C++ 2023 compliant includes
+#include <cstdint>
+
+#include "RelaxedCounter.hpp"
+
+/**
+ * @brief Lock-free counter block describing one group's sequence health.
+ * Written only by the receiving thread, readable from any thread.
+ */
+struct alignas(64) SequenceCounters final {
+    /// Envelopes accepted (in order, late or after a gap; duplicates excluded)
+    RelaxedCounter received;
+    /// Forward jumps in the sequence
+    RelaxedCounter gaps;
+    /// Envelopes currently considered lost (decremented when a late one arrives)
+    RelaxedCounter lost;
+    /// Envelopes that arrived after a higher sequence number
+    RelaxedCounter reordered;
+    /// Envelopes seen twice
+    RelaxedCounter duplicates;
+    /// Publisher restarts (sequence went back by WINDOW or more, confirmed)
+    RelaxedCounter restarts;
+    /// Highest sequence number seen
+    RelaxedCounter lastSequence;
+};
+
+/**
+ * @brief Classifies per-group sequence numbers into in-order, gap, reorder
+ * and duplicate events. Keeps a 64-entry bitmap of recently seen numbers
+ * below the highest one, so the per-message cost is a compare, a shift and
+ * a few relaxed stores. A number WINDOW or more below the highest one is
+ * a publisher restart only once confirmed: it is below WINDOW itself, or
+ * RESTART_CONFIRMATIONS ascending numbers in a row arrived that far back,
+ * so a restart that lost sequence 0 is still found. Until then such a
+ * number counts as reordered and leaves the window alone, so one stale or
+ * replayed datagram can't reset it.
+ */
+class SequenceTracker final {
+public:
+    enum class Result : uint8_t { InOrder, Gap, Reordered, Duplicate, Restart };
+
+    static constexpr uint64_t WINDOW = 64U;
+    /// Consecutive datagrams behind the window that confirm a restart not starting near 0
+    static constexpr uint32_t RESTART_CONFIRMATIONS = 4U;
+
+    explicit SequenceTracker() noexcept = default;
+
+    // Copy constructor
+    SequenceTracker(const SequenceTracker& other) = delete;
+
+    // Copy assignment operator
+    SequenceTracker& operator=(const SequenceTracker& other) = delete;
+
+    // Destructor
+    ~SequenceTracker() = default;
+
+    Result track(uint64_t sequence) noexcept;
+
+    [[nodiscard]] const SequenceCounters& getCounters() const noexcept;
+
+private:
+    Result trackBehind(uint64_t sequence) noexcept;
+
+    SequenceCounters counters_;
+    uint64_t last_{0U};
+    /// Bit i set: sequence (last_ - i) has been received
+    uint64_t seenMask_{0U};
+    /// First sequence seen since start or restart; lower ones were never counted as lost
+    uint64_t first_{0U};
+    bool started_{false};
+    /// Ascending run of datagrams behind the window, tracked like last_/seenMask_/first_ until confirmed
+    uint64_t behindLast_{0U};
+    uint64_t behindMask_{0U};
+    uint64_t behindFirst_{0U};
+    /// Numbers skipped inside the run, counted as lost once it is confirmed
+    uint64_t behindSkipped_{0U};
+    uint32_t behindCount_{0U};
+};
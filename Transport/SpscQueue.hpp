@@ -0,0 +1,107 @@
+#pragma once
+
+// MISRA C++ 2023 compliant includes
+#include <atomic>
+#include <cstddef>
+#include <memory>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+
+/**
+ * @brief Bounded lock-free single-producer single-consumer ring.
+ * Capacity is rounded up to a power of two. Producer and consumer indices
+ * live on separate cache lines and each side caches the other's index, so
+ * an uncontended push or pop touches no shared line most of the time.
+ */
+template <typename T>
+class SpscQueue final {
+public:
+    explicit SpscQueue(std::size_t capacity) : capacity_(roundUp(capacity)), mask_(capacity_ - 1U),
+                                               slots_(std::make_unique<T[]>(capacity_)) {}
+
+    // Copy constructor
+    SpscQueue(const SpscQueue& other) = delete;
+
+    // Copy assignment operator
+    SpscQueue& operator=(const SpscQueue& other) = delete;
+
+    // Destructor
+    ~SpscQueue() = default;
+
+    /// Producer side; returns false when full
+    template <typename U>
+    bool tryPush(U&& value) noexcept(std::is_nothrow_assignable<T&, U&&>::value) {
+        const std::size_t tail = tail_.load(std::memory_order_relaxed);
+        if ((tail - cachedHead_) >= capacity_) {
+            cachedHead_ = head_.load(std::memory_order_acquire);
+            if ((tail - cachedHead_) >= capacity_) {
+                return false;
+            }
+        }
+        slots_[tail & mask_] = std::forward<U>(value);
+        tail_.store(tail + 1U, std::memory_order_release);
+        return true;
+    }
+
+    /// Consumer side; returns nullptr when empty. The slot stays valid until pop()
+    T* front() noexcept {
+        const std::size_t head = head_.load(std::memory_order_relaxed);
+        if (head == cachedTail_) {
+            cachedTail_ = tail_.load(std::memory_order_acquire);
+            if (head == cachedTail_) {
+                return nullptr;
+            }
+        }
+        return &slots_[head & mask_];
+    }
+
+    /// Consumer side; releases the slot returned by front()
+    void pop() noexcept {
+        head_.store(head_.load(std::memory_order_relaxed) + 1U, std::memory_order_release);
+    }
+
+    /// Consumer side convenience: moves the front element out
+    bool tryPop(T& out) noexcept(std::is_nothrow_move_assignable<T>::value) {
+        T* const slot = front();
+        if (slot == nullptr) {
+            return false;
+        }
+        out = std::move(*slot);
+        pop();
+        return true;
+    }
+
+    /// Approximate when called concurrently with push/pop
+    [[nodiscard]] std::size_t size() const noexcept {
+        return tail_.load(std::memory_order_acquire) - head_.load(std::memory_order_acquire);
+    }
+
+    [[nodiscard]] std::size_t capacity() const noexcept {
+        return capacity_;
+    }
+
+private:
+    static constexpr std::size_t CACHE_LINE = 64U;
+
+    static std::size_t roundUp(std::size_t capacity) {
+        if (capacity == 0U) {
+            throw std::invalid_argument("SpscQueue capacity must be positive");
+        }
+        std::size_t rounded = 1U;
+        while (rounded < capacity) {
+            rounded <<= 1U;
+        }
+        return rounded;
+    }
+
+    const std::size_t capacity_;
+    const std::size_t mask_;
+    std::unique_ptr<T[]> slots_;
+
+    alignas(CACHE_LINE) std::atomic<std::size_t> head_{0U};
+    std::size_t cachedTail_{0U};
+
+    alignas(CACHE_LINE) std::atomic<std::size_t> tail_{0U};
+    std::size_t cachedHead_{0U};
+};
@@ -0,0 +1,31 @@
+#include "ThreadTuning.hpp"
+
+#include <pthread.h>
+#include <sched.h>
+
+ThreadTuning::Result ThreadTuning::apply() const noexcept {
+    Result result;
+    if (cpu >= 0) {
+        result.pinned = pinCurrentThread(cpu);
+    }
+    if (realtimePriority > 0) {
+        result.realtime = setRealtimePriority(realtimePriority);
+    }
+    return result;
+}
+
+bool ThreadTuning::pinCurrentThread(int cpu) noexcept {
+    if ((cpu < 0) || (cpu >= CPU_SETSIZE)) {
+        return false;
+    }
+    cpu_set_t set;
+    CPU_ZERO(&set);
+    CPU_SET(static_cast<unsigned>(cpu), &set);
+    return pthread_setaffinity_np(pthread_self(), sizeof(set), &set) == 0;
+}
+
+bool ThreadTuning::setRealtimePriority(int priority) noexcept {
+    sched_param param{};
+    param.sched_priority = priority;
+    return pthread_setschedparam(pthread_self(), SCHED_FIFO, &param) == 0;
+}
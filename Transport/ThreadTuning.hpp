@@ -0,0 +1,27 @@
+#pragma once
+
+// MISRA C++ 2023 compliant includes
+#include <cstdint>
+
+/**
+ * @brief Scheduler settings for latency critical threads.
+ * apply() acts on the calling thread and is best effort: settings the
+ * process is not permitted to use (SCHED_FIFO without CAP_SYS_NICE or
+ * RLIMIT_RTPRIO, CPUs outside the cpuset) are skipped and reported.
+ */
+struct ThreadTuning final {
+    /// CPU to pin the thread to (-1 = leave affinity unchanged)
+    int cpu{-1};
+    /// SCHED_FIFO priority 1..99 (0 = keep the default scheduler)
+    int realtimePriority{0};
+
+    struct Result final {
+        bool pinned{false};
+        bool realtime{false};
+    };
+
+    Result apply() const noexcept;
+
+    static bool pinCurrentThread(int cpu) noexcept;
+    static bool setRealtimePriority(int priority) noexcept;
+};
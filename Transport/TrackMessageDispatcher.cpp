@@ -0,0 +1,124 @@
+#include "TrackMessageDispatcher.hpp"
+
+#include <stdexcept>
+
+bool TrackMessageDispatcher::dispatch(const uint8_t* datagram, std::size_t size) {
+    RadioDishFrame frame;
+    MessageEnvelope envelope;
+    if (!RadioDishFrame::decode(datagram, size, frame) ||
+        !MessageEnvelope::decode(frame.body, frame.bodySize, envelope)) {
+        malformed_.add();
+        return false;
+    }
+
+    for (const std::unique_ptr<Route>& route : routes_) {
+        if (!frame.isGroup(route->group)) {
+            continue;
+        }
+        if ((envelope.flags & MessageEnvelope::FLAG_PARITY) == 0U) {
+            return deliver(*route, envelope, frame.body, frame.bodySize);
+        }
+        if (!route->fec) {
+            return false;
+        }
+        Route& target = *route;
+        const std::size_t rebuilt = route->fec->onParity(
+            frame.body, frame.bodySize, [this, &target](uint64_t, const uint8_t* body, std::size_t bodySize) {
+                MessageEnvelope recovered;
+                if (MessageEnvelope::decode(body, bodySize, recovered)) {
+                    (void)deliver(target, recovered, body, bodySize);
+                }
+            });
+        return rebuilt > 0U;
+    }
+
+    unrouted_.add();
+    return false;
+}
+
+bool TrackMessageDispatcher::deliver(Route& route, const MessageEnvelope& envelope, const uint8_t* body,
+                                     std::size_t size) {
+    if (route.sequence.track(envelope.sequence) == SequenceTracker::Result::Duplicate) {
+        return false;
+    }
+    if (route.fec) {
+        route.fec->onData(envelope.sequence, body, size);
+    }
+    const uint64_t checksumFailures = route.checksumFailures.load();
+    const std::size_t decoded = route.decode(body + MessageEnvelope::SIZE, size - MessageEnvelope::SIZE,
+                                             envelope.recordCount,
+                                             (envelope.flags & MessageEnvelope::FLAG_CHECKSUM) != 0U);
+    if (decoded == 0U) {
+        // A datagram lost to CRC mismatches is already counted under checksum_failures
+        if (route.checksumFailures.load() == checksumFailures) {
+            malformed_.add();
+        }
+        return false;
+    }
+    dispatched_.add();
+    return true;
+}
+
+void TrackMessageDispatcher::enableFec(const std::string& group, std::size_t historyPackets) {
+    for (const std::unique_ptr<Route>& route : routes_) {
+        if (route->group == group) {
+            route->fec = std::make_unique<FecDecoder>(historyPackets);
+            return;
+        }
+    }
+    throw std::invalid_argument("FEC needs a subscribed group: " + group);
+}
+
+bool TrackMessageDispatcher::dispatch(const uint8_t* datagram, std::size_t size,
+                                      const ReceiveTimestamps& timestamps) {
+    timestamps_ = timestamps;
+    const bool routed = dispatch(datagram, size);
+    timestamps_ = ReceiveTimestamps{};
+    return routed;
+}
+
+void TrackMessageDispatcher::registerMetrics(TransportMetrics& metrics, const std::string& prefix) const {
+    metrics.addCollector([this, prefix](std::vector<MetricSample>& samples) {
+        samples.push_back({prefix + ".dispatched", dispatched_.load()});
+        samples.push_back({prefix + ".malformed", malformed_.load()});
+        samples.push_back({prefix + ".unrouted", unrouted_.load()});
+        for (const std::unique_ptr<Route>& route : routes_) {
+            const std::string name = prefix + "." + route->group + ".sequence";
+            const SequenceCounters& counters = route->sequence.getCounters();
+            samples.push_back({name + ".received", counters.received.load()});
+            samples.push_back({name + ".gaps", counters.gaps.load()});
+            samples.push_back({name + ".lost", counters.lost.load()});
+            samples.push_back({name + ".reordered", counters.reordered.load()});
+            samples.push_back({name + ".duplicates", counters.duplicates.load()});
+            samples.push_back({name + ".restarts", counters.restarts.load()});
+            samples.push_back({name + ".last", counters.lastSequence.load()});
+            samples.push_back({prefix + "." + route->group + ".checksum_failures", route->checksumFailures.load()});
+            if (route->fec) {
+                const std::string fec = prefix + "." + route->group + ".fec";
+                samples.push_back({fec + ".parity", route->fec->getParityCount()});
+                samples.push_back({fec + ".recovered", route->fec->getRecoveredCount()});
+                samples.push_back({fec + ".unrecoverable", route->fec->getUnrecoverableCount()});
+            }
+        }
+    });
+}
+
+uint64_t TrackMessageDispatcher::getDispatchedCount() const noexcept {
+    return dispatched_.load();
+}
+
+uint64_t TrackMessageDispatcher::getMalformedCount() const noexcept {
+    return malformed_.load();
+}
+
+uint64_t TrackMessageDispatcher::getUnroutedCount() const noexcept {
+    return unrouted_.load();
+}
+
+uint64_t TrackMessageDispatcher::getChecksumFailureCount() const noexcept {
+    uint64_t total = 0U;
+    for (const std::unique_ptr<Route>& route : routes_) {
+        total += route->checksumFailures.load();
+    }
+    return total;
+}
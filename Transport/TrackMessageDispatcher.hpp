@@ -0,0 +1,170 @@
+#pragma once
+
+// MISRA C++ 2023 compliant includes
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <stdexcept>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "ForwardErrorCorrection.hpp"
+#include "MessageEnvelope.hpp"
+#include "PacketTimestamps.hpp"
+#include "RadioDishFrame.hpp"
+#include "RelaxedCounter.hpp"
+#include "SequenceTracker.hpp"
+#include "TrackMessageTraits.hpp"
+#include "TransportMetrics.hpp"
+
+/**
+ * @brief Decodes RADIO/DISH datagrams into generated model objects and hands
+ * them to the handlers subscribed for that message type.
+ * Every group keeps its own decode target and sequence tracker; records
+ * are deserialized straight out of the datagram, so dispatching does not
+ * copy or allocate.
+ * Groups with FEC enabled also keep recent datagram bodies so parity
+ * datagrams can rebuild lost ones, which are then dispatched like late
+ * arrivals; without FEC, parity datagrams are ignored.
+ * Must be driven by a single thread; counters may be read from any thread.
+ */
+class TrackMessageDispatcher final {
+public:
+    template <typename T>
+    void subscribe(std::function<void(const T&)> handler) {
+        subscribe<T>(std::move(handler), TrackMessageTraits<T>::GROUP);
+    }
+
+    /// Routes type T records arriving on an arbitrary group, e.g. one shard of a sharded type;
+    /// throws std::invalid_argument when the group already carries another type
+    template <typename T>
+    void subscribe(std::function<void(const T&)> handler, const std::string& group) {
+        TypedRoute<T>* route = nullptr;
+        for (const std::unique_ptr<Route>& existing : routes_) {
+            if (existing->group == group) {
+                if (existing->typeIndex != TrackMessageTraits<T>::INDEX) {
+                    throw std::invalid_argument("Group already subscribed with another message type: " + group);
+                }
+                route = static_cast<TypedRoute<T>*>(existing.get());
+            }
+        }
+        if (route == nullptr) {
+            std::unique_ptr<TypedRoute<T>> created = std::make_unique<TypedRoute<T>>(group);
+            route = created.get();
+            routes_.push_back(std::move(created));
+        }
+        route->handlers.push_back(std::move(handler));
+    }
+
+    /// Repairs losses of a subscribed type from FEC parity; throws std::invalid_argument when not subscribed
+    template <typename T>
+    void enableFec(std::size_t historyPackets = 1024U) {
+        enableFec(TrackMessageTraits<T>::GROUP, historyPackets);
+    }
+
+    void enableFec(const std::string& group, std::size_t historyPackets = 1024U);
+
+    /// FEC state of a group, nullptr when FEC is not enabled for it
+    [[nodiscard]] const FecDecoder* getFecDecoder(const std::string& group) const noexcept {
+        for (const std::unique_ptr<Route>& route : routes_) {
+            if (route->group == group) {
+                return route->fec.get();
+            }
+        }
+        return nullptr;
+    }
+
+    /// Returns true when at least one record of the datagram reached a handler
+    bool dispatch(const uint8_t* datagram, std::size_t size);
+
+    /// Same as dispatch(); handlers can read the kernel timestamps through getReceiveTimestamps()
+    bool dispatch(const uint8_t* datagram, std::size_t size, const ReceiveTimestamps& timestamps);
+
+    /// Kernel receive timestamps of the datagram being dispatched (zero when unknown)
+    [[nodiscard]] const ReceiveTimestamps& getReceiveTimestamps() const noexcept {
+        return timestamps_;
+    }
+
+    /// Sequence counters of a subscribed type, nullptr when not subscribed
+    template <typename T>
+    [[nodiscard]] const SequenceCounters* getSequenceCounters() const noexcept {
+        return getSequenceCounters(TrackMessageTraits<T>::GROUP);
+    }
+
+    /// Sequence counters of a subscribed group, nullptr when not subscribed
+    [[nodiscard]] const SequenceCounters* getSequenceCounters(const std::string& group) const noexcept {
+        for (const std::unique_ptr<Route>& route : routes_) {
+            if (route->group == group) {
+                return &route->sequence.getCounters();
+            }
+        }
+        return nullptr;
+    }
+
+    /// Exposes dispatcher and per-group sequence counters under prefix
+    void registerMetrics(TransportMetrics& metrics, const std::string& prefix = "dispatcher") const;
+
+    [[nodiscard]] uint64_t getDispatchedCount() const noexcept;
+    /// Datagrams that failed to decode, not counting those whose records only failed their checksum
+    [[nodiscard]] uint64_t getMalformedCount() const noexcept;
+    [[nodiscard]] uint64_t getUnroutedCount() const noexcept;
+    /// Records dropped because their CRC32C trailer did not match, over all groups
+    [[nodiscard]] uint64_t getChecksumFailureCount() const noexcept;
+
+private:
+    struct Route {
+        Route(const std::string& groupName, std::size_t type) : group(groupName), typeIndex(type) {}
+        virtual ~Route() = default;
+        /// Decodes recordCount consecutive records; returns the number handed to handlers
+        virtual std::size_t decode(const uint8_t* records, std::size_t size, std::size_t recordCount,
+                                   bool checksum) = 0;
+
+        std::string group;
+        /// TrackMessageTraits<T>::INDEX of the decoded type
+        std::size_t typeIndex;
+        SequenceTracker sequence;
+        RelaxedCounter checksumFailures;
+        std::unique_ptr<FecDecoder> fec;
+    };
+
+    template <typename T>
+    struct TypedRoute final : Route {
+        explicit TypedRoute(const std::string& groupName) : Route(groupName, TrackMessageTraits<T>::INDEX) {}
+
+        std::size_t decode(const uint8_t* records, std::size_t size, std::size_t recordCount,
+                           bool checksum) override {
+            const std::size_t recordSize = message.getSerializedSize() + (checksum ? T::CHECKSUM_SIZE : 0U);
+            std::size_t decoded = 0U;
+            for (std::size_t i = 0U; (i < recordCount) && (((i + 1U) * recordSize) <= size); ++i) {
+                const uint8_t* const record = records + (i * recordSize);
+                if (checksum) {
+                    if (!message.deserializeWithChecksum(record, recordSize)) {
+                        checksumFailures.add();
+                        continue;
+                    }
+                } else if (!message.deserialize(record, recordSize)) {
+                    continue;
+                }
+                for (const std::function<void(const T&)>& handler : handlers) {
+                    handler(message);
+                }
+                ++decoded;
+            }
+            return decoded;
+        }
+
+        std::vector<std::function<void(const T&)>> handlers;
+        T message;
+    };
+
+    /// Sequence check and record decode of one data body (envelope + records)
+    bool deliver(Route& route, const MessageEnvelope& envelope, const uint8_t* body, std::size_t size);
+
+    std::vector<std::unique_ptr<Route>> routes_;
+    ReceiveTimestamps timestamps_{};
+    RelaxedCounter dispatched_;
+    RelaxedCounter malformed_;
+    RelaxedCounter unrouted_;
+};
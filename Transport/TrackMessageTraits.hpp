@@ -0,0 +1,17 @@
+#pragma once
+
+// MISRA C++ 2023 compliant includes
+#include <cstddef>
+
+#include "ServiceRegistry.hpp"
+
+/// Number of generated message types
+constexpr std::size_t TRACK_MESSAGE_TYPE_COUNT = SERVICE_COUNT;
+
+/**
+ * @brief RADIO/DISH group name, dense index and endpoint of each generated message type.
+ * Taken from the generated ServiceRegistry, so adding a schema to
+ * zmq_messages and re-running the generator is enough to route it.
+ */
+template <typename T>
+using TrackMessageTraits = ServiceTraits<T>;
@@ -0,0 +1,400 @@
+#pragma once
+
+// MISRA C++ 2023 compliant includes
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <memory>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#include <sys/uio.h>
+
+#include "Crc32c.hpp"
+#include "EndpointConfig.hpp"
+#include "ForwardErrorCorrection.hpp"
+#include "IoEngine.hpp"
+#include "MessageEnvelope.hpp"
+#include "RadioDishFrame.hpp"
+#include "TrackMessageTraits.hpp"
+#include "TrackSharding.hpp"
+
+/**
+ * @brief Publishes generated model objects on their RADIO groups.
+ * Every message type owns one sender endpoint and one sequence counter;
+ * each datagram's envelope carries the next sequence number of its group,
+ * so subscribers can detect loss, reordering and duplication. A sharded
+ * type has one endpoint and sequence counter per shard instead.
+ * With checksums enabled, records carry a CRC32C trailer and the envelope
+ * has FLAG_CHECKSUM set. With FEC enabled, an unsharded type also sends parity datagrams on its
+ * group after every window of FecOptions::dataPackets datagrams.
+ * publishBatch() and publishSerialized() hand the frame header, envelope,
+ * record payloads and trailers to the engine as one gather list, so a batch
+ * is never copied into a contiguous datagram on the publishing side.
+ * Not thread-safe: use one publisher per sending thread.
+ */
+class TrackPublisher final {
+public:
+    explicit TrackPublisher(IoEngine& engine) noexcept : engine_(engine) {}
+
+    /// Opens the sender endpoint of message type T
+    template <typename T>
+    void advertise(const EndpointConfig& config) {
+        Channel& channel = channels_[TrackMessageTraits<T>::INDEX];
+        channel.endpoint = engine_.addSender(config);
+        channel.advertised = true;
+    }
+
+    template <typename T>
+    void advertise(const std::string& interfaceAddress = "0.0.0.0") {
+        advertise<T>(makeEndpointConfig<T>(interfaceAddress));
+    }
+
+    /// Publishes type T on a sender endpoint that is already open in the engine
+    template <typename T>
+    void attach(std::size_t endpoint) noexcept {
+        Channel& channel = channels_[TrackMessageTraits<T>::INDEX];
+        channel.endpoint = endpoint;
+        channel.advertised = true;
+    }
+
+    /// Splits type T across the shards of scheme, opening one sender per shard
+    template <typename T>
+    void advertiseSharded(const TrackShardScheme& scheme) {
+        std::vector<std::size_t> endpoints;
+        for (uint32_t shard = 0U; shard < scheme.getShardCount(); ++shard) {
+            endpoints.push_back(engine_.addSender(scheme.endpointOf(shard)));
+        }
+        attachSharded<T>(scheme, endpoints);
+    }
+
+    /// Same as advertiseSharded() with already open sender endpoints, one per shard
+    template <typename T>
+    void attachSharded(const TrackShardScheme& scheme, const std::vector<std::size_t>& endpoints) {
+        Channel& channel = channels_[TrackMessageTraits<T>::INDEX];
+        if (channel.fec) {
+            throw std::invalid_argument("FEC is not supported on sharded message types");
+        }
+        if (endpoints.size() != scheme.getShardCount()) {
+            throw std::invalid_argument("Sharded publishing needs one sender endpoint per shard");
+        }
+        channel.scheme = std::make_shared<const TrackShardScheme>(scheme);
+        channel.shards.clear();
+        for (const std::size_t endpoint : endpoints) {
+            channel.shards.push_back(Shard{endpoint, 0U});
+        }
+        channel.advertised = true;
+    }
+
+    /// Appends a CRC32C trailer to every record of type T
+    template <typename T>
+    void enableChecksum(bool enabled = true) noexcept {
+        channels_[TrackMessageTraits<T>::INDEX].checksum = enabled;
+    }
+
+    /// Protects the datagrams of unsharded type T with parity; throws std::invalid_argument for bad
+    /// options or a sharded type
+    template <typename T>
+    void enableFec(const FecOptions& options) {
+        Channel& channel = channels_[TrackMessageTraits<T>::INDEX];
+        if (channel.scheme) {
+            throw std::invalid_argument("FEC is not supported on sharded message types");
+        }
+        channel.fec = std::make_unique<FecEncoder>(options);
+    }
+
+    /// Sends parity for a partially filled window, e.g. before a pause in publishing
+    template <typename T>
+    bool flushFec() {
+        Channel& channel = channels_[TrackMessageTraits<T>::INDEX];
+        if (!channel.advertised || !channel.fec || !channel.fec->flush()) {
+            return false;
+        }
+        return sendParity(channel, groupOf<T>());
+    }
+
+    template <typename T>
+    [[nodiscard]] bool isAdvertised() const noexcept {
+        return channels_[TrackMessageTraits<T>::INDEX].advertised;
+    }
+
+    /// Sends one record; the group sequence advances even when the engine rejects the send
+    template <typename T>
+    bool publish(const T& message) {
+        Channel& channel = channels_[TrackMessageTraits<T>::INDEX];
+        if (!channel.advertised) {
+            return false;
+        }
+        if (channel.scheme) {
+            const uint32_t index = channel.scheme->shardOf(static_cast<uint64_t>(message.getTrackId()));
+            Shard& shard = channel.shards[index];
+            encode(message, channel.scheme->groupOf(index), shard.nextSequence, scratch_, channel.checksum);
+            ++shard.nextSequence;
+            return engine_.send(shard.endpoint, scratch_.data(), scratch_.size());
+        }
+        const uint64_t sequence = channel.nextSequence;
+        encode(message, groupOf<T>(), sequence, scratch_, channel.checksum);
+        ++channel.nextSequence;
+        const bool sent = engine_.send(channel.endpoint, scratch_.data(), scratch_.size());
+        if (sent) {
+            recordSent(channel, sequence);
+        }
+        if (channel.fec) {
+            // The body follows the [length][group] frame header
+            const std::size_t bodyOffset = 1U + scratch_[0];
+            if (channel.fec->add(sequence, &scratch_[bodyOffset], scratch_.size() - bodyOffset)) {
+                (void)sendParity(channel, groupOf<T>());
+            }
+        }
+        return sent;
+    }
+
+    /**
+     * @brief Sends count records of type T in as few datagrams as maxDatagramBytes allows.
+     * maxDatagramBytes is capped at the engine's getMaxDatagramSize(), so the
+     * same setting works on every engine. Records are serialized once into a
+     * reusable buffer and sent behind a separately built header with
+     * IoEngine::sendv(). Sharded types fall back to publish() per record.
+     * Returns false when any datagram failed.
+     */
+    template <typename T>
+    bool publishBatch(const T* messages, std::size_t count, std::size_t maxDatagramBytes = 1400U) {
+        Channel& channel = channels_[TrackMessageTraits<T>::INDEX];
+        if (!channel.advertised) {
+            return false;
+        }
+        if (channel.scheme) {
+            bool sent = true;
+            for (std::size_t i = 0U; i < count; ++i) {
+                sent = publish(messages[i]) && sent;
+            }
+            return sent;
+        }
+        if (count == 0U) {
+            return true;
+        }
+        const std::string& group = groupOf<T>();
+        const std::size_t recordSize = messages[0].getSerializedSize() + (channel.checksum ? T::CHECKSUM_SIZE : 0U);
+        const std::size_t headerSize = 1U + group.size() + MessageEnvelope::SIZE;
+        maxDatagramBytes = std::min(maxDatagramBytes, engine_.getMaxDatagramSize());
+        std::size_t perDatagram = (maxDatagramBytes > headerSize) ? ((maxDatagramBytes - headerSize) / recordSize) : 0U;
+        perDatagram = std::min<std::size_t>(std::max<std::size_t>(perDatagram, 1U), 0xFFFFU);
+
+        batch_.resize(count * recordSize);
+        for (std::size_t i = 0U; i < count; ++i) {
+            uint8_t* const slot = &batch_[i * recordSize];
+            (void)(channel.checksum ? messages[i].serializeWithChecksumInto(slot) : messages[i].serializeInto(slot));
+        }
+        bool sent = true;
+        for (std::size_t first = 0U; first < count; first += perDatagram) {
+            const std::size_t records = std::min(perDatagram, count - first);
+            const iovec payload{&batch_[first * recordSize], records * recordSize};
+            sent = sendGathered(channel, group, static_cast<uint16_t>(records), &payload, 1U) && sent;
+        }
+        return sent;
+    }
+
+    /**
+     * @brief Sends count already serialized records of unsharded type T as one datagram.
+     * Each record stays where the caller keeps it and becomes its own iovec;
+     * with checksums enabled, the trailers are computed into a side array and
+     * sent as separate iovecs too. Returns false for sharded types, for more
+     * than MAX_GATHER_RECORDS records or when the engine rejects the datagram.
+     */
+    template <typename T>
+    bool publishSerialized(const uint8_t* const* records, std::size_t count) {
+        Channel& channel = channels_[TrackMessageTraits<T>::INDEX];
+        if (!channel.advertised || channel.scheme || (count == 0U) || (count > MAX_GATHER_RECORDS)) {
+            return false;
+        }
+        const std::string& group = groupOf<T>();
+        static const std::size_t recordSize = T{}.getSerializedSize();
+        payload_.clear();
+        trailers_.resize(count);
+        for (std::size_t i = 0U; i < count; ++i) {
+            payload_.push_back(iovec{const_cast<uint8_t*>(records[i]), recordSize});
+            if (channel.checksum) {
+                const uint32_t crc = Crc32c::compute(records[i], recordSize);
+                std::memcpy(trailers_[i].data(), &crc, T::CHECKSUM_SIZE);
+                payload_.push_back(iovec{trailers_[i].data(), T::CHECKSUM_SIZE});
+            }
+        }
+        return sendGathered(channel, group, static_cast<uint16_t>(count), payload_.data(), payload_.size());
+    }
+
+    /// Records one publishSerialized() datagram may gather, keeping header + payloads + trailers under IOV_MAX
+    static constexpr std::size_t MAX_GATHER_RECORDS = 511U;
+
+    /// Builds a complete single-record datagram: frame header, envelope, record
+    template <typename T>
+    static void encode(const T& message, uint64_t sequence, std::vector<uint8_t>& out) {
+        encode(message, groupOf<T>(), sequence, out);
+    }
+
+    /// Same as encode() on an explicit group, e.g. a shard group, optionally with a CRC32C trailer
+    template <typename T>
+    static void encode(const T& message, const std::string& group, uint64_t sequence, std::vector<uint8_t>& out,
+                       bool checksum = false) {
+        RadioDishFrame::beginFrame(group, out);
+        MessageEnvelope envelope;
+        envelope.sequence = sequence;
+        envelope.flags = checksum ? MessageEnvelope::FLAG_CHECKSUM : 0U;
+        const std::size_t envelopeOffset = out.size();
+        out.resize(envelopeOffset + MessageEnvelope::SIZE);
+        envelope.encode(&out[envelopeOffset]);
+        const std::size_t recordOffset = out.size();
+        out.resize(recordOffset + message.getSerializedSize() + (checksum ? T::CHECKSUM_SIZE : 0U));
+        (void)(checksum ? message.serializeWithChecksumInto(&out[recordOffset]) : message.serializeInto(&out[recordOffset]));
+    }
+
+    /**
+     * @brief Pops one kernel transmit timestamp of a data datagram of unsharded type T.
+     * The kernel numbers every datagram sent on the endpoint, FEC parity
+     * included; the publisher maps that number back, sets the timestamp id
+     * to the envelope sequence and skips parity timestamps. This holds as
+     * long as this publisher is the only writer of the endpoint and the
+     * timestamp is read within TRANSMIT_HISTORY datagrams of the send.
+     */
+    template <typename T>
+    bool readTransmitTimestamp(TransmitTimestamp& timestamp) {
+        const Channel& channel = channels_[TrackMessageTraits<T>::INDEX];
+        if (!channel.advertised || channel.scheme) {
+            return false;
+        }
+        while (engine_.readTransmitTimestamp(channel.endpoint, timestamp)) {
+            // Ids count sends from zero in 32 bits; age 1 is the latest datagram
+            const uint32_t age = static_cast<uint32_t>(channel.sentCount) - timestamp.id;
+            if ((age == 0U) || (age > TRANSMIT_HISTORY)) {
+                continue;
+            }
+            const uint64_t sequence = channel.sent[(channel.sentCount - age) % TRANSMIT_HISTORY];
+            if (sequence != PARITY_SENT) {
+                timestamp.id = static_cast<uint32_t>(sequence);
+                return true;
+            }
+        }
+        return false;
+    }
+
+    /// Same as readTransmitTimestamp() on one shard of sharded type T; ids follow that shard's sequence
+    template <typename T>
+    bool readTransmitTimestamp(uint32_t shard, TransmitTimestamp& timestamp) {
+        const Channel& channel = channels_[TrackMessageTraits<T>::INDEX];
+        return channel.advertised && channel.scheme && (shard < channel.shards.size()) &&
+               engine_.readTransmitTimestamp(channel.shards[shard].endpoint, timestamp);
+    }
+
+    /// Sequence of the next datagram of unsharded type T; throws std::invalid_argument for a sharded type
+    template <typename T>
+    [[nodiscard]] uint64_t getNextSequence() const {
+        const Channel& channel = channels_[TrackMessageTraits<T>::INDEX];
+        if (channel.scheme) {
+            throw std::invalid_argument("Sharded message types have one sequence per shard");
+        }
+        return channel.nextSequence;
+    }
+
+    /// Sequence of the next datagram on one shard of sharded type T; throws std::invalid_argument otherwise
+    template <typename T>
+    [[nodiscard]] uint64_t getNextSequence(uint32_t shard) const {
+        const Channel& channel = channels_[TrackMessageTraits<T>::INDEX];
+        if (!channel.scheme || (shard >= channel.shards.size())) {
+            throw std::invalid_argument("No such shard of the message type");
+        }
+        return channel.shards[shard].nextSequence;
+    }
+
+private:
+    struct Shard {
+        std::size_t endpoint{0U};
+        uint64_t nextSequence{0U};
+    };
+
+    struct Channel {
+        std::size_t endpoint{0U};
+        uint64_t nextSequence{0U};
+        bool advertised{false};
+        bool checksum{false};
+        std::shared_ptr<const TrackShardScheme> scheme;
+        std::vector<Shard> shards;
+        std::unique_ptr<FecEncoder> fec;
+        /// Envelope sequence of the last TRANSMIT_HISTORY datagrams sent, indexed by send count
+        std::vector<uint64_t> sent;
+        /// Datagrams the engine accepted on the endpoint, parity included
+        uint64_t sentCount{0U};
+    };
+
+    /// Datagrams readTransmitTimestamp() can map back to their sequence
+    static constexpr uint64_t TRANSMIT_HISTORY = 4096U;
+    static constexpr uint64_t PARITY_SENT = UINT64_MAX;
+
+    /// RADIO group of type T, built once so the per-message paths don't allocate it
+    template <typename T>
+    static const std::string& groupOf() {
+        static const std::string group{TrackMessageTraits<T>::GROUP};
+        return group;
+    }
+
+    bool sendParity(Channel& channel, const std::string& group) {
+        bool sent = true;
+        for (const std::vector<uint8_t>& parity : channel.fec->getParityBodies()) {
+            RadioDishFrame::encode(group, parity.data(), parity.size(), scratch_);
+            if (engine_.send(channel.endpoint, scratch_.data(), scratch_.size())) {
+                recordSent(channel, PARITY_SENT);
+            } else {
+                sent = false;
+            }
+        }
+        return sent;
+    }
+
+    /// Remembers the envelope sequence (or PARITY_SENT) of the endpoint's next kernel timestamp id
+    static void recordSent(Channel& channel, uint64_t sequence) {
+        if (channel.sent.empty()) {
+            channel.sent.resize(TRANSMIT_HISTORY);
+        }
+        channel.sent[channel.sentCount % TRANSMIT_HISTORY] = sequence;
+        ++channel.sentCount;
+    }
+
+    /// Prepends frame header and envelope to payload and sends the gather list as one datagram
+    bool sendGathered(Channel& channel, const std::string& group, uint16_t recordCount, const iovec* payload,
+                      std::size_t payloadCount) {
+        RadioDishFrame::beginFrame(group, header_);
+        const std::size_t bodyOffset = header_.size();
+        MessageEnvelope envelope;
+        envelope.recordCount = recordCount;
+        envelope.sequence = channel.nextSequence;
+        envelope.flags = channel.checksum ? MessageEnvelope::FLAG_CHECKSUM : 0U;
+        header_.resize(bodyOffset + MessageEnvelope::SIZE);
+        envelope.encode(&header_[bodyOffset]);
+        ++channel.nextSequence;
+
+        vectors_.assign(1U, iovec{header_.data(), header_.size()});
+        vectors_.insert(vectors_.end(), payload, payload + payloadCount);
+        const bool sent = engine_.sendv(channel.endpoint, vectors_.data(), vectors_.size());
+        if (sent) {
+            recordSent(channel, envelope.sequence);
+        }
+        if (channel.fec) {
+            // Parity covers the body only: drop the frame header from the first vector
+            vectors_[0] = iovec{&header_[bodyOffset], MessageEnvelope::SIZE};
+            if (channel.fec->add(envelope.sequence, vectors_.data(), vectors_.size())) {
+                (void)sendParity(channel, group);
+            }
+        }
+        return sent;
+    }
+
+    IoEngine& engine_;
+    std::array<Channel, TRACK_MESSAGE_TYPE_COUNT> channels_{};
+    std::vector<uint8_t> scratch_;
+    std::vector<uint8_t> header_;
+    std::vector<uint8_t> batch_;
+    std::vector<iovec> payload_;
+    std::vector<iovec> vectors_;
+    std::vector<std::array<uint8_t, 4>> trailers_;
+};
@@ -0,0 +1,322 @@
+#pragma once
+
+// MISRA C++ 2023 compliant includes
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <functional>
+#include <memory>
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+#include "BoundedRecordQueue.hpp"
+#include "EndpointConfig.hpp"
+#include "MessageEnvelope.hpp"
+#include "OverflowPolicy.hpp"
+#include "RadioDishFrame.hpp"
+#include "RelaxedCounter.hpp"
+#include "SequenceTracker.hpp"
+#include "SpscQueue.hpp"
+#include "TrackMessageTraits.hpp"
+#include "TransportMetrics.hpp"
+
+/**
+ * @brief Receive front-end that spreads one message type over N workers by trackId.
+ * The receive thread only parses the frame and envelope and peeks the
+ * trackId at the start of every serialized record (trackId is the first
+ * field of every schema); records are copied raw into the owning worker's
+ * SPSC queue and decoded there. A track always maps to the same worker,
+ * so per-track order is preserved and each worker owns its per-track State
+ * without locking.
+ * With the default Block policy a full queue back-pressures the receive
+ * thread; any other HighWaterMark policy swaps the lock-free queue for a
+ * BoundedRecordQueue that sheds records and counts them per policy.
+ */
+template <typename T, typename State>
+class TrackShardPool final {
+public:
+    using Handler = std::function<void(const T& message, State& state)>;
+
+    /// Largest serialized record carried through the queues
+    static constexpr std::size_t MAX_RECORD_SIZE = 128U;
+
+    explicit TrackShardPool(std::size_t workerCount, Handler handler, std::size_t queueCapacity = 4096U)
+        : TrackShardPool(workerCount, std::move(handler), HighWaterMark{queueCapacity, OverflowPolicy::Block}) {}
+
+    /// Applies the high-water mark configured on the receiver endpoint that feeds the pool
+    explicit TrackShardPool(std::size_t workerCount, Handler handler, const EndpointConfig& endpoint)
+        : TrackShardPool(workerCount, std::move(handler), endpoint.highWaterMark) {}
+
+    explicit TrackShardPool(std::size_t workerCount, Handler handler, const HighWaterMark& highWaterMark)
+        : handler_(std::move(handler)), highWaterMark_(highWaterMark) {
+        if (workerCount == 0U) {
+            throw std::invalid_argument("TrackShardPool needs at least one worker");
+        }
+        if (highWaterMark_.records == 0U) {
+            throw std::invalid_argument("TrackShardPool high-water mark must be positive");
+        }
+        if ((T{}.getSerializedSize() + T::CHECKSUM_SIZE) > MAX_RECORD_SIZE) {
+            throw std::invalid_argument("Record type too large for TrackShardPool");
+        }
+        for (std::size_t i = 0U; i < workerCount; ++i) {
+            workers_.push_back(std::make_unique<Worker>(highWaterMark_));
+        }
+    }
+
+    // Copy constructor
+    TrackShardPool(const TrackShardPool& other) = delete;
+
+    // Copy assignment operator
+    TrackShardPool& operator=(const TrackShardPool& other) = delete;
+
+    // Destructor
+    ~TrackShardPool() {
+        stop();
+    }
+
+    void start() {
+        if (running_.exchange(true)) {
+            return;
+        }
+        for (const std::unique_ptr<Worker>& worker : workers_) {
+            Worker* const target = worker.get();
+            worker->thread = std::thread([this, target]() { runWorker(*target); });
+        }
+    }
+
+    /// Lets the workers drain their queues, then joins them
+    void stop() {
+        running_.store(false, std::memory_order_release);
+        for (const std::unique_ptr<Worker>& worker : workers_) {
+            if (worker->thread.joinable()) {
+                worker->thread.join();
+            }
+        }
+    }
+
+    /// Receive-thread entry point for RADIO/DISH datagrams of group T
+    bool dispatch(const uint8_t* datagram, std::size_t size) {
+        RadioDishFrame frame;
+        MessageEnvelope envelope;
+        if (!RadioDishFrame::decode(datagram, size, frame) || !frame.isGroup(group_) ||
+            !MessageEnvelope::decode(frame.body, frame.bodySize, envelope)) {
+            rejected_.add();
+            return false;
+        }
+        if ((envelope.flags & MessageEnvelope::FLAG_PARITY) != 0U) {
+            // FEC parity is only repaired by TrackMessageDispatcher; its sequence is not a data sequence
+            return false;
+        }
+        if (sequence_.track(envelope.sequence) == SequenceTracker::Result::Duplicate) {
+            return false;
+        }
+        const bool checksum = (envelope.flags & MessageEnvelope::FLAG_CHECKSUM) != 0U;
+        const std::size_t recordSize = recordSize_ + (checksum ? T::CHECKSUM_SIZE : 0U);
+        const uint8_t* record = frame.body + MessageEnvelope::SIZE;
+        const std::size_t available = frame.bodySize - MessageEnvelope::SIZE;
+        for (std::size_t i = 0U; (i < envelope.recordCount) && (((i + 1U) * recordSize) <= available); ++i) {
+            submitRecord(record + (i * recordSize), recordSize);
+        }
+        return true;
+    }
+
+    /// Receive-thread entry point for one serialized record, with or without CRC32C trailer; applies the high-water mark policy when the target queue is full
+    /// Records shorter than a trackId or longer than MAX_RECORD_SIZE are rejected and counted
+    void submitRecord(const uint8_t* record, std::size_t size) {
+        if ((size < sizeof(TrackIdType)) || (size > MAX_RECORD_SIZE)) {
+            rejected_.add();
+            return;
+        }
+        TrackIdType trackId{};
+        std::memcpy(&trackId, record, sizeof(trackId));
+        Worker& worker = *workers_[shardOf(static_cast<uint64_t>(trackId), workers_.size())];
+
+        if (worker.bounded) {
+            (void)worker.bounded->push(static_cast<uint64_t>(trackId), record, size);
+            return;
+        }
+        RawRecord raw;
+        std::memcpy(raw.bytes.data(), record, size);
+        raw.size = static_cast<uint8_t>(size);
+        while (!worker.queue.tryPush(raw)) {
+            // Back-pressure instead of dropping keeps per-track order intact
+            backpressure_.add();
+            std::this_thread::yield();
+        }
+    }
+
+    /// Fibonacci hashing keeps consecutive track ids spread across workers
+    [[nodiscard]] static std::size_t shardOf(uint64_t trackId, std::size_t workerCount) noexcept {
+        return static_cast<std::size_t>((trackId * 0x9E3779B97F4A7C15ULL) >> 32U) % workerCount;
+    }
+
+    [[nodiscard]] std::size_t getWorkerCount() const noexcept {
+        return workers_.size();
+    }
+
+    [[nodiscard]] uint64_t getProcessedCount() const noexcept {
+        uint64_t total = 0U;
+        for (const std::unique_ptr<Worker>& worker : workers_) {
+            total += worker->processed.load();
+        }
+        return total;
+    }
+
+    [[nodiscard]] const SequenceCounters& getSequenceCounters() const noexcept {
+        return sequence_.getCounters();
+    }
+
+    [[nodiscard]] uint64_t getChecksumFailureCount() const noexcept {
+        uint64_t total = 0U;
+        for (const std::unique_ptr<Worker>& worker : workers_) {
+            total += worker->checksumFailures.load();
+        }
+        return total;
+    }
+
+    [[nodiscard]] const HighWaterMark& getHighWaterMark() const noexcept {
+        return highWaterMark_;
+    }
+
+    /// Datagrams that failed to decode and records of invalid size
+    [[nodiscard]] uint64_t getRejectedCount() const noexcept {
+        return rejected_.load();
+    }
+
+    [[nodiscard]] uint64_t getBackpressureCount() const noexcept {
+        return backpressure_.load();
+    }
+
+    [[nodiscard]] uint64_t getDroppedNewest() const noexcept {
+        return sumBounded(&BoundedRecordQueue::getDroppedNewest);
+    }
+
+    [[nodiscard]] uint64_t getDroppedOldest() const noexcept {
+        return sumBounded(&BoundedRecordQueue::getDroppedOldest);
+    }
+
+    [[nodiscard]] uint64_t getConflatedCount() const noexcept {
+        return sumBounded(&BoundedRecordQueue::getConflated);
+    }
+
+    void registerMetrics(TransportMetrics& metrics, const std::string& prefix) const {
+        metrics.addCollector([this, prefix](std::vector<MetricSample>& samples) {
+            samples.push_back({prefix + ".rejected", rejected_.load()});
+            samples.push_back({prefix + ".backpressure", backpressure_.load()});
+            samples.push_back({prefix + ".dropped_newest", getDroppedNewest()});
+            samples.push_back({prefix + ".dropped_oldest", getDroppedOldest()});
+            samples.push_back({prefix + ".conflated", getConflatedCount()});
+            samples.push_back({prefix + ".checksum_failures", getChecksumFailureCount()});
+            samples.push_back({prefix + ".sequence.gaps", sequence_.getCounters().gaps.load()});
+            samples.push_back({prefix + ".sequence.lost", sequence_.getCounters().lost.load()});
+            for (std::size_t i = 0U; i < workers_.size(); ++i) {
+                samples.push_back({prefix + ".worker" + std::to_string(i) + ".processed",
+                                   workers_[i]->processed.load()});
+            }
+        });
+    }
+
+private:
+    using TrackIdType = decltype(std::declval<const T&>().getTrackId());
+
+    struct RawRecord {
+        std::array<uint8_t, MAX_RECORD_SIZE> bytes;
+        uint8_t size{0U};
+    };
+
+    struct Worker {
+        explicit Worker(const HighWaterMark& limit)
+            : queue((limit.policy == OverflowPolicy::Block) ? limit.records : 1U),
+              bounded((limit.policy == OverflowPolicy::Block) ? nullptr : std::make_unique<BoundedRecordQueue>(limit)) {}
+
+        SpscQueue<RawRecord> queue;
+        std::unique_ptr<BoundedRecordQueue> bounded;
+        BoundedRecordQueue::Record pending;
+        std::thread thread;
+        std::unordered_map<uint64_t, State> states;
+        RelaxedCounter processed;
+        RelaxedCounter checksumFailures;
+        T message;
+    };
+
+    uint64_t sumBounded(uint64_t (BoundedRecordQueue::*counter)() const noexcept) const noexcept {
+        uint64_t total = 0U;
+        for (const std::unique_ptr<Worker>& worker : workers_) {
+            if (worker->bounded) {
+                total += ((*worker->bounded).*counter)();
+            }
+        }
+        return total;
+    }
+
+    /// Decodes and handles the next record of either queue kind; false when the queue is empty
+    bool processNext(Worker& worker) {
+        if (worker.bounded) {
+            if (!worker.bounded->pop(worker.pending)) {
+                return false;
+            }
+            process(worker, worker.pending.bytes.data(), worker.pending.size);
+            return true;
+        }
+        RawRecord* const raw = worker.queue.front();
+        if (raw == nullptr) {
+            return false;
+        }
+        // Decoded in place; the slot is released only afterwards
+        process(worker, raw->bytes.data(), raw->size);
+        worker.queue.pop();
+        return true;
+    }
+
+    void process(Worker& worker, const uint8_t* record, std::size_t size) {
+        bool decoded = false;
+        if (size == (recordSize_ + T::CHECKSUM_SIZE)) {
+            decoded = worker.message.deserializeWithChecksum(record, size);
+            if (!decoded) {
+                worker.checksumFailures.add();
+            }
+        } else {
+            decoded = worker.message.deserialize(record, size);
+        }
+        if (decoded) {
+            const uint64_t trackId = static_cast<uint64_t>(worker.message.getTrackId());
+            handler_(worker.message, worker.states[trackId]);
+            worker.processed.add();
+        }
+    }
+
+    void runWorker(Worker& worker) {
+        unsigned idleSpins = 0U;
+        while (true) {
+            if (!processNext(worker)) {
+                if (running_.load(std::memory_order_acquire)) {
+                    if (++idleSpins > 64U) {
+                        std::this_thread::yield();
+                    }
+                    continue;
+                }
+                // Re-check after observing stop so records pushed before it are drained
+                if (!processNext(worker)) {
+                    break;
+                }
+            }
+            idleSpins = 0U;
+        }
+    }
+
+    Handler handler_;
+    const HighWaterMark highWaterMark_;
+    std::vector<std::unique_ptr<Worker>> workers_;
+    std::atomic<bool> running_{false};
+    const std::string group_{TrackMessageTraits<T>::GROUP};
+    const std::size_t recordSize_{T{}.getSerializedSize()};
+    SequenceTracker sequence_;
+    RelaxedCounter rejected_;
+    RelaxedCounter backpressure_;
+};
@@ -0,0 +1,70 @@
+#include "TrackSharding.hpp"
+
+#include <arpa/inet.h>
+#include <stdexcept>
+
+TrackShardScheme::TrackShardScheme(const ServiceDescriptor& service, const ShardingOptions& options,
+                                   const std::string& interfaceAddress)
+    : service_(service), options_(options) {
+    if (options_.shardCount == 0U) {
+        throw std::invalid_argument("TrackShardScheme shardCount must be positive");
+    }
+    if ((options_.mode == ShardingMode::Range) && (options_.rangeWidth == 0U)) {
+        throw std::invalid_argument("TrackShardScheme rangeWidth must be positive in range mode");
+    }
+
+    in_addr base{};
+    if (!options_.addressBase.empty() && (inet_pton(AF_INET, options_.addressBase.c_str(), &base) != 1)) {
+        throw std::invalid_argument("Invalid shard address base: " + options_.addressBase);
+    }
+    const uint32_t first = ntohl(base.s_addr);
+    const uint32_t last = first + options_.shardCount - 1U;
+    if (!options_.addressBase.empty() && (((first >> 28U) != 0xEU) || ((last >> 28U) != 0xEU) || (last < first))) {
+        throw std::invalid_argument("Shard addresses leave the multicast range: " + options_.addressBase);
+    }
+
+    groups_.reserve(options_.shardCount);
+    endpoints_.reserve(options_.shardCount);
+    for (uint32_t shard = 0U; shard < options_.shardCount; ++shard) {
+        groups_.push_back(std::string(service_.group) + "." + std::to_string(shard));
+        EndpointConfig config = makeEndpointConfig(service_, interfaceAddress);
+        if (!options_.addressBase.empty()) {
+            in_addr address{};
+            address.s_addr = htonl(first + shard);
+            char text[INET_ADDRSTRLEN] = {};
+            (void)inet_ntop(AF_INET, &address, text, sizeof(text));
+            config.multicastAddress = text;
+        }
+        endpoints_.push_back(config);
+    }
+}
+
+uint32_t TrackShardScheme::getShardCount() const noexcept {
+    return options_.shardCount;
+}
+
+const ServiceDescriptor& TrackShardScheme::getService() const noexcept {
+    return service_;
+}
+
+const std::string& TrackShardScheme::groupOf(uint32_t shard) const {
+    return groups_.at(shard);
+}
+
+const EndpointConfig& TrackShardScheme::endpointOf(uint32_t shard) const {
+    return endpoints_.at(shard);
+}
+
+std::vector<uint32_t> TrackShardScheme::shardsForRange(uint64_t firstTrackId, uint64_t lastTrackId) const {
+    std::vector<uint32_t> shards;
+    if (options_.mode == ShardingMode::Hash) {
+        for (uint32_t shard = 0U; shard < options_.shardCount; ++shard) {
+            shards.push_back(shard);
+        }
+        return shards;
+    }
+    for (uint32_t shard = shardOf(firstTrackId); shard <= shardOf(lastTrackId); ++shard) {
+        shards.push_back(shard);
+    }
+    return shards;
+}
@@ -0,0 +1,61 @@
+#pragma once
+
+// MISRA C++ 2023 compliant includes
+#include <cstdint>
+#include <string>
+#include <vector>
+
+#include "EndpointConfig.hpp"
+#include "ServiceRegistry.hpp"
+
+/// How trackIds are assigned to shards
+enum class ShardingMode : uint8_t {
+    Hash,  ///< Fibonacci hash of the trackId, spreads any id distribution evenly
+    Range  ///< consecutive blocks of rangeWidth trackIds, lets consumers pick id ranges
+};
+
+struct ShardingOptions final {
+    ShardingMode mode{ShardingMode::Hash};
+    uint32_t shardCount{4U};
+    /// Range mode: trackIds per shard; ids beyond the last block go to the last shard
+    uint64_t rangeWidth{2500U};
+    /// First multicast address of the shards (shard k uses base + k); empty keeps the service address
+    std::string addressBase;
+};
+
+/**
+ * @brief Splits one message type into shards, each a RADIO group of its own
+ * named "<group>.<shard>", so sequence tracking stays per shard.
+ * With addressBase set, every shard also gets its own multicast address.
+ * A subscriber that JOINs only some shards then never receives the rest,
+ * because IGMP and the socket filter them out. Without addressBase, all
+ * shards share one socket and the dispatcher drops unsubscribed groups
+ * after they were received.
+ */
+class TrackShardScheme final {
+public:
+    explicit TrackShardScheme(const ServiceDescriptor& service, const ShardingOptions& options,
+                              const std::string& interfaceAddress = "0.0.0.0");
+
+    [[nodiscard]] uint32_t shardOf(uint64_t trackId) const noexcept {
+        if (options_.mode == ShardingMode::Range) {
+            const uint64_t block = trackId / options_.rangeWidth;
+            return (block < options_.shardCount) ? static_cast<uint32_t>(block) : (options_.shardCount - 1U);
+        }
+        return static_cast<uint32_t>(((trackId * 0x9E3779B97F4A7C15ULL) >> 32U) % options_.shardCount);
+    }
+
+    [[nodiscard]] uint32_t getShardCount() const noexcept;
+    [[nodiscard]] const ServiceDescriptor& getService() const noexcept;
+    [[nodiscard]] const std::string& groupOf(uint32_t shard) const;
+    [[nodiscard]] const EndpointConfig& endpointOf(uint32_t shard) const;
+
+    /// Range mode: shards holding any trackId in [firstTrackId, lastTrackId]; hash mode: all shards
+    [[nodiscard]] std::vector<uint32_t> shardsForRange(uint64_t firstTrackId, uint64_t lastTrackId) const;
+
+private:
+    const ServiceDescriptor& service_;
+    ShardingOptions options_;
+    std::vector<std::string> groups_;
+    std::vector<EndpointConfig> endpoints_;
+};
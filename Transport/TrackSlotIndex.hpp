@@ -0,0 +1,81 @@
+#pragma once
+
+// MISRA C++ 2023 compliant includes
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+/**
+ * @brief Fixed-size open-addressing map from trackId to a slot number.
+ * Sized for at most maxEntries keys at a load factor of 0.5, allocated once;
+ * linear probing with backward-shift deletion keeps lookups short without
+ * tombstones, so find/insert/erase are O(1) on average and never allocate.
+ */
+class TrackSlotIndex final {
+public:
+    static constexpr uint32_t NOT_FOUND = 0xFFFFFFFFU;
+
+    explicit TrackSlotIndex(std::size_t maxEntries) {
+        std::size_t buckets = 2U;
+        while (buckets < (maxEntries * 2U)) {
+            buckets <<= 1U;
+        }
+        buckets_.resize(buckets);
+        mask_ = buckets - 1U;
+    }
+
+    [[nodiscard]] uint32_t find(uint64_t trackId) const noexcept {
+        for (std::size_t bucket = bucketOf(trackId); buckets_[bucket].used; bucket = (bucket + 1U) & mask_) {
+            if (buckets_[bucket].trackId == trackId) {
+                return buckets_[bucket].slot;
+            }
+        }
+        return NOT_FOUND;
+    }
+
+    /// The key must be absent and fewer than maxEntries keys present
+    void insert(uint64_t trackId, uint32_t slot) noexcept {
+        std::size_t bucket = bucketOf(trackId);
+        while (buckets_[bucket].used) {
+            bucket = (bucket + 1U) & mask_;
+        }
+        buckets_[bucket] = Bucket{trackId, slot, true};
+    }
+
+    bool erase(uint64_t trackId) noexcept {
+        std::size_t hole = bucketOf(trackId);
+        while (buckets_[hole].used && (buckets_[hole].trackId != trackId)) {
+            hole = (hole + 1U) & mask_;
+        }
+        if (!buckets_[hole].used) {
+            return false;
+        }
+        // Backward-shift deletion: pull later entries of the probe run into the hole
+        buckets_[hole].used = false;
+        for (std::size_t next = (hole + 1U) & mask_; buckets_[next].used; next = (next + 1U) & mask_) {
+            const std::size_t home = bucketOf(buckets_[next].trackId);
+            const bool movable =
+                (hole <= next) ? ((home <= hole) || (home > next)) : ((home <= hole) && (home > next));
+            if (movable) {
+                buckets_[hole] = buckets_[next];
+                buckets_[next].used = false;
+                hole = next;
+            }
+        }
+        return true;
+    }
+
+private:
+    struct Bucket {
+        uint64_t trackId{0U};
+        uint32_t slot{0U};
+        bool used{false};
+    };
+
+    [[nodiscard]] std::size_t bucketOf(uint64_t trackId) const noexcept {
+        return static_cast<std::size_t>((trackId * 0x9E3779B97F4A7C15ULL) >> 32U) & mask_;
+    }
+
+    std::vector<Bucket> buckets_;
+    std::size_t mask_{0U};
+};
@@ -0,0 +1,21 @@
+#include "TransportMetrics.hpp"
+
+#include <utility>
+
+void TransportMetrics::addCollector(Collector collector) {
+    collectors_.push_back(std::move(collector));
+}
+
+std::vector<MetricSample> TransportMetrics::snapshot() const {
+    std::vector<MetricSample> samples;
+    for (const Collector& collector : collectors_) {
+        collector(samples);
+    }
+    return samples;
+}
+
+void TransportMetrics::writeText(std::ostream& out) const {
+    for (const MetricSample& sample : snapshot()) {
+        out << sample.name << ' ' << sample.value << '\n';
+    }
+}
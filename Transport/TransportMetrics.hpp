@@ -0,0 +1,37 @@
+#pragma once
+
+// MISRA C++ 2023 compliant includes
+#include <cstdint>
+#include <functional>
+#include <ostream>
+#include <string>
+#include <vector>
+
+/// One named counter value taken from a metrics snapshot
+struct MetricSample final {
+    std::string name;
+    uint64_t value{0U};
+};
+
+/**
+ * @brief Metrics surface of the transport.
+ * Components register collectors once during setup; snapshot() can then be
+ * called from any thread and reads the components' relaxed atomic counters.
+ */
+class TransportMetrics final {
+public:
+    using Collector = std::function<void(std::vector<MetricSample>&)>;
+
+    explicit TransportMetrics() noexcept = default;
+
+    /// Not thread-safe: register everything before snapshots start
+    void addCollector(Collector collector);
+
+    [[nodiscard]] std::vector<MetricSample> snapshot() const;
+
+    /// Writes "name value" lines
+    void writeText(std::ostream& out) const;
+
+private:
+    std::vector<Collector> collectors_;
+};
@@ -0,0 +1,193 @@
+#include "TscClock.hpp"
+
+#include <ctime>
+
+#if defined(__x86_64__) || defined(__i386__)
+#include <cpuid.h>
+#include <x86intrin.h>
+#endif
+
+namespace {
+
+constexpr int64_t NANOSECONDS_PER_SECOND = 1000000000LL;
+/// clock_gettime() reads bracketed by rdtsc per sample; the tightest pair wins
+constexpr int SAMPLE_ATTEMPTS = 5;
+
+uint64_t multiplierFor(uint64_t frequencyHz) noexcept {
+    return static_cast<uint64_t>((static_cast<TscClock::UnsignedWide>(NANOSECONDS_PER_SECOND) << TscClock::SHIFT) /
+                                 frequencyHz);
+}
+
+}  // namespace
+
+TscClock::TscClock() : TscClock(Options{}) {}
+
+TscClock::TscClock(const Options& options) : options_(options), tscAvailable_(hasInvariantTsc()) {
+    if (!tscAvailable_) {
+        return;
+    }
+    anchor_ = takeSample();
+    std::this_thread::sleep_for(options_.initialCalibration);
+    const Sample sample = takeSample();
+    if ((sample.ns <= anchor_.ns) || (sample.tsc <= anchor_.tsc)) {
+        // Clock stepped during calibration: stay on clock_gettime()
+        tscAvailable_ = false;
+        return;
+    }
+
+    const uint64_t frequency = static_cast<uint64_t>(
+        (static_cast<UnsignedWide>(sample.tsc - anchor_.tsc) * NANOSECONDS_PER_SECOND) /
+        static_cast<uint64_t>(sample.ns - anchor_.ns));
+    frequencyHz_.store(frequency, std::memory_order_relaxed);
+    intervalTicks_ = static_cast<uint64_t>(
+        (static_cast<UnsignedWide>(frequency) * static_cast<uint64_t>(options_.recalibrationInterval.count())) / 1000U);
+    publish(sample.tsc, sample.ns, multiplierFor(frequency));
+
+    if (options_.recalibrationInterval.count() > 0) {
+        thread_ = std::thread(&TscClock::threadMain, this);
+    }
+}
+
+TscClock::~TscClock() {
+    {
+        const std::lock_guard<std::mutex> lock(mutex_);
+        stopping_ = true;
+    }
+    wakeup_.notify_all();
+    if (thread_.joinable()) {
+        thread_.join();
+    }
+}
+
+void TscClock::threadMain() {
+    std::unique_lock<std::mutex> lock(mutex_);
+    while (!wakeup_.wait_for(lock, options_.recalibrationInterval, [this]() { return stopping_; })) {
+        recalibrate();
+    }
+}
+
+void TscClock::recalibrate() noexcept {
+    if (!tscAvailable_) {
+        return;
+    }
+    const Sample sample = takeSample();
+    // Only the recalibrating thread writes the parameters, so relaxed reads see its own values
+    const uint64_t baseTsc = baseTsc_.load(std::memory_order_relaxed);
+    const int64_t baseNs = baseNs_.load(std::memory_order_relaxed);
+    const uint64_t mult = mult_.load(std::memory_order_relaxed);
+    const int64_t predicted = baseNs + scale(sample.tsc - baseTsc, mult);
+    const int64_t offset = sample.ns - predicted;
+    lastOffsetNs_.store(offset, std::memory_order_relaxed);
+    recalibrations_.add();
+
+    const int64_t elapsedNs = sample.ns - anchor_.ns;
+    if ((offset > STEP_THRESHOLD_NS) || (offset < -STEP_THRESHOLD_NS) || (elapsedNs <= 0)) {
+        // CLOCK_REALTIME was set: restart the frequency baseline and jump
+        anchor_ = sample;
+        steps_.add();
+        publish(sample.tsc, sample.ns, mult);
+        return;
+    }
+
+    // The frequency comes from the whole baseline, which averages out sampling noise
+    const uint64_t frequency = static_cast<uint64_t>(
+        (static_cast<UnsignedWide>(sample.tsc - anchor_.tsc) * NANOSECONDS_PER_SECOND) /
+        static_cast<uint64_t>(elapsedNs));
+    frequencyHz_.store(frequency, std::memory_order_relaxed);
+    const uint64_t nominal = multiplierFor(frequency);
+    if (intervalTicks_ == 0U) {
+        publish(sample.tsc, sample.ns, nominal);
+        return;
+    }
+
+    // Continue from the predicted reading and absorb the offset over one interval
+    const SignedWide correction =
+        (static_cast<SignedWide>(offset) << SHIFT) / static_cast<SignedWide>(intervalTicks_);
+    publish(sample.tsc, predicted, static_cast<uint64_t>(static_cast<SignedWide>(nominal) + correction));
+}
+
+void TscClock::publish(uint64_t baseTsc, int64_t baseNs, uint64_t mult) noexcept {
+    const uint32_t sequence = sequence_.load(std::memory_order_relaxed);
+    sequence_.store(sequence + 1U, std::memory_order_relaxed);
+    std::atomic_thread_fence(std::memory_order_release);
+    baseTsc_.store(baseTsc, std::memory_order_relaxed);
+    baseNs_.store(baseNs, std::memory_order_relaxed);
+    mult_.store(mult, std::memory_order_relaxed);
+    sequence_.store(sequence + 2U, std::memory_order_release);
+}
+
+TscClock::Sample TscClock::takeSample() noexcept {
+    Sample best;
+    uint64_t bestWindow = UINT64_MAX;
+    for (int attempt = 0; attempt < SAMPLE_ATTEMPTS; ++attempt) {
+        const uint64_t before = readTsc();
+        const int64_t ns = realtimeNs();
+        const uint64_t after = readTsc();
+        if ((after - before) < bestWindow) {
+            bestWindow = after - before;
+            best.tsc = before + (bestWindow / 2U);
+            best.ns = ns;
+        }
+    }
+    return best;
+}
+
+bool TscClock::isTscAvailable() const noexcept {
+    return tscAvailable_;
+}
+
+uint64_t TscClock::getFrequencyHz() const noexcept {
+    return frequencyHz_.load(std::memory_order_relaxed);
+}
+
+int64_t TscClock::getLastOffsetNs() const noexcept {
+    return lastOffsetNs_.load(std::memory_order_relaxed);
+}
+
+uint64_t TscClock::getRecalibrationCount() const noexcept {
+    return recalibrations_.load();
+}
+
+uint64_t TscClock::getStepCount() const noexcept {
+    return steps_.load();
+}
+
+void TscClock::registerMetrics(TransportMetrics& metrics, const std::string& prefix) const {
+    metrics.addCollector([this, prefix](std::vector<MetricSample>& samples) {
+        const int64_t offset = getLastOffsetNs();
+        samples.push_back({prefix + ".frequency_hz", getFrequencyHz()});
+        samples.push_back({prefix + ".recalibrations", recalibrations_.load()});
+        samples.push_back({prefix + ".steps", steps_.load()});
+        samples.push_back({prefix + ".last_offset_abs_ns", static_cast<uint64_t>((offset < 0) ? -offset : offset)});
+    });
+}
+
+uint64_t TscClock::readTsc() noexcept {
+#if defined(__x86_64__) || defined(__i386__)
+    return __rdtsc();
+#else
+    return 0U;
+#endif
+}
+
+int64_t TscClock::realtimeNs() noexcept {
+    timespec now{};
+    (void)clock_gettime(CLOCK_REALTIME, &now);
+    return (static_cast<int64_t>(now.tv_sec) * NANOSECONDS_PER_SECOND) + now.tv_nsec;
+}
+
+bool TscClock::hasInvariantTsc() noexcept {
+#if defined(__x86_64__) || defined(__i386__)
+    unsigned eax = 0U;
+    unsigned ebx = 0U;
+    unsigned ecx = 0U;
+    unsigned edx = 0U;
+    if ((__get_cpuid(0x80000000U, &eax, &ebx, &ecx, &edx) == 0) || (eax < 0x80000007U)) {
+        return false;
+    }
+    (void)__get_cpuid(0x80000007U, &eax, &ebx, &ecx, &edx);
+    return (edx & (1U << 8U)) != 0U;
+#else
+    return false;
+#endif
+}
@@ -0,0 +1,125 @@
+#pragma once
+
+// MISRA C++ 2023 compliant includes
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstdint>
+#include <mutex>
+#include <string>
+#include <thread>
+
+#include "RelaxedCounter.hpp"
+#include "TransportMetrics.hpp"
+
+/**
+ * @brief CLOCK_REALTIME nanoseconds derived from the invariant TSC.
+ * nowNs() is one rdtsc plus a fixed-point multiply:
+ *     ns = baseNs + ((tsc - baseTsc) * mult) >> SHIFT
+ * A background thread re-measures the TSC against CLOCK_REALTIME and
+ * publishes new parameters through a seqlock. Small offsets are slewed out
+ * over the next interval, so readings stay continuous; offsets above
+ * STEP_THRESHOLD_NS (e.g. a settimeofday) are stepped.
+ * Without an invariant TSC, nowNs() falls back to clock_gettime().
+ */
+class TscClock final {
+public:
+    struct Options final {
+        /// Recalibration period of the background thread (0 = calibrate once, no thread)
+        std::chrono::milliseconds recalibrationInterval{1000};
+        /// Length of the initial frequency measurement done by the constructor
+        std::chrono::milliseconds initialCalibration{20};
+    };
+
+    static constexpr uint32_t SHIFT = 32U;
+    static constexpr int64_t STEP_THRESHOLD_NS = 1000000;
+
+    explicit TscClock();
+    explicit TscClock(const Options& options);
+
+    // Copy constructor
+    TscClock(const TscClock& other) = delete;
+
+    // Copy assignment operator
+    TscClock& operator=(const TscClock& other) = delete;
+
+    // Destructor
+    ~TscClock();
+
+    /// CLOCK_REALTIME in nanoseconds
+    [[nodiscard]] int64_t nowNs() const noexcept {
+        if (!tscAvailable_) {
+            return realtimeNs();
+        }
+        uint64_t baseTsc = 0U;
+        int64_t baseNs = 0;
+        uint64_t mult = 0U;
+        uint32_t before = 0U;
+        do {
+            before = sequence_.load(std::memory_order_acquire);
+            baseTsc = baseTsc_.load(std::memory_order_relaxed);
+            baseNs = baseNs_.load(std::memory_order_relaxed);
+            mult = mult_.load(std::memory_order_relaxed);
+            std::atomic_thread_fence(std::memory_order_acquire);
+        } while (((before & 1U) != 0U) || (before != sequence_.load(std::memory_order_relaxed)));
+        return baseNs + scale(readTsc() - baseTsc, mult);
+    }
+
+    /// Takes one calibration point now; only call it directly when recalibrationInterval is 0
+    void recalibrate() noexcept;
+
+    [[nodiscard]] bool isTscAvailable() const noexcept;
+    /// Measured TSC frequency in Hz (0 without TSC)
+    [[nodiscard]] uint64_t getFrequencyHz() const noexcept;
+    /// clock_gettime() minus nowNs() observed at the last recalibration
+    [[nodiscard]] int64_t getLastOffsetNs() const noexcept;
+    [[nodiscard]] uint64_t getRecalibrationCount() const noexcept;
+    [[nodiscard]] uint64_t getStepCount() const noexcept;
+
+    /// Exposes frequency, recalibration/step counts and |last offset|
+    void registerMetrics(TransportMetrics& metrics, const std::string& prefix = "tsc_clock") const;
+
+    static uint64_t readTsc() noexcept;
+    static int64_t realtimeNs() noexcept;
+    /// True when CPUID reports an invariant (constant rate, non-stop) TSC
+    static bool hasInvariantTsc() noexcept;
+
+    // 128-bit intermediates keep (ticks * mult) exact; __extension__ silences -Wpedantic
+    __extension__ typedef unsigned __int128 UnsignedWide;
+    __extension__ typedef __int128 SignedWide;
+
+private:
+    struct Sample final {
+        uint64_t tsc{0U};
+        int64_t ns{0};
+    };
+
+    static int64_t scale(uint64_t ticks, uint64_t mult) noexcept {
+        return static_cast<int64_t>((static_cast<UnsignedWide>(ticks) * mult) >> SHIFT);
+    }
+
+    static Sample takeSample() noexcept;
+    void publish(uint64_t baseTsc, int64_t baseNs, uint64_t mult) noexcept;
+    void threadMain();
+
+    Options options_;
+    bool tscAvailable_{false};
+
+    alignas(64) std::atomic<uint32_t> sequence_{0U};
+    std::atomic<uint64_t> baseTsc_{0U};
+    std::atomic<int64_t> baseNs_{0};
+    std::atomic<uint64_t> mult_{0U};
+
+    // Calibration state, only touched by the recalibrating thread
+    alignas(64) Sample anchor_{};
+    uint64_t intervalTicks_{0U};
+    std::atomic<uint64_t> frequencyHz_{0U};
+    std::atomic<int64_t> lastOffsetNs_{0};
+    RelaxedCounter recalibrations_;
+    RelaxedCounter steps_;
+
+    std::mutex mutex_;
+    std::condition_variable wakeup_;
+    bool stopping_{false};
+    std::thread thread_;
+};
@@ -297,6 +297,19 @@ EOF
     bool deserialize(const std::vector<uint8_t>& data) noexcept;
     [[nodiscard]] std::size_t getSerializedSize() const noexcept;
 
+    // Zero-copy Binary Serialization - MISRA compliant
+    /// Writes getSerializedSize() bytes to out and returns that count
+    std::size_t serializeInto(uint8_t* out) const noexcept;
+    bool deserialize(const uint8_t* data, std::size_t size) noexcept;
+
+    // Binary Serialization with CRC32C trailer - MISRA compliant
+    static constexpr std::size_t CHECKSUM_SIZE = 4U;
+    [[nodiscard]] std::vector<uint8_t> serializeWithChecksum() const;
+    /// Writes getSerializedSize() + CHECKSUM_SIZE bytes to out and returns that count
+    std::size_t serializeWithChecksumInto(uint8_t* out) const noexcept;
+    bool deserializeWithChecksum(const std::vector<uint8_t>& data) noexcept;
+    bool deserializeWithChecksum(const uint8_t* data, std::size_t size) noexcept;
+
 private:
 EOF
 
@@ -334,6 +347,7 @@ EOF
     # Source dosyası oluştur (.cpp)
     cat > "$source_file" << EOF
 #include "${title}.hpp"
+#include "Crc32c.hpp"
 
 // MISRA C++ 2023 compliant constructor implementation
 $title::$title() noexcept {
@@ -415,8 +429,13 @@ EOF
 
 // MISRA C++ 2023 compliant Binary Serialization Implementation
 std::vector<uint8_t> $title::serialize() const {
-    std::vector<uint8_t> buffer;
-    buffer.reserve(getSerializedSize());
+    std::vector<uint8_t> buffer(getSerializedSize());
+    (void)serializeInto(buffer.data());
+    return buffer;
+}
+
+std::size_t $title::serializeInto(uint8_t* out) const noexcept {
+    std::size_t offset = 0U;
     
 EOF
 
@@ -427,10 +446,8 @@ EOF
         if [[ "$cpp_type" =~ int.*_t|float|double ]]; then
             cat >> "$source_file" << EOF
     // Serialize ${field_name}_
-    {
-        const uint8_t* ptr = reinterpret_cast<const uint8_t*>(&${field_name}_);
-        buffer.insert(buffer.end(), ptr, ptr + sizeof(${field_name}_));
-    }
+    std::memcpy(&out[offset], &${field_name}_, sizeof(${field_name}_));
+    offset += sizeof(${field_name}_);
     
 EOF
         elif [ "$cpp_type" = "std::string" ]; then
@@ -438,9 +455,10 @@ EOF
     // Serialize ${field_name}_ (string) - MISRA compliant
     {
         const std::uint32_t length = static_cast<std::uint32_t>(${field_name}_.length());
-        const std::uint8_t* length_ptr = reinterpret_cast<const std::uint8_t*>(&length);
-        buffer.insert(buffer.end(), length_ptr, length_ptr + sizeof(length));
-        buffer.insert(buffer.end(), ${field_name}_.cbegin(), ${field_name}_.cend());
+        std::memcpy(&out[offset], &length, sizeof(length));
+        offset += sizeof(length);
+        std::memcpy(&out[offset], ${field_name}_.data(), length);
+        offset += length;
     }
     
 EOF
@@ -448,11 +466,15 @@ EOF
     done
     
     cat >> "$source_file" << EOF
-    return buffer;
+    return offset;
 }
 
 bool $title::deserialize(const std::vector<uint8_t>& data) noexcept {
-    if (data.size() < getSerializedSize()) {
+    return deserialize(data.data(), data.size());
+}
+
+bool $title::deserialize(const uint8_t* data, std::size_t size) noexcept {
+    if (size < getSerializedSize()) {
         return false;
     }
     
@@ -467,7 +489,7 @@ EOF
         if [[ "$cpp_type" =~ int.*_t|float|double ]]; then
             cat >> "$source_file" << EOF
     // Deserialize ${field_name}_
-    if (offset + sizeof(${field_name}_) <= data.size()) {
+    if (offset + sizeof(${field_name}_) <= size) {
         std::memcpy(&${field_name}_, &data[offset], sizeof(${field_name}_));
         offset += sizeof(${field_name}_);
     } else {
@@ -478,12 +500,12 @@ EOF
         elif [ "$cpp_type" = "std::string" ]; then
             cat >> "$source_file" << EOF
     // Deserialize ${field_name}_ (string) - MISRA compliant
-    if (offset + sizeof(std::uint32_t) <= data.size()) {
+    if (offset + sizeof(std::uint32_t) <= size) {
         std::uint32_t length{0U};
         std::memcpy(&length, &data[offset], sizeof(length));
         offset += sizeof(std::uint32_t);
         
-        if (offset + length <= data.size()) {
+        if (offset + length <= size) {
             ${field_name}_.assign(reinterpret_cast<const char*>(&data[offset]), length);
             offset += length;
         } else {
@@ -525,8 +547,40 @@ EOF
     
     return size;
 }
-EOF
 
+std::vector<uint8_t> $title::serializeWithChecksum() const {
+    std::vector<uint8_t> buffer(getSerializedSize() + CHECKSUM_SIZE);
+    (void)serializeWithChecksumInto(buffer.data());
+    return buffer;
+}
+
+std::size_t $title::serializeWithChecksumInto(uint8_t* out) const noexcept {
+    const std::size_t size = serializeInto(out);
+    const uint32_t checksum = Crc32c::compute(out, size);
+    std::memcpy(&out[size], &checksum, sizeof(checksum));
+    return size + sizeof(checksum);
+}
+
+bool $title::deserializeWithChecksum(const std::vector<uint8_t>& data) noexcept {
+    return deserializeWithChecksum(data.data(), data.size());
+}
+
+bool $title::deserializeWithChecksum(const uint8_t* data, std::size_t size) noexcept {
+    if (size < CHECKSUM_SIZE) {
+        return false;
+    }
+    
+    const std::size_t payloadSize = size - CHECKSUM_SIZE;
+    uint32_t checksum{0U};
+    std::memcpy(&checksum, &data[payloadSize], sizeof(checksum));
+    if (checksum != Crc32c::compute(data, payloadSize)) {
+        return false;
+    }
+    
+    // Check the size first so a rejected record leaves the object untouched
+    return (getSerializedSize() == payloadSize) && deserialize(data, payloadSize);
+}
+EOF
     echo -e "${GREEN}✅ ${title}.hpp ve ${title}.cpp oluşturuldu${NC}"
 }
 
@@ -563,6 +617,12 @@ main() {
     # CMakeLists.txt oluştur
     create_cmake_file
     
+    # Servis kayıt defterini oluştur
+    create_service_registry
+    
+    # CRC32C yardımcı başlığını oluştur
+    create_checksum_header
+    
     # Örnek main dosyası oluştur
     create_example_main
     
@@ -599,13 +659,248 @@ EOF
             echo "    ${title}.cpp" >> "$MODEL_DIR/CMakeLists.txt"
         fi
     done
-    echo "    main.cpp" >> "$MODEL_DIR/CMakeLists.txt"
     echo ")" >> "$MODEL_DIR/CMakeLists.txt"
     
     cat >> "$MODEL_DIR/CMakeLists.txt" << 'EOF'
 
+# Model library
+add_library(track_models STATIC ${SOURCES})
+target_include_directories(track_models PUBLIC ${CMAKE_CURRENT_SOURCE_DIR})
+
 # Example executable
-add_executable(model_example ${SOURCES})
+add_executable(model_example main.cpp)
+target_link_libraries(model_example PRIVATE track_models)
+EOF
+}
+
+# CRC32C yardımcı başlığını oluştur (isteğe bağlı kayıt sonu sağlama toplamı)
+create_checksum_header() {
+    echo -e "${YELLOW}Crc32c.hpp oluşturuluyor...${NC}"
+
+    cat > "$MODEL_DIR/Crc32c.hpp" << 'EOF'
+#pragma once
+
+// MISRA C++ 2023 compliant includes
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#if defined(__x86_64__) || defined(__i386__)
+#include <cpuid.h>
+#include <nmmintrin.h>
+#endif
+
+/**
+ * @brief CRC32C (Castagnoli) of the optional record trailer.
+ * compute() uses the SSE4.2 crc32 instruction when the CPU has it and a
+ * slicing-by-8 table otherwise; both give the same value.
+ * Auto-generated helper, shared by all model classes
+ */
+class Crc32c final {
+public:
+    static constexpr uint32_t POLYNOMIAL = 0x82F63B78U;  // reflected 0x1EDC6F41
+
+    [[nodiscard]] static uint32_t compute(const uint8_t* data, std::size_t size) noexcept {
+        return hasHardwareSupport() ? computeHardware(data, size) : computeSoftware(data, size);
+    }
+
+    [[nodiscard]] static bool hasHardwareSupport() noexcept {
+#if defined(__x86_64__) || defined(__i386__)
+        static const bool supported = []() {
+            unsigned int eax = 0U;
+            unsigned int ebx = 0U;
+            unsigned int ecx = 0U;
+            unsigned int edx = 0U;
+            return (__get_cpuid(1U, &eax, &ebx, &ecx, &edx) != 0) && ((ecx & bit_SSE4_2) != 0U);
+        }();
+        return supported;
+#else
+        return false;
+#endif
+    }
+
+    [[nodiscard]] static uint32_t computeSoftware(const uint8_t* data, std::size_t size) noexcept {
+        const Tables& tables = getTables();
+        uint32_t crc = 0xFFFFFFFFU;
+        while (size >= 8U) {
+            uint32_t low = 0U;
+            uint32_t high = 0U;
+            std::memcpy(&low, data, sizeof(low));
+            std::memcpy(&high, data + 4, sizeof(high));
+            low ^= crc;
+            crc = tables.slice[7][low & 0xFFU] ^ tables.slice[6][(low >> 8U) & 0xFFU] ^
+                  tables.slice[5][(low >> 16U) & 0xFFU] ^ tables.slice[4][low >> 24U] ^
+                  tables.slice[3][high & 0xFFU] ^ tables.slice[2][(high >> 8U) & 0xFFU] ^
+                  tables.slice[1][(high >> 16U) & 0xFFU] ^ tables.slice[0][high >> 24U];
+            data += 8;
+            size -= 8U;
+        }
+        while (size > 0U) {
+            crc = tables.slice[0][(crc ^ *data) & 0xFFU] ^ (crc >> 8U);
+            ++data;
+            --size;
+        }
+        return ~crc;
+    }
+
+#if defined(__x86_64__)
+    __attribute__((target("sse4.2"))) [[nodiscard]] static uint32_t computeHardware(const uint8_t* data,
+                                                                                    std::size_t size) noexcept {
+        uint64_t crc = 0xFFFFFFFFU;
+        while (size >= 8U) {
+            uint64_t word = 0U;
+            std::memcpy(&word, data, sizeof(word));
+            crc = _mm_crc32_u64(crc, word);
+            data += 8;
+            size -= 8U;
+        }
+        uint32_t tail = static_cast<uint32_t>(crc);
+        while (size > 0U) {
+            tail = _mm_crc32_u8(tail, *data);
+            ++data;
+            --size;
+        }
+        return ~tail;
+    }
+#else
+    [[nodiscard]] static uint32_t computeHardware(const uint8_t* data, std::size_t size) noexcept {
+        return computeSoftware(data, size);
+    }
+#endif
+
+private:
+    struct Tables {
+        uint32_t slice[8][256];
+    };
+
+    [[nodiscard]] static const Tables& getTables() noexcept {
+        static const Tables tables = []() {
+            Tables built{};
+            for (uint32_t i = 0U; i < 256U; ++i) {
+                uint32_t crc = i;
+                for (int bit = 0; bit < 8; ++bit) {
+                    crc = ((crc & 1U) != 0U) ? ((crc >> 1U) ^ POLYNOMIAL) : (crc >> 1U);
+                }
+                built.slice[0][i] = crc;
+            }
+            for (uint32_t i = 0U; i < 256U; ++i) {
+                for (int k = 1; k < 8; ++k) {
+                    const uint32_t previous = built.slice[k - 1][i];
+                    built.slice[k][i] = (previous >> 8U) ^ built.slice[0][previous & 0xFFU];
+                }
+            }
+            return built;
+        }();
+        return tables;
+    }
+};
+EOF
+}
+
+# x-service-metadata bloklarından servis kayıt defteri oluştur
+create_service_registry() {
+    echo -e "${YELLOW}ServiceRegistry.hpp oluşturuluyor...${NC}"
+    
+    local registry_file="$MODEL_DIR/ServiceRegistry.hpp"
+    local titles=()
+    for json_file in "$ZMQ_MESSAGES_DIR"/*.json; do
+        if [ -f "$json_file" ] && [ "$(jq -r '."x-service-metadata".port // "null"' "$json_file")" != "null" ]; then
+            titles+=("$(jq -r '.title // "UnknownClass"' "$json_file")")
+        fi
+    done
+    
+    cat > "$registry_file" << 'EOF'
+#pragma once
+
+// MISRA C++ 2023 compliant includes
+#include <cstddef>
+#include <cstring>
+#include <tuple>
+
+EOF
+
+    for title in "${titles[@]}"; do
+        echo "#include \"${title}.hpp\"" >> "$registry_file"
+    done
+    
+    cat >> "$registry_file" << EOF
+
+/**
+ * @brief Endpoint of one message type, taken from its x-service-metadata block.
+ * The RADIO/DISH group equals the schema title.
+ * Auto-generated from the zmq_messages schemas by generate_simple_models.sh
+ */
+struct ServiceDescriptor final {
+    const char* name;
+    const char* group;
+    const char* protocol;
+    const char* multicastAddress;
+    int port;
+    std::size_t index;
+};
+
+/// Number of message types with a service endpoint
+constexpr std::size_t SERVICE_COUNT = ${#titles[@]}U;
+
+/// All service endpoints, ordered by schema file name
+inline constexpr ServiceDescriptor SERVICE_REGISTRY[SERVICE_COUNT] = {
+EOF
+
+    local index=0
+    for json_file in "$ZMQ_MESSAGES_DIR"/*.json; do
+        local port=$(jq -r '."x-service-metadata".port // "null"' "$json_file")
+        if [ "$port" == "null" ]; then
+            continue
+        fi
+        local title=$(jq -r '.title // "UnknownClass"' "$json_file")
+        local protocol=$(jq -r '."x-service-metadata".protocol // "udp"' "$json_file")
+        local multicast_address=$(jq -r '."x-service-metadata".multicast_address // ""' "$json_file")
+        echo "    {\"${title}\", \"${title}\", \"${protocol}\", \"${multicast_address}\", ${port}, ${index}U}," >> "$registry_file"
+        index=$((index + 1))
+    done
+    
+    cat >> "$registry_file" << 'EOF'
+};
+
+/// Looks a service up by message type name; nullptr when unknown
+inline const ServiceDescriptor* findService(const char* name) noexcept {
+    for (const ServiceDescriptor& service : SERVICE_REGISTRY) {
+        if (std::strcmp(service.name, name) == 0) {
+            return &service;
+        }
+    }
+    return nullptr;
+}
+
+/**
+ * @brief Compile-time registry entry of a generated message type.
+ * INDEX addresses per-type state such as publisher sequence numbers.
+ */
+template <typename T>
+struct ServiceTraits;
+EOF
+
+    index=0
+    for title in "${titles[@]}"; do
+        cat >> "$registry_file" << EOF
+
+template <>
+struct ServiceTraits<${title}> {
+    static constexpr const char* GROUP = "${title}";
+    static constexpr std::size_t INDEX = ${index}U;
+    static constexpr const ServiceDescriptor& DESCRIPTOR = SERVICE_REGISTRY[${index}U];
+};
+EOF
+        index=$((index + 1))
+    done
+
+    local type_list
+    type_list=$(IFS=,; echo "${titles[*]}" | sed 's/,/, /g')
+    cat >> "$registry_file" << EOF
+
+/// Every message type with a service endpoint, in SERVICE_REGISTRY order
+using ServiceTypes = std::tuple<${type_list}>;
+
+static_assert(std::tuple_size<ServiceTypes>::value == SERVICE_COUNT, "ServiceTypes must list every service");
 EOF
 }
 